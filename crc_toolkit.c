@@ -0,0 +1,196 @@
+// @brief:  crc toolkit command line: crc of files by model name or params
+
+// for: SEEK_DATA, SEEK_HOLE (glibc)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+/* std headers */
+#include <stdio.h>  // for: printf, fprintf
+#include <stdlib.h> // for: strtoull, malloc
+#include <string.h> // for: strcmp, strerror
+#include <errno.h>  // for: errno
+#include <time.h>   // for: clock_gettime
+#include <fcntl.h>  // for: open
+#include <unistd.h> // for: read, close, getopt, lseek
+#include <sys/mman.h>   // for: mmap, madvise
+#include <sys/stat.h>   // for: fstat
+/* user headers */
+#include "crc_utils.h"
+
+// read() buffer size for pipes and other non-mappable input
+#define READ_BUF_SIZE   (4 * 1024 * 1024)
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "usage: %s [-m model] [-w width -p poly [-i init] [-x xorout] [-r refin] [-R refout]]\n"
+        "       %*s [-t threads] [-e engine | -T profile] [file ...]\n"
+        "  -m model    model name or alias from built-in catalogue (default: CRC-32)\n"
+        "  -w width    polynom order, 1...64 (explicit model)\n"
+        "  -p poly     generator polynom without leading 1, e.g. 0x1021\n"
+        "  -i init     init value for register (default: 0)\n"
+        "  -x xorout   final xor value (default: 0)\n"
+        "  -r refin    reflect input bytes, 0 or 1 (default: 0)\n"
+        "  -R refout   reflect crc register, 0 or 1 (default: refin)\n"
+        "  -t threads  threads per file, 0 for all cpus (default: 1)\n"
+        "  -e engine   pin engine: bitbybit, table, nibble, slice8, slice16, fold, crc32c\n"
+        "  -T profile  tune engines by input length, cached in file 'profile'\n"
+        "  file        '-' or none for stdin\n", prog, (int)strlen(prog), "");
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Read whole fd through streaming api, for pipes, sockets and ttys.
+static int crc_read(int fd, crc_model_t m, crc_t *crc, uint64_t *total) {
+    static uint8_t *buf = NULL;
+    crc_ctx_s ctx;
+    ssize_t n;
+    if (NULL == buf && NULL == (buf = malloc(READ_BUF_SIZE))) return -1;
+    crc_util_begin(&ctx, m);
+    for (*total = 0; ; *total += n) {
+        // retry an interrupted read, without counting it
+        while ((n = read(fd, buf, READ_BUF_SIZE)) < 0) {
+            if (EINTR != errno) return -1;
+        }
+        if (0 == n) break;
+        crc_util_update(&ctx, buf, (size_t)n);
+    }
+    *crc = crc_util_final(&ctx);
+    return 0;
+}
+
+// Sparse regular file: map and run data extents only, holes advance the crc
+// over their zero bytes in O(log n). 1 if the file has no holes.
+static int crc_sparse(int fd, crc_model_t m, int threads, off_t size, crc_t *crc) {
+#ifdef SEEK_HOLE
+    off_t page = (off_t)sysconf(_SC_PAGESIZE), pos, data, hole, base;
+    uint8_t *p;
+    size_t len;
+    crc_t ext;
+    hole = lseek(fd, 0, SEEK_HOLE);
+    if (hole < 0 || hole >= size) return (lseek(fd, 0, SEEK_SET), 1);
+    *crc = crc_util_model_run(m, (const uint8_t *)"", 0);
+    for (pos = 0; pos < size; pos = hole) {
+        if ((data = lseek(fd, pos, SEEK_DATA)) < 0) {
+            if (ENXIO != errno) return -1;
+            data = size;    // hole up to the end
+        }
+        if (data > pos) *crc = crc_util_model_zeros(m, *crc, (uint64_t)(data - pos));
+        if (data >= size) break;
+        if ((hole = lseek(fd, data, SEEK_HOLE)) < 0) return -1;
+        base = data & ~(page - 1);
+        len = (size_t)(hole - base);
+        if ((p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, base)) == MAP_FAILED) return -1;
+        madvise(p, len, MADV_SEQUENTIAL);
+        ext = (threads == 1) ? crc_util_model_run(m, p + (data - base), (size_t)(hole - data))
+            : crc_util_model_run_parallel(m, p + (data - base), (size_t)(hole - data), threads);
+        *crc = crc_util_model_combine(m, *crc, ext, (size_t)(hole - data));
+        munmap(p, len);
+    }
+    return 0;
+#else //! SEEK_HOLE
+    (void)fd, (void)m, (void)threads, (void)size, (void)crc;
+    return 1;
+#endif /* SEEK_HOLE */
+}
+
+// Map regular file and run it in one go (data extents only if sparse), fall
+// back to read() if not mappable.
+static int crc_file(const char *name, crc_model_t m, int threads, crc_t *crc, uint64_t *total) {
+    int rc, fd = strcmp(name, "-") ? open(name, O_RDONLY) : 0;
+    struct stat st;
+    void *p;
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+        rc = crc_read(fd, m, crc, total);
+    }
+    else if ((rc = crc_sparse(fd, m, threads, st.st_size, crc)) <= 0) {
+        *total = (uint64_t)st.st_size;
+    }
+    else if ((p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) != MAP_FAILED) {
+        madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+        *crc = (threads == 1) ? crc_util_model_run(m, p, (size_t)st.st_size)
+            : crc_util_model_run_parallel(m, p, (size_t)st.st_size, threads);
+        *total = (uint64_t)st.st_size;
+        munmap(p, (size_t)st.st_size);
+        rc = 0;
+    }
+    else {
+        rc = crc_read(fd, m, crc, total);
+    }
+    if (fd) close(fd);
+    return rc;
+}
+
+int main(int argc, char *argv[]) {
+    const char *name = "CRC-32", *engine = NULL, *profile = NULL;
+    const crc_model_param_s *found;
+    crc_model_param_s param = { "custom", 0, 0, 0, 0, 0, 0, 0, 0 };
+    crc_model_t m;
+    int opt, i, e, refout = -1, threads = 1, rc = 0;
+    uint64_t total;
+    double t;
+    crc_t crc;
+
+    while ((opt = getopt(argc, argv, "m:w:p:i:x:r:R:t:e:T:h")) != -1) {
+        switch (opt) {
+        case 'm': name = optarg; break;
+        case 'w': param.width = (uint8_t)strtoul(optarg, NULL, 0); break;
+        case 'p': param.poly = (crc_t)strtoull(optarg, NULL, 0); break;
+        case 'i': param.init = (crc_t)strtoull(optarg, NULL, 0); break;
+        case 'x': param.xorout = (crc_t)strtoull(optarg, NULL, 0); break;
+        case 'r': param.refin = (uint8_t)!!atoi(optarg); break;
+        case 'R': refout = !!atoi(optarg); break;
+        case 't': threads = atoi(optarg); break;
+        case 'e': engine = optarg; break;
+        case 'T': profile = optarg; break;
+        default: usage(argv[0]); return 2;
+        }
+    }
+    if (param.width) {
+        param.refout = (uint8_t)((refout < 0) ? param.refin : refout);
+        if (NULL == (m = crc_util_model_init(param, NULL))) {
+            fprintf(stderr, "invalid crc model parameters\n");
+            return 2;
+        }
+    }
+    else if (NULL != (found = crc_util_model_param(name))) {
+        // shared catalogue model, a private copy if it's pinned or tuned
+        param = *found;
+        m = (engine || profile) ? crc_util_model_init(param, NULL) : crc_util_model_get(name);
+    }
+    else {
+        fprintf(stderr, "unknown crc model: %s\n", name);
+        return 2;
+    }
+
+    if (engine) {
+        for (e = 0; crc_util_engine_name((crc_engine_e)e) && strcmp(engine, crc_util_engine_name((crc_engine_e)e)); e++);
+        if (crc_util_model_engine(m, (crc_engine_e)e)) {
+            fprintf(stderr, "crc engine not available: %s\n", engine);
+            return 2;
+        }
+    }
+    else if (profile) {
+        crc_util_model_tune(m, profile);
+    }
+
+    for (i = optind; i < argc || i == optind; i++) {
+        const char *file = (i < argc) ? argv[i] : "-";
+        t = now();
+        if (crc_file(file, m, threads, &crc, &total)) {
+            fprintf(stderr, "%s: %s\n", file, strerror(errno));
+            rc = 1;
+            continue;
+        }
+        t = now() - t;
+        printf("%0*" PRIX64 "  %12" PRIu64 "  %8.3fs  %7.2f GB/s  %s\n", (param.width + 3) / 4,
+            (uint64_t)crc, total, t, (t > 0) ? total / t / 1e9 : 0.0, file);
+    }
+    crc_util_model_fini(m);
+    return rc;
+}
@@ -0,0 +1,213 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: throughput of every engine and catalogue model
+// @file:       crc_bench.c
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+// Usage: ./crc_bench [-m model] [-e engine] [-s max_size] [-t budget_ms] > bench.json
+// (or "make bench"). Every catalogue model runs through every engine usable
+// with it, on sizes 1, 4, 16, ... bytes up to max_size (default 1G), from an
+// aligned and a misaligned (+1) buffer, with warm and cold cache. Results go
+// to stdout as JSON, one point per line, so runs can be diffed over releases.
+
+#include <stdio.h>  // for: printf, fprintf
+#include <stdlib.h> // for: strtoull, malloc
+#include <string.h> // for: memset, strcmp
+#include <time.h>   // for: clock_gettime
+#include <unistd.h> // for: getopt
+
+// Engines are static in crc_utils.c, so take them in directly.
+#include "../src/crc_utils.c"
+#include "../src/crc_catalog.c"
+
+// Cold cache: this much memory is written over before each timed call, and
+// sizes from it on are cold anyway.
+#define CRC_BENCH_FLUSH     (32 << 20)
+// Cold cache: at most this many calls per point.
+#define CRC_BENCH_COLD_MAX  4
+// Skip points one call of which is expected to take longer (seconds).
+#define CRC_BENCH_CALL_MAX  2.0
+
+typedef struct _crc_bench_engine_s {
+    const char *name;
+    crc_t (*run)(const crc_model_t m, const uint8_t *p, size_t len);
+    int (*usable)(const crc_model_t m);
+} crc_bench_engine_s;
+
+static int usable_any(const crc_model_t m) { (void)m; return 1; }
+#if defined(CRC_UTIL_NORMAL) || defined(_DEBUG)
+static int usable_order8(const crc_model_t m) { return 0 == (m->param.width & 7); }
+#endif /* CRC_UTIL_NORMAL || _DEBUG */
+#ifndef CRC_UTIL_NORMAL
+static int usable_slice(const crc_model_t m) { return m->table_num >= CRC_UTIL_SLICE_NUM; }
+#ifdef CRC_UTIL_X86
+static int usable_fold(const crc_model_t m) { return m->fold_enable; }
+#endif /* CRC_UTIL_X86 */
+#if defined(__x86_64__) || defined(_M_X64)
+static int usable_crc32c(const crc_model_t m) { return NULL != m->hw_shift; }
+#endif /* __x86_64__ || _M_X64 */
+#endif /* CRC_UTIL_NORMAL */
+
+static const crc_bench_engine_s crc_bench_engines[] = {
+    { "auto", crc_util_model_run, usable_any },
+#if defined(CRC_UTIL_NORMAL) || defined(_DEBUG)
+    { "bitbybit", crc_util_bitbybit, usable_any },
+    { "table", crc_util_table, usable_order8 },
+#endif /* CRC_UTIL_NORMAL || _DEBUG */
+#ifndef CRC_UTIL_NORMAL
+    { "bitbybit_fast", crc_util_bitbybit_fast, usable_any },
+    { "table_fast", crc_util_table_fast, usable_any },
+    { "nibble", crc_util_nibble, usable_any },
+    { "slice8", crc_util_slice8, usable_slice },
+    { "slice16", crc_util_slice16, usable_slice },
+#ifdef CRC_UTIL_X86
+    { "fold", crc_util_fold, usable_fold },
+#endif /* CRC_UTIL_X86 */
+#if defined(__x86_64__) || defined(_M_X64)
+    { "crc32c", crc_util_crc32c_hw, usable_crc32c },
+#endif /* __x86_64__ || _M_X64 */
+#endif /* CRC_UTIL_NORMAL */
+};
+#define CRC_BENCH_ENGINES   (sizeof(crc_bench_engines) / sizeof(crc_bench_engines[0]))
+
+static volatile crc_t sink;
+static uint8_t *flush_buf;
+static int first = 1;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "usage: %s [-m model] [-e engine] [-s max_size] [-t budget_ms]\n"
+        "  -m model    catalogue model name or alias (default: all)\n"
+        "  -e engine   one of auto, bitbybit, table, bitbybit_fast, table_fast,\n"
+        "              nibble, slice8, slice16, fold, crc32c (default: all)\n"
+        "  -s size     largest buffer size, K/M/G suffix allowed (default: 1G)\n"
+        "  -t ms       time budget per point (default: 10)\n", prog);
+}
+
+static size_t parse_size(const char *s) {
+    char *end;
+    size_t n = (size_t)strtoull(s, &end, 0);
+    switch (*end) {
+    case 'k': case 'K': return n << 10;
+    case 'm': case 'M': return n << 20;
+    case 'g': case 'G': return n << 30;
+    default: return n;
+    }
+}
+
+// Time calls of engine e on p[0, len) for 'budget' seconds, return ns per
+// call. Warm: back to back calls after one warm up call.
+// Cold: caches flushed before each call, only the call is timed.
+static double bench_point(const crc_bench_engine_s *e, const crc_model_t m,
+    const uint8_t *p, size_t len, int cold, double budget, long *calls) {
+    double t, spent = 0;
+    long n = 0, k, reps = 1;
+    if (!cold) {
+        // double calls between clock reads, so tiny sizes don't time the clock
+        sink = e->run(m, p, len);
+        t = now();
+        do {
+            for (k = 0; k < reps; k++) sink = e->run(m, p, len);
+            n += reps;
+            reps *= 2;
+        } while ((spent = now() - t) < budget);
+    }
+    else {
+        do {
+            memset(flush_buf, (int)n, CRC_BENCH_FLUSH);
+            t = now();
+            sink = e->run(m, p, len);
+            spent += now() - t;
+            n++;
+        } while (spent < budget && n < CRC_BENCH_COLD_MAX);
+    }
+    *calls = n;
+    return spent * 1e9 / n;
+}
+
+static void bench_model(const crc_model_param_s *param, const char *engine,
+    const uint8_t *buf, size_t max_size, double budget) {
+    crc_model_t m = crc_util_model_init(*param, NULL);
+    size_t i, len;
+    int align, cold;
+    long calls;
+    double ns, rate[2][2];
+    if (NULL == m) return;
+    for (i = 0; i < CRC_BENCH_ENGINES; i++) {
+        const crc_bench_engine_s *e = &crc_bench_engines[i];
+        if ((engine && strcmp(engine, e->name)) || !e->usable(m)) continue;
+        memset(rate, 0, sizeof(rate));
+        for (len = 1; len <= max_size; len *= 4) {
+            for (align = 0; align < 2; align++) {
+                for (cold = 0; cold < 2; cold++) {
+                    if (cold && len >= CRC_BENCH_FLUSH) continue;
+                    // ns per byte of previous size predicts this one
+                    if (rate[align][cold] * len > CRC_BENCH_CALL_MAX * 1e9) continue;
+                    ns = bench_point(e, m, buf + align, len, cold, budget, &calls);
+                    rate[align][cold] = ns / len;
+                    printf("%s    {\"model\": \"%s\", \"width\": %d, \"engine\": \"%s\", \"size\": %lu, "
+                        "\"align\": %d, \"cache\": \"%s\", \"calls\": %ld, \"ns_per_call\": %.1f, \"gbps\": %.3f}",
+                        first ? "" : ",\n", param->name, param->width, e->name, (unsigned long)len,
+                        align, cold ? "cold" : "warm", calls, ns, len / ns);
+                    first = 0;
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+    crc_util_model_fini(m);
+}
+
+int main(int argc, char *argv[]) {
+    const char *name = NULL, *engine = NULL;
+    const crc_model_param_s *param;
+    size_t i, max_size = (size_t)1 << 30;
+    double budget = 0.01;
+    uint8_t *buf;
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "m:e:s:t:h")) != -1) {
+        switch (opt) {
+        case 'm': name = optarg; break;
+        case 'e': engine = optarg; break;
+        case 's': max_size = parse_size(optarg); break;
+        case 't': budget = atof(optarg) / 1e3; break;
+        default: usage(argv[0]); return 2;
+        }
+    }
+    if (name && NULL == crc_util_model_param(name)) {
+        fprintf(stderr, "unknown crc model: %s\n", name);
+        return 2;
+    }
+    if (max_size < 1 || NULL == (buf = malloc(max_size + 64)) ||
+        NULL == (flush_buf = malloc(CRC_BENCH_FLUSH))) {
+        fprintf(stderr, "can't allocate %lu bytes\n", (unsigned long)max_size);
+        return 1;
+    }
+    // aligned start for align 0, xorshift fill, which touches all pages too
+    buf += (64 - ((uintptr_t)buf & 63)) & 63;
+    for (i = 0; i < max_size + 1; i++) {
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        buf[i] = (uint8_t)x;
+    }
+
+    printf("{\n  \"budget_ms\": %.1f,\n  \"results\": [\n", budget * 1e3);
+    if (name) {
+        bench_model(crc_util_model_param(name), engine, buf, max_size, budget);
+    }
+    else {
+        for (i = 0; NULL != (param = crc_util_model_param_at(i)); i++) {
+            bench_model(param, engine, buf, max_size, budget);
+        }
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,83 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: generate src/crc_catalog_table.h
+// @file:       crc_catalog_gen.c
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+// Usage: ./crc_catalog_gen > src/crc_catalog_table.h (or "make catalog")
+
+#include <stdio.h>  // for: printf
+
+#define CRC_CATALOG_GEN
+#include "../src/crc_catalog.c"
+
+// Reflects the lower 'bitnum' bits of 'crc'
+static crc_t reflect(crc_t crc, int bitnum) {
+    crc_t crcout = 0;
+    int i;
+    for (i = 0; i < bitnum; i++) {
+        if (crc & ((crc_t)1 << i)) crcout |= (crc_t)1 << (bitnum - 1 - i);
+    }
+    return crcout;
+}
+
+// Byte table as crc_util_table_generate, for poly left-aligned to 'order'.
+static void table_generate(const crc_model_param_s *param, crc_t table[256]) {
+    int order = (param->width + 7) & ~7, i, j;
+    crc_t poly = param->poly << (order - param->width);
+    crc_t high_bit = (crc_t)1 << (order - 1), mask = (high_bit << 1) - 1;
+    if (64 == order) mask = ~(crc_t)0;
+    for (i = 0; i < 256; i++) {
+        crc_t crc = param->refin ? reflect(i, 8) : (crc_t)i;
+        crc <<= order - 8;
+        for (j = 0; j < 8; j++) {
+            crc = (crc & high_bit) ? (crc << 1) ^ poly : crc << 1;
+        }
+        if (param->refin) crc = reflect(crc, order);
+        table[i] = crc & mask;
+    }
+}
+
+// Models with same width, poly and refin share one table.
+static int table_owner(int index) {
+    const crc_model_param_s *a = &crc_catalog[index].param, *b;
+    int i;
+    for (i = 0; i < index; i++) {
+        b = &crc_catalog[i].param;
+        if (a->width == b->width && a->poly == b->poly && a->refin == b->refin) return i;
+    }
+    return index;
+}
+
+int main(void) {
+    crc_t table[256];
+    int i, j, order, digits;
+    printf("// ------------------------------------------------------------------------\n");
+    printf("// @brief:      crc toolkit: precomputed tables of built-in catalogue\n");
+    printf("// @file:       crc_catalog_table.h\n");
+    printf("// ------------------------------------------------------------------------\n\n");
+    printf("// Generated by extsrc/crc_catalog_gen.c (make catalog), don't edit.\n\n");
+    for (i = 0; i < CRC_CATALOG_SIZE; i++) {
+        const crc_model_param_s *param = &crc_catalog[i].param;
+        if (table_owner(i) != i) continue;
+        order = (param->width + 7) & ~7;
+        order = (order <= 16) ? 16 : (order <= 32) ? 32 : 64;
+        digits = order / 4;
+        table_generate(param, table);
+        printf("// %s\n", param->name);
+        printf("static const uint%d_t crc_catalog_table_%d[256] = {", order, i);
+        for (j = 0; j < 256; j++) {
+            printf("%s0x%0*" PRIX64 "%s,", (j % ((64 == order) ? 4 : 8)) ? " " : "\n    ",
+                digits, (uint64_t)table[j], (64 == order) ? "ULL" : "");
+        }
+        printf("\n};\n\n");
+    }
+    printf("#define CRC_CATALOG_NUM     %d\n\n", CRC_CATALOG_SIZE);
+    printf("static const void *const crc_catalog_tables[CRC_CATALOG_NUM] = {");
+    for (i = 0; i < CRC_CATALOG_SIZE; i++) {
+        printf("%scrc_catalog_table_%d,", (i % 6) ? " " : "\n    ", table_owner(i));
+    }
+    printf("\n};\n");
+    return 0;
+}
@@ -0,0 +1,60 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: compile time models against crc_util_model_run
+// @file:       crc_model_test.cpp
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+// Usage: ./crc_model_test (built by "make sample", needs -std=c++17).
+// Every crc::model alias of crc_model.hpp runs on pseudo random input of
+// 0 to 5000 bytes, in one go and in two pieces, and is compared with a
+// crc_util_model_init model of the same parameters. Exits 1 on mismatch.
+
+/* std headers */
+#include <stdio.h>  // for: printf
+#include <stdint.h> // for: uint8_t
+/* user headers */
+#include "crc_model.hpp"
+
+static uint8_t buf[5000];
+
+template <typename Model>
+static int test(const char *name) {
+    crc_model_t m = crc_util_model_init(Model::param(name), NULL);
+    int fail = 0;
+    size_t len, half;
+    if (NULL == m) {
+        printf("%-16s: crc_util_model_init failed\n", name);
+        return 1;
+    }
+    for (len = 0; len <= sizeof(buf); len += (len < 64) ? 1 : 997) {
+        crc_t crc = crc_util_model_run(m, buf, len);
+        half = len / 3;
+        if (Model::run(buf, len) != crc ||
+            Model::final(Model::update(Model::update(Model::begin(), buf, half), buf + half, len - half)) != crc) {
+            printf("%-16s: mismatch at %lu bytes: 0x" CRC_F "(0x" CRC_F ")\n", name,
+                (unsigned long)len, Model::run(buf, len), crc);
+            fail = 1;
+        }
+    }
+    crc_util_model_fini(m);
+    printf("%-16s: %s\n", name, fail ? "failed" : "passed");
+    return fail;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t seed = 1;
+    size_t n;
+    for (n = 0; n < sizeof(buf); n++) {
+        seed = seed * 1103515245 + 12345;
+        buf[n] = (uint8_t)(seed >> 16);
+    }
+    int fail = 0;
+    fail |= test<crc::crc16_modbus>("CRC-16/MODBUS");
+    fail |= test<crc::crc16_x25>("CRC-16/IBM-SDLC");
+    fail |= test<crc::crc16_xmodem>("CRC-16/XMODEM");
+    fail |= test<crc::crc32>("CRC-32/ISO-HDLC");
+    fail |= test<crc::crc32c>("CRC-32/ISCSI");
+    fail |= test<crc::crc64_xz>("CRC-64/XZ");
+    return fail;
+}
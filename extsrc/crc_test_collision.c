@@ -4,15 +4,47 @@
  * This program is designed to test an N-bit CRC against a word dictionary
  * which you pipe into it. It is not required for normal diablo operation.
  *
- * Warning: This program will eat a lot of memory with large sets. If the
- * set is known to be unique, you can use -u to reduce the memory footprint.
+ * Warning: This program will eat a lot of memory with large sets, some 16
+ * bytes per key. Keys themselves are not copied, they stay in the input.
  *
- * cat unique-words | CRCTEST [-u] [-v] [-q] [-h#]
+ * cat unique-words | CRCTEST [-u] [-v] [-q] [-h#[-#]] [-m model[,model...]] [-t#] [-d dir [-M#]] [file]
  *
- *  -h# set final hash size, in bits 16-64(Default is 64 bits)
- *  -u  assume unique input, do not store string contents
- *  -v  verbose output, print collisions
- *  -q  quiet output, do not print the count every 100,000 tests
+ *  -h# set final hash size, in bits 16-64(Default is 64 bits), or a range
+ *      of sizes, e.g. -h16-64
+ *  -m  crc model of the built-in catalogue(Default is CRC-64/XZ), the
+ *      hash is its low bits, or a list of up to MAXMODELS models
+ *  -t# number of threads(Default is all cpus)
+ *  -u  assume unique input, do not compare string contents
+ *  -v  verbose output, print collisions(one model and size only)
+ *  -q  quiet output, do not print progress
+ *  -d  count in external memory, with sorted run files in directory 'dir'
+ *  -M# memory for run buffers with -d, in MB(Default is 1024)
+ *  file    word dictionary, mapped if it's a regular file(Default is stdin)
+ *
+ * Keys are separated by any of " ,\t\r\n". Each thread hashes a slice of
+ * the input and sorts (hash, key offset) records into 2^PARTBITS partitions
+ * by the top hash bits. Then each partition is checked on its own, by one
+ * thread, in an open addressing table small enough to stay in cache. Keys
+ * of a partition are checked in input order, so the result is the same as
+ * that of a single pass over the input.
+ *
+ * With -d, memory doesn't grow with the number of keys. Input from stdin is
+ * spooled to a file in 'dir' and mapped. Each thread fills a buffer of
+ * records, radix sorts it by hash and hands it to a writer thread, which
+ * appends it as a run to one unlinked file in 'dir', while the thread goes
+ * on with the other buffer. With -u, runs only hold hashes (8 bytes per key).
+ * Then runs are merged MERGEFAN at a time into longer runs of a new file, in
+ * as many passes as needed, so each run gets a large read-ahead buffer. The
+ * last pass checks keys of the same hash, in input order, as above.
+ *
+ * With several models or sizes, all models hash each key while it's in
+ * cache, and all sizes are counted in one pass. Records are sorted by the
+ * bit reversed hash, so keys sharing the low N bits are next to each other
+ * for every N, and neighbours with k common low bits collide in all sizes
+ * up to k. So a histogram of common bits of neighbours gives the count for
+ * every size. A key seen again is skipped, as in a single pass, if it's the
+ * first key of its hash, i.e. for sizes above the most common bits its first
+ * occurrence has with any key before it.
  *
  * The expected number of collisions is (NSAMP * (NSAMP-1) / 2) / 2^CRCBITS.
  *
@@ -42,45 +74,127 @@
 
 #include <stdio.h>  // for: stdout, printf, etc.
 #include <stdlib.h> // for: exit
-#include <string.h> // for: strlen
-//#include 
+#include <string.h> // for: memcmp
+#include <time.h>   // for: clock_gettime
+#include <fcntl.h>  // for: open
+#include <unistd.h> // for: read, sysconf
+#include <pthread.h>    // for: pthread_create
+#include <sys/mman.h>   // for: mmap
+#include <sys/stat.h>   // for: fstat
+/* user headers */
+#include "crc_utils.h"
+
+#define PARTBITS    10
+#define PARTNUM     (1 << PARTBITS)
+#define READSIZE    (4 * 1024 * 1024)
+#define EMPTY       (~(uint64_t)0)
+#define SORTBITS    11
+#define MERGESIZE   (8 * 1024 * 1024)
+#define MERGEFAN    256
+#define MAXMODELS   8
 
-typedef unsigned int hint_t;    /* we want a 32 bit unsigned integer here */
+typedef struct Rec {
+    uint64_t    r_Hv;   /* hash */
+    uint64_t    r_Off;  /* key offset in input */
+} Rec;
 
-typedef struct hash_t {
-    hint_t  h1;
-    hint_t  h2;
-} hash_t;
+typedef struct Part {
+    Rec     *pa_Rec;
+    size_t  pa_Num;
+    size_t  pa_Max;
+} Part;
 
-typedef struct Hash {
-    struct Hash *ha_Next;
-    hash_t  ha_Hv;
-} Hash;
+typedef struct Flush {
+    pthread_t   f_Tid;
+    Rec         *f_Buf;     /* sorted records to write */
+    size_t      f_Num;
+    int         f_Busy;
+} Flush;
 
-#define TESTHSIZE   (4 * 1024 * 1024)
-#define TESTHMASK   (TESTHSIZE - 1)
+typedef struct Run {
+    uint64_t    ru_Base;    /* file offset of run in RunFd */
+    uint64_t    ru_Pos;     /* records read */
+    uint64_t    ru_Size;    /* records */
+    Rec         *ru_Buf;    /* records read ahead */
+    size_t      ru_Num;
+    size_t      ru_Idx;
+} Run;
 
-void inithash(void);
-hash_t testhash(const char *p);
+typedef struct Worker {
+    pthread_t   w_Tid;
+    const char  *w_Beg;     /* input slice */
+    const char  *w_End;
+    Part        *w_Part;    /* PARTNUM per model */
+    Rec         *w_Tab;     /* open addressing table of the partition checked */
+    size_t      w_TabSize;
+    uint64_t    w_Count;
+    uint64_t    w_Total;
+    Rec         *w_Buf[2];  /* run buffers of -d, one filled, one written */
+    Rec         *w_Tmp;
+    size_t      w_Num;
+    int         w_Cur;
+    Flush       w_Flush[2];
+    /* per model counts of a sweep over several models or sizes */
+    uint64_t    w_Keys[MAXMODELS];
+    uint64_t    w_Dups[MAXMODELS][65];  /* keys seen again by first() bits */
+    uint64_t    w_Parts[MAXMODELS];     /* partitions not empty */
+    uint64_t    w_Hist[MAXMODELS][65];  /* neighbours by common low bits */
+} Worker;
 
-Hash    *HashAry[TESTHSIZE];
-int     UniqueOpt;
-int     HashLimit = 64;
-int     VerboseOpt = 0;
-int     QuietOpt = 0;
-void    *rmalloc(int bytes);
+const char  *Input;
+size_t      InputLen;
+crc_model_t Model;
+uint64_t    HashMask;
+int         HashLimit = 64;
+int         HashLow = 64;   /* size range HashLow...HashLimit */
+crc_model_t Models[MAXMODELS];
+const char  *ModelName[MAXMODELS];
+int         ModelWidth[MAXMODELS];
+int         NModels;
+int         UniqueOpt;
+int         VerboseOpt = 0;
+int         QuietOpt = 0;
+int         NThreads;
+Worker      *Workers;
+const char  *RunDir;
+size_t      RunMax;     /* records per run buffer */
+int         RunFd = -1; /* unlinked file of all runs */
+uint64_t    RunEnd;     /* its size */
+Run         *Runs;
+int         NRuns;
+unsigned char   IsSep[256];
+volatile long   NextPart;
+pthread_mutex_t OutLock = PTHREAD_MUTEX_INITIALIZER;
+
+int runfile(void);
+int loadinput(const char *name);
+void *hashslice(void *arg);
+void *checkparts(void *arg);
+void *hashruns(void *arg);
+void mergeruns(uint64_t *count, uint64_t *total);
+void *hashsweep(void *arg);
+void *checksweep(void *arg);
+void reportsweep(void);
+int runworkers(void *(*fn)(void *));
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
 
 int main(int ac, char **av) {
-    char buf[256];
-    int count = 0;
-    int total = 0;
-    int skip = 100000;
-    int i;
+    const char *model, *file = NULL;
+    uint64_t count = 0, total = 0, keys = 0;
+    size_t mem = 1024;
+    double t, expect;
+    int i, k;
 
+    NThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
     for (i = 1; i < ac; ++i) {
         char *p = av[i];
 
-        if (*p == '-') {
+        if (*p == '-' && p[1]) {
             p += 2;
             switch(p[-1]) {
             case 'u':
@@ -88,15 +202,36 @@ int main(int ac, char **av) {
                 break;
             case 'h':
                 /*
-                 * We can't go above 64 for obvious reasons. We can't go
-                 * below 16 due to the way I generate the polynomial.
+                 * We can't go above 64 for obvious reasons, nor below 16,
+                 * for partitions take the top PARTBITS bits.
                  */
-                HashLimit = strtol(p, NULL, 0);
-                if (HashLimit > 64 || HashLimit < 16) {
+                HashLow = HashLimit = strtol(p, &p, 0);
+                if (*p == '-')
+                    HashLimit = strtol(p + 1, NULL, 0);
+                if (HashLimit > 64 || HashLow < 16 || HashLow > HashLimit) {
                     printf("valid values for -h between 16 & 64 inclusive\n");
                     exit(1);
                 }
                 break;
+            case 'm':
+                p = (*p || i + 1 == ac) ? p : av[++i];
+                for (p = strtok(p, ","); p; p = strtok(NULL, ",")) {
+                    if (NModels == MAXMODELS) {
+                        fprintf(stderr, "At most %d models\n", MAXMODELS);
+                        exit(1);
+                    }
+                    ModelName[NModels++] = p;
+                }
+                break;
+            case 't':
+                NThreads = strtol((*p || i + 1 == ac) ? p : av[++i], NULL, 0);
+                break;
+            case 'd':
+                RunDir = (*p || i + 1 == ac) ? p : av[++i];
+                break;
+            case 'M':
+                mem = strtoul(p, NULL, 0);
+                break;
             case 'q':
                 QuietOpt = 1;
                 break;
@@ -108,168 +243,841 @@ int main(int ac, char **av) {
                 exit(1);
             }
         }
+        else {
+            file = p;
+        }
+    }
+    if (NModels == 0)
+        ModelName[NModels++] = "CRC-64/XZ";
+    for (i = 0; i < NModels; ++i) {
+        if (NULL == (Models[i] = crc_util_model_get(ModelName[i]))) {
+            fprintf(stderr, "Unknown crc model: %s\n", ModelName[i]);
+            exit(1);
+        }
+        ModelWidth[i] = crc_util_model_param(ModelName[i])->width;
+        if (HashLow > ModelWidth[i] || (NModels == 1 && HashLimit > ModelWidth[i])) {
+            fprintf(stderr, "-h%d is wider than %s\n", (NModels == 1) ? HashLimit : HashLow, ModelName[i]);
+            exit(1);
+        }
+    }
+    Model = Models[0];
+    model = ModelName[0];
+    if (RunDir && (NModels > 1 || HashLow < HashLimit)) {
+        fprintf(stderr, "-d takes one model and size\n");
+        exit(1);
+    }
+    HashMask = (~(uint64_t)0) >> (64 - HashLimit);
+    if (NThreads < 1) NThreads = 1;
+    if (NULL == (Workers = calloc(NThreads, sizeof(Worker)))) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < NThreads; ++i) {
+        if (NULL == (Workers[i].w_Part = calloc(NModels * PARTNUM, sizeof(Part)))) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    for (i = 0; i < 6; ++i) IsSep[(unsigned char)" ,\t\r\n"[i]] = 1;
+    if (loadinput(file)) {
+        perror(file ? file : "stdin");
+        exit(1);
     }
 
-    inithash();
-
-    while (fgets(buf, sizeof(buf), stdin) != NULL) {
-        int i;
-        hash_t hv;
-        Hash *h;
-        char *s;
-
-        for (s = strtok(buf, " ,\t\r\n"); s; s = strtok(NULL, " ,\t\r\n")) {
-            hv = testhash(s);
-            i = (hv.h1 ^ hv.h2) & TESTHMASK;
-            /* printf("%08x.%08x (%d) %s\n", hv.h1, hv.h2, i, s); */
-            for (h = HashAry[i]; h; h = h->ha_Next) {
-                if (h->ha_Hv.h1 == hv.h1 && h->ha_Hv.h2 == hv.h2) {
-                    if (UniqueOpt || strcmp(s, (char *)(h + 1)) != 0) {
-                        if (VerboseOpt) {
-                            printf("Collision: %s\t%s\n", s,
-                                ((UniqueOpt) ? "?" : (char *)(h + 1)));
-                        }
-                        ++count;
-                        ++total;
-                    }
+    /*
+     * Slice the input at key boundaries, a key crossing a slice border
+     * belongs to the slice it starts in.
+     */
+    for (i = 0; i < NThreads; ++i) {
+        const char *b = Input + InputLen / NThreads * i;
+        if (i) {
+            while (b < Input + InputLen && !IsSep[(unsigned char)*b]) ++b;
+            Workers[i - 1].w_End = b;
+        }
+        Workers[i].w_Beg = b;
+    }
+    Workers[NThreads - 1].w_End = Input + InputLen;
+
+    t = now();
+    if (RunDir) {
+        /* two buffers to fill and write and one to sort into per thread */
+        RunMax = (mem << 20) / (3 * sizeof(Rec) * NThreads);
+        if (RunMax < 1024) RunMax = 1024;
+        RunFd = runfile();
+        if (runworkers(hashruns)) exit(1);
+        if (QuietOpt == 0) {
+            printf("Hashed into %d runs in %.3fs\n", NRuns, now() - t);
+            fflush(stdout);
+        }
+        t = now();
+        mergeruns(&count, &total);
+        if (QuietOpt == 0) printf("Merged in %.3fs\n", now() - t);
+        goto report;
+    }
+    if (NModels > 1 || HashLow < HashLimit) {
+        if (runworkers(hashsweep)) exit(1);
+        if (QuietOpt == 0) {
+            printf("Hashed with %d models in %.3fs\n", NModels, now() - t);
+            fflush(stdout);
+        }
+        t = now();
+        if (runworkers(checksweep)) exit(1);
+        if (QuietOpt == 0) printf("Checked in %.3fs\n", now() - t);
+        reportsweep();
+        return(0);
+    }
+    if (runworkers(hashslice)) exit(1);
+    for (i = 0; i < NThreads; ++i) {
+        for (k = 0; k < PARTNUM; ++k) keys += Workers[i].w_Part[k].pa_Num;
+    }
+    if (QuietOpt == 0) {
+        printf("Hashed %" PRIu64 " keys in %.3fs\n", keys, now() - t);
+        fflush(stdout);
+    }
+    t = now();
+    if (runworkers(checkparts)) exit(1);
+    for (i = 0; i < NThreads; ++i) {
+        count += Workers[i].w_Count;
+        total += Workers[i].w_Total;
+    }
+    if (QuietOpt == 0) printf("Checked in %.3fs\n", now() - t);
+report:
+    printf("Count %" PRIu64 "/%" PRIu64 "\n", count, total);
+    expect = (double)total * (double)(total - 1) / 2 / ((double)HashMask + 1);
+    printf("Expected %.3g (%s, %d bits)\n", total ? expect : 0.0, model, HashLimit);
+    return(0);
+}
+
+/*
+ * runfile() - new unlinked file in RunDir.
+ */
+
+int runfile(void) {
+    char path[4096];
+    int fd;
+
+    snprintf(path, sizeof(path), "%s/crc_collision.XXXXXX", RunDir);
+    if ((fd = mkstemp(path)) < 0) {
+        perror(path);
+        exit(1);
+    }
+    unlink(path);
+    return(fd);
+}
+
+/*
+ * writeall() - write 'len' bytes at file offset 'off'.
+ */
+
+static void writeall(int fd, const void *buf, size_t len, uint64_t off) {
+    const char *p = buf;
+    ssize_t n;
+
+    for (; len; p += n, len -= (size_t)n) {
+        if ((n = pwrite(fd, p, len, (off_t)(off + (p - (const char *)buf)))) < 0) {
+            perror(RunDir);
+            exit(1);
+        }
+    }
+}
+
+/*
+ * loadinput() - map regular file, else read it through into memory, or
+ *               into a file of RunDir with -d, which is mapped then.
+ */
+
+int loadinput(const char *name) {
+    int fd = name ? open(name, O_RDONLY) : 0;
+    struct stat st;
+    char *buf = NULL, *nbuf;
+    size_t max = 0;
+    ssize_t n;
+
+    if (fd < 0)
+        return(-1);
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        buf = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (buf != MAP_FAILED) {
+            madvise(buf, (size_t)st.st_size, MADV_WILLNEED);
+            Input = buf;
+            InputLen = (size_t)st.st_size;
+            return(0);
+        }
+        buf = NULL;
+    }
+    if (RunDir) {
+        int sfd = runfile();
+
+        if (NULL == (buf = malloc(READSIZE)))
+            return(-1);
+        while ((n = read(fd, buf, READSIZE)) > 0) {
+            writeall(sfd, buf, (size_t)n, InputLen);
+            InputLen += (size_t)n;
+        }
+        free(buf);
+        buf = (n < 0 || InputLen == 0) ? NULL : mmap(NULL, InputLen, PROT_READ, MAP_PRIVATE, sfd, 0);
+        close(sfd);
+        if (n < 0 || buf == MAP_FAILED)
+            return(-1);
+        Input = buf ? buf : "";
+        return(0);
+    }
+    for (;;) {
+        if (InputLen == max) {
+            max += (max < READSIZE) ? READSIZE : max;
+            if (NULL == (nbuf = realloc(buf, max)))
+                return(free(buf), -1);
+            buf = nbuf;
+        }
+        if ((n = read(fd, buf + InputLen, max - InputLen)) <= 0)
+            break;
+        InputLen += (size_t)n;
+    }
+    Input = buf;
+    return(n < 0) ? -1 : 0;
+}
+
+int runworkers(void *(*fn)(void *)) {
+    int i;
+
+    for (i = 1; i < NThreads; ++i) {
+        if (pthread_create(&Workers[i].w_Tid, NULL, fn, &Workers[i])) {
+            fprintf(stderr, "Can't create thread %d\n", i);
+            return(-1);
+        }
+    }
+    fn(&Workers[0]);
+    for (i = 1; i < NThreads; ++i)
+        pthread_join(Workers[i].w_Tid, NULL);
+    return(0);
+}
+
+/*
+ * nextkey() - find next key in [*pp, end) and return it, with *pp past its
+ *             end, or NULL if none.
+ */
+
+static __inline const char *nextkey(const char **pp, const char *end) {
+    const char *p = *pp, *s;
+
+    while (p < end && IsSep[(unsigned char)*p])
+        ++p;
+    if (p == end)
+        return(NULL);
+    for (s = p; p < end && !IsSep[(unsigned char)*p]; ++p)
+        ;
+    *pp = p;
+    return(s);
+}
+
+/*
+ * hashslice() - hash each key of the slice, and append it to the
+ *               partition of its top hash bits.
+ */
+
+void *hashslice(void *arg) {
+    Worker *w = arg;
+    const char *p = w->w_Beg, *s;
+    uint64_t hv;
+    Part *pa;
+
+    while ((s = nextkey(&p, w->w_End)) != NULL) {
+        hv = crc_util_model_run(Model, (const uint8_t *)s, (size_t)(p - s)) & HashMask;
+        pa = &w->w_Part[hv >> (HashLimit - PARTBITS)];
+        if (pa->pa_Num == pa->pa_Max) {
+            size_t max = pa->pa_Max ? pa->pa_Max * 2 : 1024;
+            Rec *rec = realloc(pa->pa_Rec, max * sizeof(Rec));
+            if (NULL == rec) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            pa->pa_Rec = rec;
+            pa->pa_Max = max;
+        }
+        pa->pa_Rec[pa->pa_Num].r_Hv = hv;
+        pa->pa_Rec[pa->pa_Num].r_Off = (uint64_t)(s - Input);
+        ++pa->pa_Num;
+    }
+    return(NULL);
+}
+
+/*
+ * keylen() - length of key at offset 'off' of input.
+ */
+
+static size_t keylen(uint64_t off) {
+    const char *p = Input + off, *e = Input + InputLen;
+
+    while (p < e && !IsSep[(unsigned char)*p])
+        ++p;
+    return(p - (Input + off));
+}
+
+/*
+ * samekey() - keys at offsets 'o1' and 'o2' are the same.
+ */
+
+static int samekey(uint64_t o1, uint64_t o2) {
+    size_t l1 = keylen(o1);
+
+    return(l1 == keylen(o2) && memcmp(Input + o1, Input + o2, l1) == 0);
+}
+
+/*
+ * collide() - key at offset 'o1' has hash 'hv' of the first key at 'o2'.
+ *             Return 1 if it counts as a collision, 0 if the same key.
+ */
+
+static int collide(uint64_t hv, uint64_t o1, uint64_t o2) {
+    size_t l1 = keylen(o1), l2 = keylen(o2);
+
+    if (!UniqueOpt && samekey(o1, o2))
+        return(0);
+    if (VerboseOpt) {
+        pthread_mutex_lock(&OutLock);
+        if (RunDir && UniqueOpt)    /* runs without key offsets */
+            printf("Collision: %0*" PRIX64 "\n", (HashLimit + 3) / 4, hv);
+        else
+            printf("Collision: %.*s\t%.*s\n", (int)l1, Input + o1, (int)l2, Input + o2);
+        pthread_mutex_unlock(&OutLock);
+    }
+    return(1);
+}
+
+/*
+ * checkpart() - check records of partition 'k' of all workers in input
+ *               order. The first key of a hash goes to the table, others
+ *               of the same hash count as collisions, unless the same key.
+ */
+
+static void checkpart(Worker *w, int k) {
+    size_t i, n = 0, size, mask;
+    int j;
+
+    for (j = 0; j < NThreads; ++j)
+        n += Workers[j].w_Part[k].pa_Num;
+    for (size = 16; size < 2 * n; size <<= 1)
+        ;
+    if (size > w->w_TabSize) {
+        free(w->w_Tab);
+        if (NULL == (w->w_Tab = malloc(size * sizeof(Rec)))) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        w->w_TabSize = size;
+    }
+    memset(w->w_Tab, 0xff, size * sizeof(Rec));
+    mask = size - 1;
+
+    for (j = 0; j < NThreads; ++j) {
+        Part *pa = &Workers[j].w_Part[k];
+        for (i = 0; i < pa->pa_Num; ++i) {
+            const Rec *r = &pa->pa_Rec[i];
+            Rec *h;
+
+            for (h = &w->w_Tab[r->r_Hv & mask]; h->r_Off != EMPTY; h = &w->w_Tab[(h - w->w_Tab + 1) & mask]) {
+                if (h->r_Hv == r->r_Hv)
                     break;
-                }
             }
-            if (h == NULL) {
-                h = rmalloc(sizeof(Hash) + ((UniqueOpt) ? 0 : strlen(s) + 1));
-                h->ha_Next = HashAry[i];
-                h->ha_Hv = hv;
-                if (UniqueOpt == 0)
-                    strcpy((char *)(h + 1), s);
-                HashAry[i] = h;
-                ++total;
+            if (h->r_Off == EMPTY) {
+                *h = *r;
+                ++w->w_Total;
+                continue;
             }
-        }
-        if (total >= skip) {
-            if (QuietOpt == 0) {
-                printf("Count %d/%d\n", count, total);
-                fflush(stdout);
+            if (collide(r->r_Hv, r->r_Off, h->r_Off)) {
+                ++w->w_Count;
+                ++w->w_Total;
             }
-            skip += 100000;
         }
+        free(pa->pa_Rec);
+        pa->pa_Rec = NULL;
     }
-    printf("Count %d/%d\n", count, total);
-    return(0);
+}
+
+void *checkparts(void *arg) {
+    Worker *w = arg;
+    long k;
+
+    while ((k = __sync_fetch_and_add(&NextPart, 1)) < PARTNUM)
+        checkpart(w, (int)k);
+    free(w->w_Tab);
+    w->w_Tab = NULL;
+    return(NULL);
 }
 
 /*
- * Poly: 0x00600340.00F0D50A
- *
+ * sortrun() - LSD radix sort of 'n' records by bits [lo, hi) of hash,
+ *             stable, so records of one hash stay in input order. Return
+ *             a or tmp, whichever holds the result.
+ */
+
+static Rec *sortrun(Rec *a, Rec *tmp, size_t n, int lo, int hi) {
+    size_t cnt[1 << SORTBITS], i, sum, c;
+    int shift, d;
+    Rec *x;
+
+    for (shift = lo; shift < hi; shift += SORTBITS) {
+        memset(cnt, 0, sizeof(cnt));
+        for (i = 0; i < n; ++i)
+            ++cnt[(a[i].r_Hv >> shift) & ((1 << SORTBITS) - 1)];
+        for (sum = 0, d = 0; d < (1 << SORTBITS); ++d) {
+            c = cnt[d];
+            cnt[d] = sum;
+            sum += c;
+        }
+        for (i = 0; i < n; ++i)
+            tmp[cnt[(a[i].r_Hv >> shift) & ((1 << SORTBITS) - 1)]++] = a[i];
+        x = a, a = tmp, tmp = x;
+    }
+    return(a);
+}
+
+/*
+ * putrecs() - write 'n' records to run file 'fd' at offset 'off', hashes
+ *             only with -u (packed in place). Return bytes written.
+ */
+
+static size_t putrecs(int fd, Rec *buf, size_t n, uint64_t off) {
+    size_t i, len = n * (UniqueOpt ? sizeof(uint64_t) : sizeof(Rec));
+
+    if (UniqueOpt) {
+        uint64_t *hv = (uint64_t *)buf;
+        for (i = 0; i < n; ++i)
+            hv[i] = buf[i].r_Hv;
+    }
+    writeall(fd, buf, len, off);
+    return(len);
+}
+
+/*
+ * writerun() - append sorted records to the run file as a new run.
+ */
+
+static void *writerun(void *arg) {
+    Flush *f = arg;
+    uint64_t base;
+
+    pthread_mutex_lock(&OutLock);
+    if (NULL == (Runs = realloc(Runs, (NRuns + 1) * sizeof(Run)))) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    base = RunEnd;
+    RunEnd += f->f_Num * (UniqueOpt ? sizeof(uint64_t) : sizeof(Rec));
+    memset(&Runs[NRuns], 0, sizeof(Run));
+    Runs[NRuns].ru_Base = base;
+    Runs[NRuns].ru_Size = f->f_Num;
+    ++NRuns;
+    pthread_mutex_unlock(&OutLock);
+    /* room reserved, write outside the lock */
+    putrecs(RunFd, f->f_Buf, f->f_Num, base);
+    return(NULL);
+}
+
+/*
+ * flushrun() - sort the buffer filled and write it in the background, then
+ *              go on with the other one, once its last write is done.
  */
 
-#define HINIT1  0xFAC432B1UL
-#define HINIT2  0x0CD5E44AUL
+static void flushrun(Worker *w) {
+    Flush *f = &w->w_Flush[w->w_Cur];
+    Rec *sorted = sortrun(w->w_Buf[w->w_Cur], w->w_Tmp, w->w_Num, 0, HashLimit);
 
-#define POLY1   0x00600340UL
-#define POLY2   0x00F0D50BUL
+    if (sorted == w->w_Tmp) {
+        w->w_Tmp = w->w_Buf[w->w_Cur];
+        w->w_Buf[w->w_Cur] = sorted;
+    }
+    f->f_Buf = sorted;
+    f->f_Num = w->w_Num;
+    if (pthread_create(&f->f_Tid, NULL, writerun, f)) {
+        fprintf(stderr, "Can't create writer thread\n");
+        exit(1);
+    }
+    f->f_Busy = 1;
+    w->w_Cur ^= 1;
+    w->w_Num = 0;
+    f = &w->w_Flush[w->w_Cur];
+    if (f->f_Busy) {
+        pthread_join(f->f_Tid, NULL);
+        f->f_Busy = 0;
+    }
+}
 
-hash_t CrcXor[256];
-hash_t Poly[64+1];
+/*
+ * hashruns() - hash each key of the slice into sorted run files.
+ */
 
-void inithash(void) {
+void *hashruns(void *arg) {
+    Worker *w = arg;
+    const char *p = w->w_Beg, *s;
     int i;
 
-    /*
-     * Polynomials to use for various crc sizes.  Start with the 64 bit
-     * polynomial and shift it right to generate the polynomials for fewer
-     * bits.  Note that the polynomial for N bits has no bit set above N-8.
-     * This allows us to do a simple table-driven CRC.
-     */
+    w->w_Buf[0] = malloc(RunMax * sizeof(Rec));
+    w->w_Buf[1] = malloc(RunMax * sizeof(Rec));
+    w->w_Tmp = malloc(RunMax * sizeof(Rec));
+    if (!w->w_Buf[0] || !w->w_Buf[1] || !w->w_Tmp) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    while ((s = nextkey(&p, w->w_End)) != NULL) {
+        Rec *r = &w->w_Buf[w->w_Cur][w->w_Num];
+        r->r_Hv = crc_util_model_run(Model, (const uint8_t *)s, (size_t)(p - s)) & HashMask;
+        r->r_Off = (uint64_t)(s - Input);
+        if (++w->w_Num == RunMax)
+            flushrun(w);
+    }
+    if (w->w_Num)
+        flushrun(w);
+    for (i = 0; i < 2; ++i) {
+        if (w->w_Flush[i].f_Busy)
+            pthread_join(w->w_Flush[i].f_Tid, NULL);
+        free(w->w_Buf[i]);
+    }
+    free(w->w_Tmp);
+    return(NULL);
+}
+
+/*
+ * runnext() - current record of run, read ahead from the run file if
+ *             needed. NULL at its end.
+ */
+
+static Rec *runnext(Run *ru, size_t max) {
+    size_t i, size = UniqueOpt ? sizeof(uint64_t) : sizeof(Rec), len;
+    uint64_t off;
+    ssize_t n;
+    char *p;
+
+    if (ru->ru_Idx < ru->ru_Num)
+        return(&ru->ru_Buf[ru->ru_Idx]);
+    if (ru->ru_Pos == ru->ru_Size)
+        return(NULL);
+    ru->ru_Num = (ru->ru_Size - ru->ru_Pos < max) ? (size_t)(ru->ru_Size - ru->ru_Pos) : max;
+    ru->ru_Idx = 0;
+    off = ru->ru_Base + ru->ru_Pos * size;
+    for (p = (char *)ru->ru_Buf, len = ru->ru_Num * size; len; p += n, len -= (size_t)n) {
+        if ((n = pread(RunFd, p, len, (off_t)(off + (p - (char *)ru->ru_Buf)))) <= 0) {
+            perror(RunDir);
+            exit(1);
+        }
+    }
+    ru->ru_Pos += ru->ru_Num;
+    /* have the kernel read the next chunk while this one is merged */
+    if (ru->ru_Pos < ru->ru_Size)
+        posix_fadvise(RunFd, (off_t)(off + ru->ru_Num * size), (off_t)(max * size), POSIX_FADV_WILLNEED);
+    if (UniqueOpt) {
+        /* widen hashes to records, from the back */
+        const uint64_t *hv = (const uint64_t *)ru->ru_Buf;
+        for (i = ru->ru_Num; i--; ) {
+            ru->ru_Buf[i].r_Hv = hv[i];
+            ru->ru_Buf[i].r_Off = 0;
+        }
+    }
+    return(&ru->ru_Buf[0]);
+}
 
-    Poly[64].h1 = POLY1;
-    Poly[64].h2 = POLY2;
-    for (i = 63; i >= 16; --i) {
-        Poly[i].h1 = Poly[i+1].h1 >> 1;
-        Poly[i].h2 = (Poly[i+1].h2 >> 1) | ((Poly[i+1].h1 & 1) << 31) | 1;
-    }
-
-    for (i = 0; i < 256; ++i) {
-        int j;
-        int v = i;
-        hash_t hv = { 0, 0 };
-
-        for (j = 0; j < 8; ++j, (v <<= 1)) {
-            hv.h1 <<= 1;
-            if (hv.h2 & 0x80000000UL)
-                hv.h1 |= 1;
-            hv.h2 = (hv.h2 << 1);
-            if (v & 0x80) {
-                hv.h1 ^= Poly[HashLimit].h1;
-                hv.h2 ^= Poly[HashLimit].h2;
+/* run 'a' goes before run 'b': by hash, then input order */
+static __inline int runless(const Run *a, const Run *b) {
+    const Rec *x = &a->ru_Buf[a->ru_Idx], *y = &b->ru_Buf[b->ru_Idx];
+
+    return(x->r_Hv < y->r_Hv || (x->r_Hv == y->r_Hv && x->r_Off < y->r_Off));
+}
+
+static void heapdown(Run **heap, int n, int i) {
+    Run *x = heap[i];
+    int c;
+
+    for (; (c = 2 * i + 1) < n; i = c) {
+        if (c + 1 < n && runless(heap[c + 1], heap[c]))
+            ++c;
+        if (!runless(heap[c], x))
+            break;
+        heap[i] = heap[c];
+    }
+    heap[i] = x;
+}
+
+/*
+ * mergegroup() - k-way merge of the 'nr' runs at 'ru', with read-ahead
+ *                buffers of 'max' records at 'buf'. With 'out', records go
+ *                to run file 'fd' at *end through buffer 'out', else the
+ *                first key of each hash counts as a key and the others are
+ *                checked against it. Return the number of records.
+ */
+
+static uint64_t mergegroup(Run *ru, int nr, Rec *buf, size_t max, Rec *out, int fd, uint64_t *end,
+                           uint64_t *count, uint64_t *total) {
+    Run *heap[MERGEFAN];
+    uint64_t hv = 0, off = 0, num = 0;
+    size_t k = 0;
+    int n = 0, i;
+    Rec *r;
+
+    for (i = 0; i < nr; ++i) {
+        ru[i].ru_Buf = buf + i * max;
+        if (runnext(&ru[i], max))
+            heap[n++] = &ru[i];
+    }
+    for (i = n / 2; i-- > 0; )
+        heapdown(heap, n, i);
+
+    for (; n; ++num) {
+        Run *h = heap[0];
+        r = &h->ru_Buf[h->ru_Idx];
+        if (out) {
+            out[k++] = *r;
+            if (k == max) {
+                *end += putrecs(fd, out, k, *end);
+                k = 0;
             }
         }
-        CrcXor[i] = hv;
+        else if (num == 0 || r->r_Hv != hv) {
+            hv = r->r_Hv;
+            off = r->r_Off;
+            ++*total;
+        }
+        else if (collide(hv, r->r_Off, off)) {
+            ++*count;
+            ++*total;
+        }
+        ++h->ru_Idx;
+        if (!runnext(h, max))
+            heap[0] = heap[--n];
+        heapdown(heap, n, 0);
     }
+    if (k)
+        *end += putrecs(fd, out, k, *end);
+    return(num);
 }
 
 /*
- * testhash() - do the CRC.  The complexity is simply due to the programmable
- *              nature of the number of bits.   We extract the top 8 bits to
- *              use as a table lookup to obtain the polynomial XOR 8 bits at
- *              a time rather then 1 bit at a time.
+ * mergeruns() - merge MERGEFAN runs at a time into a new run file, until
+ *               one pass over all of them is left, which counts.
  */
 
-hash_t testhash(const char *p) {
-    hash_t hv = { HINIT1, HINIT2 };
+void mergeruns(uint64_t *count, uint64_t *total) {
+    /* read ahead and output buffers share the memory of run buffers */
+    size_t max = RunMax * 3 * NThreads / (MERGEFAN + 1);
+    uint64_t end;
+    Run *runs;
+    Rec *buf;
+    int fd, n, i;
+
+    if (max > MERGESIZE / sizeof(Rec))
+        max = MERGESIZE / sizeof(Rec);
+    if (max < 1024)
+        max = 1024;
+    if (NULL == (buf = malloc((MERGEFAN + 1) * max * sizeof(Rec)))) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    while (NRuns > MERGEFAN) {
+        n = (NRuns + MERGEFAN - 1) / MERGEFAN;
+        if (NULL == (runs = calloc(n, sizeof(Run)))) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        posix_fadvise(RunFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        fd = runfile();
+        for (end = 0, i = 0; i < n; ++i) {
+            runs[i].ru_Base = end;
+            runs[i].ru_Size = mergegroup(Runs + i * MERGEFAN, (NRuns - i * MERGEFAN < MERGEFAN) ? NRuns - i * MERGEFAN : MERGEFAN,
+                buf, max, buf + MERGEFAN * max, fd, &end, NULL, NULL);
+        }
+        if (QuietOpt == 0) {
+            printf("Merged %d runs into %d\n", NRuns, n);
+            fflush(stdout);
+        }
+        close(RunFd);
+        free(Runs);
+        RunFd = fd;
+        Runs = runs;
+        NRuns = n;
+    }
+    posix_fadvise(RunFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    mergegroup(Runs, NRuns, buf, max, NULL, -1, NULL, count, total);
+    close(RunFd);
+    free(Runs);
+    free(buf);
+}
+
+/* bits of 'x' in reverse order */
+static __inline uint64_t rev64(uint64_t x) {
+    x = (x & 0x5555555555555555ULL) << 1 | ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) << 2 | ((x >> 2) & 0x3333333333333333ULL);
+    x = (x & 0x0F0F0F0F0F0F0F0FULL) << 4 | ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+    return(__builtin_bswap64(x));
+}
 
-    if (HashLimit <= 32) {
-        int s = HashLimit - 8;
-        hint_t m = (hint_t)-1 >> (32 - HashLimit);
+/*
+ * hashsweep() - hash each key of the slice with all models, and append the
+ *               bit reversed hash to the partition of its low hash bits.
+ */
 
-        hv.h1 = 0;
-        hv.h2 &= m;
+void *hashsweep(void *arg) {
+    Worker *w = arg;
+    const char *p = w->w_Beg, *s;
+    uint64_t hv;
+    Part *pa;
+    int j;
 
-        while (*p) {
-            int i = (hv.h2 >> s) & 255;
-            /* printf("i = %d %08lx\n", i, CrcXor[i].h2); */
-            hv.h2 = ((hv.h2 << 8) & m) ^ *p ^ CrcXor[i].h2;
-            ++p;
+    while ((s = nextkey(&p, w->w_End)) != NULL) {
+        for (j = 0; j < NModels; ++j) {
+            hv = rev64(crc_util_model_run(Models[j], (const uint8_t *)s, (size_t)(p - s)));
+            pa = &w->w_Part[j * PARTNUM + (hv >> (64 - PARTBITS))];
+            if (pa->pa_Num == pa->pa_Max) {
+                size_t max = pa->pa_Max ? pa->pa_Max * 2 : 1024;
+                Rec *rec = realloc(pa->pa_Rec, max * sizeof(Rec));
+                if (NULL == rec) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+                pa->pa_Rec = rec;
+                pa->pa_Max = max;
+            }
+            pa->pa_Rec[pa->pa_Num].r_Hv = hv;
+            pa->pa_Rec[pa->pa_Num].r_Off = (uint64_t)(s - Input);
+            ++pa->pa_Num;
         }
     }
-    else if (HashLimit < 32+8) {
-        int s2 = 32 + 8 - HashLimit;    /* bits in byte from h2 */
-        hint_t m = (hint_t)-1 >> (64 - HashLimit);
+    return(NULL);
+}
+
+/* common low hash bits of bit reversed hashes 'x' and 'y' */
+static __inline int common(uint64_t x, uint64_t y) {
+    return(x == y ? 64 : __builtin_clzll(x ^ y));
+}
+
+/*
+ * firstbits() - most common bits of each record of the sorted 'a' with any
+ *               record before it in input order, into 'bits'. Those are the
+ *               nearest ones before it on either side, found by a stack of
+ *               records in input order ('st', n entries).
+ */
+
+static void firstbits(const Rec *a, size_t n, uint64_t *st, uint8_t *bits) {
+    size_t i, top;
+
+    for (top = 0, i = 0; i < n; ++i) {
+        while (top && a[st[top - 1]].r_Off > a[i].r_Off)
+            --top;
+        bits[i] = top ? (uint8_t)common(a[st[top - 1]].r_Hv, a[i].r_Hv) : 0;
+        st[top++] = i;
+    }
+    for (top = 0, i = n; i-- > 0; ) {
+        while (top && a[st[top - 1]].r_Off > a[i].r_Off)
+            --top;
+        if (top && common(a[st[top - 1]].r_Hv, a[i].r_Hv) > bits[i])
+            bits[i] = (uint8_t)common(a[st[top - 1]].r_Hv, a[i].r_Hv);
+        st[top++] = i;
+    }
+}
+
+/*
+ * sweeppart() - sort partition 'k' of model 'j' and count its neighbours
+ *               by common low hash bits. Keys the same as the first of
+ *               their full hash are counted by its firstbits(), they don't
+ *               collide for sizes above.
+ */
+
+static void sweeppart(Worker *w, int j, int k) {
+    size_t i, g, n = 0;
+    uint8_t *bits = NULL;
+    Rec *a;
+    uint64_t x;
+    int t;
 
-        hv.h1 &= m;
-        while (*p) {
-            int i = ((hv.h1 << s2) | (hv.h2 >> (32 - s2))) & 255;
-            hv.h1 = (((hv.h1 << 8) ^ (int)(hv.h2 >> 24)) & m) ^ CrcXor[i].h1;
-            hv.h2 = (hv.h2 << 8) ^ *p ^ CrcXor[i].h2;
-            ++p;
+    for (t = 0; t < NThreads; ++t)
+        n += Workers[t].w_Part[j * PARTNUM + k].pa_Num;
+    if (n == 0)
+        return;
+    if (n > w->w_TabSize) {
+        free(w->w_Tab);
+        free(w->w_Tmp);
+        w->w_Tab = malloc(n * sizeof(Rec));
+        w->w_Tmp = malloc(n * sizeof(Rec));
+        if (!w->w_Tab || !w->w_Tmp) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
         }
+        w->w_TabSize = n;
+    }
+    for (n = 0, t = 0; t < NThreads; ++t) {
+        Part *pa = &Workers[t].w_Part[j * PARTNUM + k];
+        memcpy(w->w_Tab + n, pa->pa_Rec, pa->pa_Num * sizeof(Rec));
+        n += pa->pa_Num;
+        free(pa->pa_Rec);
+        pa->pa_Rec = NULL;
+    }
+    a = sortrun(w->w_Tab, w->w_Tmp, n, 64 - ModelWidth[j], 64 - PARTBITS);
+    if (!UniqueOpt) {
+        /* the other buffer is free, n stack entries and n bytes fit */
+        uint64_t *st = (uint64_t *)((a == w->w_Tab) ? w->w_Tmp : w->w_Tab);
+        bits = (uint8_t *)(st + n);
+        firstbits(a, n, st, bits);
     }
-    else {
-        int s = HashLimit - 40;
-        hint_t m = (hint_t)-1 >> (64 - HashLimit);
 
-        hv.h1 &= m;
-        while (*p) {
-            int i = (hv.h1 >> s) & 255;
-            hv.h1 = ((hv.h1 << 8) & m) ^ (int)(hv.h2 >> 24) ^ CrcXor[i].h1;
-            hv.h2 = (hv.h2 << 8) ^ *p ^ CrcXor[i].h2;
-            ++p;
+    for (g = 0, i = 1; i < n; ++i) {
+        if ((x = a[i].r_Hv ^ a[i - 1].r_Hv) != 0) {
+            ++w->w_Hist[j][__builtin_clzll(x)];
+            g = i;
+            continue;
         }
+        ++w->w_Hist[j][64];
+        /* records of a full hash are in input order, a[g] goes first */
+        if (bits && samekey(a[g].r_Off, a[i].r_Off))
+            ++w->w_Dups[j][bits[g]];
     }
-    /* printf("%08lx.%08lx\n", (long)hv.h1, (long)hv.h2); */
-    return(hv);
+    w->w_Keys[j] += n;
+    ++w->w_Parts[j];
+}
+
+void *checksweep(void *arg) {
+    Worker *w = arg;
+    long k;
+
+    while ((k = __sync_fetch_and_add(&NextPart, 1)) < (long)NModels * PARTNUM)
+        sweeppart(w, (int)(k / PARTNUM), (int)(k % PARTNUM));
+    free(w->w_Tab);
+    free(w->w_Tmp);
+    w->w_Tab = w->w_Tmp = NULL;
+    return(NULL);
 }
 
-void* rmalloc(int bytes) {
-    static char *RBuf = NULL;
-    static int  RSize = 0;
+/*
+ * reportsweep() - collisions for every model and size. Keys of N common
+ *                 low bits are one hash of N bits, so there are as many
+ *                 hashes as partitions plus neighbours of fewer common bits.
+ *                 Keys seen again are skipped at N bits if their first
+ *                 occurrence has fewer common bits with any key before it.
+ */
 
-    bytes = (bytes + 3) & ~3;
+void reportsweep(void) {
+    uint64_t keys, hashes, dups, total, hist[65], dhist[65];
+    double expect;
+    int i, j, c, w;
 
-    if (bytes > RSize) {
-        RBuf = malloc(65536);
-        RSize = 65536;
+    for (j = 0; j < NModels; ++j) {
+        keys = hashes = dups = 0;
+        memset(hist, 0, sizeof(hist));
+        memset(dhist, 0, sizeof(dhist));
+        for (i = 0; i < NThreads; ++i) {
+            keys += Workers[i].w_Keys[j];
+            hashes += Workers[i].w_Parts[j];
+            for (c = 0; c <= 64; ++c) {
+                hist[c] += Workers[i].w_Hist[j][c];
+                dhist[c] += Workers[i].w_Dups[j][c];
+            }
+        }
+        for (c = 0; c < HashLow; ++c) {
+            hashes += hist[c];
+            dups += dhist[c];
+        }
+        for (w = HashLow; w <= HashLimit && w <= ModelWidth[j]; hashes += hist[w], dups += dhist[w++]) {
+            total = keys - dups;
+            expect = (double)total * (double)(total - 1) / 2 / ((double)((~(uint64_t)0) >> (64 - w)) + 1);
+            printf("Count %" PRIu64 "/%" PRIu64 "\tExpected %.3g (%s, %d bits)\n",
+                total - hashes, total, total ? expect : 0.0, ModelName[j], w);
+        }
     }
-    RBuf += bytes;
-    RSize -= bytes;
-    return(RBuf - bytes);
-}
\ No newline at end of file
+}
@@ -0,0 +1,149 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit
+// @file:       crc_model.hpp
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+#ifndef _CRC_MODEL_HPP_
+#define _CRC_MODEL_HPP_
+
+// Header only compile time crc models (C++17), e.g.
+//   using crc16_modbus = crc::model<16, 0x8005, 0xFFFF, true, true, 0x0000>;
+//   crc_t crc = crc16_modbus::run(p, len);
+// The lookup table is built constexpr (so it ends up in .rodata) and the run
+// loop is specialized for the model, i.e. no branch on refin/refout/swapout
+// and no runtime reflect. Results are the same as crc_util_model_run.
+
+#include <array>    // for: std::array
+#include <cstddef>  // for: size_t
+/* user headers */
+#include "crc_utils.h"
+
+namespace crc {
+
+namespace detail {
+
+// Least register type for polynom order rounded up to whole bytes.
+template <unsigned Order> struct reg { using type = uint64_t; };
+template <> struct reg<8> { using type = uint8_t; };
+template <> struct reg<16> { using type = uint16_t; };
+template <> struct reg<24> { using type = uint32_t; };
+template <> struct reg<32> { using type = uint32_t; };
+
+constexpr crc_t mask(unsigned bits) {
+    return ((((crc_t)1 << (bits - 1)) - 1) << 1) | 1;
+}
+
+// Reflects the lower 'bitnum' bits of 'crc'
+constexpr crc_t reflect(crc_t crc, unsigned bitnum) {
+    crc_t crcout = 0;
+    for (unsigned i = 0; i < bitnum; i++) {
+        if (crc & ((crc_t)1 << i)) crcout |= (crc_t)1 << (bitnum - 1 - i);
+    }
+    return crcout;
+}
+
+// Byte table of crc_util_table_fast for polynom 'poly' left-aligned to 'order'.
+template <typename T, unsigned Order, crc_t Poly, bool RefIn>
+constexpr std::array<T, 256> table() {
+    std::array<T, 256> t{};
+    const crc_t high_bit = (crc_t)1 << (Order - 1);
+    for (unsigned i = 0; i < 256; i++) {
+        crc_t crc = RefIn ? reflect(i, 8) : i;
+        crc <<= Order - 8;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & high_bit) ? (crc << 1) ^ Poly : crc << 1;
+        }
+        if (RefIn) crc = reflect(crc, Order);
+        t[i] = (T)(crc & mask(Order));
+    }
+    return t;
+}
+
+} // namespace detail
+
+template <uint8_t Width, crc_t Poly, crc_t Init, bool RefIn, bool RefOut, crc_t XorOut,
+    bool SwapOut = false>
+class model {
+    static_assert(1 <= Width && Width <= 64, "invalid model param width");
+    static_assert(!SwapOut || 16 == Width, "invalid model param swapout");
+    static_assert(Poly == (Poly & detail::mask(Width)) && (Poly & 1), "invalid model param poly");
+    static_assert(Init == (Init & detail::mask(Width)), "invalid model param init");
+    static_assert(XorOut == (XorOut & detail::mask(Width)), "invalid model param xorout");
+
+public:
+    static constexpr unsigned order = (Width + 7) & ~7u;
+    static constexpr unsigned shift = order - Width;
+    // raw register as in crc_util_xxx_update: reflected if refin
+    using reg_t = typename detail::reg<order>::type;
+    static constexpr std::array<reg_t, 256> table =
+        detail::table<reg_t, order, Poly << shift, RefIn>();
+
+    // Raw register of init value.
+    static constexpr reg_t begin() {
+        return (reg_t)(RefIn ? detail::reflect(Init, Width) : Init);
+    }
+
+    // Feed 'len' bytes (of char or uint8_t) through raw register.
+    template <typename T>
+    static constexpr reg_t update(reg_t crc, const T *p, size_t len) {
+        static_assert(1 == sizeof(T), "byte input only");
+        if constexpr (RefIn) {
+            for (size_t i = 0; i < len; i++) {
+                crc = (reg_t)((crc >> 8) ^ table[(crc & 0xff) ^ (uint8_t)p[i]]);
+            }
+            return crc;
+        }
+        else {
+            crc = (reg_t)(crc << shift);
+            for (size_t i = 0; i < len; i++) {
+                crc = (reg_t)((crc << 8) ^ table[((crc >> (order - 8)) & 0xff) ^ (uint8_t)p[i]]);
+            }
+            return (reg_t)(crc >> shift);
+        }
+    }
+
+    // Post processing of raw register: reflect, xorout and swapout.
+    static constexpr crc_t final(reg_t crc) {
+        crc_t c = crc;
+        if constexpr (RefIn != RefOut) c = detail::reflect(c, Width);
+        c = (c ^ XorOut) & detail::mask(Width);
+        if constexpr (SwapOut) c = (c & 0xff00) >> 8 | (c & 0x00ff) << 8;
+        return c;
+    }
+
+    template <typename T>
+    static constexpr crc_t run(const T *p, size_t len) {
+        return final(update(begin(), p, len));
+    }
+
+    // Output of "123456789".
+    static constexpr crc_t check() {
+        return run("123456789", 9);
+    }
+
+    // Same model for crc_util_model_init.
+    static constexpr crc_model_param_s param(const char *name = "") {
+        return { name, Width, RefIn, RefOut, SwapOut, Poly, Init, XorOut, check() };
+    }
+};
+
+// Some well known models, see crc_catalog.c for names.
+using crc16_modbus = model<16, 0x8005, 0xFFFF, true, true, 0x0000>;
+using crc16_x25 = model<16, 0x1021, 0xFFFF, true, true, 0xFFFF>;
+using crc16_xmodem = model<16, 0x1021, 0x0000, false, false, 0x0000>;
+using crc32 = model<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+using crc32c = model<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF>;
+using crc64_xz = model<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF>;
+
+static_assert(0x4B37 == crc16_modbus::check(), "CRC-16/MODBUS");
+static_assert(0x906E == crc16_x25::check(), "CRC-16/IBM-SDLC");
+static_assert(0x31C3 == crc16_xmodem::check(), "CRC-16/XMODEM");
+static_assert(0xCBF43926 == crc32::check(), "CRC-32/ISO-HDLC");
+static_assert(0xE3069283 == crc32c::check(), "CRC-32/ISCSI");
+static_assert(0x995DC9BBDF1939FA == crc64_xz::check(), "CRC-64/XZ");
+
+} // namespace crc
+
+#endif // !_CRC_MODEL_HPP_
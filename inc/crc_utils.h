@@ -10,14 +10,21 @@
 
 #include <stdint.h>     // need for: uint_xxx
 #include <inttypes.h>   // need for: PRIX32/64
+#include <stddef.h>     // need for: size_t
+#ifdef _MSC_VER
+// as POSIX <sys/uio.h>
+struct iovec {
+    void    *iov_base;
+    size_t  iov_len;
+};
+#else //! _MSC_VER
+#include <sys/uio.h>    // need for: struct iovec
+#endif /* _MSC_VER */
 
-#if defined(CRC64) || defined(_WIN64)
-#define CRC_F   "%"PRIX64
+// Widths up to 64 in every build, engines keep tables in 16/32/64-bit entries
+// by model width.
+#define CRC_F   "%" PRIX64
 typedef uint64_t crc_t;
-#else //! CRC64
-#define CRC_F   "%"PRIX32
-typedef uint32_t crc_t;
-#endif /* CRC64 */
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,13 +45,92 @@ extern "C" {
         crc_t       check;  // default output of "123456789"
     } crc_model_param_s;
 
+    /* crc engine (algorithm) of a model */
+    typedef enum _crc_engine_e {
+        CRC_ENGINE_AUTO = 0,    // best one for model, input length and cpu
+        CRC_ENGINE_BITBYBIT,    // bit by bit, no table
+        CRC_ENGINE_TABLE,       // 256-entry table, one byte per lookup
+        CRC_ENGINE_NIBBLE,      // 16-entry table, half byte per lookup
+        CRC_ENGINE_SLICE8,      // slicing-by-8
+        CRC_ENGINE_SLICE16,     // slicing-by-16
+        CRC_ENGINE_FOLD,        // carry-less multiply folding (x86 PCLMULQDQ)
+        CRC_ENGINE_CRC32C,      // crc32 instruction (x86 SSE4.2, Castagnoli only)
+    } crc_engine_e;
+
+    /* crc context for incremental (streaming) calculation */
+    typedef struct _crc_ctx_s {
+        crc_model_t model;
+        crc_t       crc;    // raw crc register, don't touch
+    } crc_ctx_s;
+
     /* -------------------- public  interface -------------------- */
 
     int crc_util_model_show(const crc_model_t model);
     crc_t crc_util_model_run(const crc_model_t model, const uint8_t *p, size_t len);
+    // Crc of n independent messages p[i] of len[i] bytes into out[i], several
+    // messages interleaved at once. 0 if ok, -1 on invalid parameter.
+    int crc_util_model_run_batch(const crc_model_t model, const uint8_t **p, const size_t *len, crc_t *out, size_t n);
+    // Same for n records of 'len' bytes, 'stride' bytes apart from p on.
+    int crc_util_model_run_stride(const crc_model_t model, const uint8_t *p, size_t len, size_t stride, crc_t *out, size_t n);
+    // crc of one message scattered over 'iovcnt' buffers, same as
+    // crc_util_model_run on their concatenation.
+    crc_t crc_util_model_runv(const crc_model_t model, const struct iovec *iov, int iovcnt);
+    // Copy 'len' bytes from src to dst (not overlapping) and return their crc,
+    // in one pass over src.
+    crc_t crc_util_model_copy_run(const crc_model_t model, void *dst, const void *src, size_t len);
+    // Append crc of frame[0, len) at frame + len (room for width / 8 bytes),
+    // low byte first for reflected models, as it goes on the wire. Return the
+    // frame length with crc, 0 if width is not whole bytes.
+    size_t crc_util_model_append(const crc_model_t model, uint8_t *frame, size_t len);
+    // 1 if frame[0, len), crc appended as above, is intact, i.e. its crc is the
+    // model residue, else 0.
+    int crc_util_model_verify(const crc_model_t model, const uint8_t *frame, size_t len);
+    // crc of A|B from crc1 of A and crc2 of B, len2 is the length of B.
+    crc_t crc_util_model_combine(const crc_model_t model, crc_t crc1, crc_t crc2, size_t len2);
+    // crc of a message followed by n zero bytes from crc of the message, in
+    // O(log n) time, e.g. for holes of sparse files.
+    crc_t crc_util_model_zeros(const crc_model_t model, crc_t crc, uint64_t n);
+    // crc of a buffer of 'total_len' bytes after the n bytes at 'offset' changed
+    // from old_bytes to new_bytes, from its crc before. Takes O(n + log total_len).
+    crc_t crc_util_model_update_region(const crc_model_t model, crc_t crc, size_t total_len, size_t offset,
+        const uint8_t *old_bytes, const uint8_t *new_bytes, size_t n);
+    // Same as crc_util_model_run, with input split over 'nthreads' threads
+    // (0: number of cpus) of a process-wide worker pool.
+    crc_t crc_util_model_run_parallel(const crc_model_t model, const uint8_t *p, size_t len, int nthreads);
 
     crc_model_t crc_util_model_init(crc_model_param_s param, void *data);
     int crc_util_model_fini(crc_model_t model);
+    // Pin model to one engine (CRC_ENGINE_AUTO to undo), -1 if not available
+    // or model is a shared one of crc_util_model_get.
+    int crc_util_model_engine(crc_model_t model, crc_engine_e engine);
+    // Engine name, e.g. "slice16", NULL past the last engine.
+    const char *crc_util_engine_name(crc_engine_e engine);
+    // Pick the fastest engine per input length class, [1, 4), [4, 16), ...,
+    // by a short calibration run (some 20 ms), or from file 'profile' if it has
+    // an entry for the model and cpu, else the new one is appended (NULL: no
+    // file). A pinned engine still takes precedence. Not for shared models.
+    int crc_util_model_tune(crc_model_t model, const char *profile);
+
+    // Incremental calculation: crc_util_final(begin, update(p1), update(p2), ...)
+    // equals crc_util_model_run on the concatenated input.
+    int crc_util_begin(crc_ctx_s *ctx, const crc_model_t model);
+    int crc_util_update(crc_ctx_s *ctx, const uint8_t *p, size_t len);
+    // Same as update on n zero bytes, in O(log n) time.
+    int crc_util_update_zeros(crc_ctx_s *ctx, uint64_t n);
+    crc_t crc_util_final(crc_ctx_s *ctx);
+
+    /* -------------------- model catalogue -------------------- */
+
+    // Find model parameters by name or alias (case insensitive), e.g. "CRC32C".
+    const crc_model_param_s *crc_util_model_param(const char *name);
+    // Catalogue entry 'index' (0, 1, ...), NULL past the end.
+    const crc_model_param_s *crc_util_model_param_at(size_t index);
+    // Shared ready-made model by name or alias, e.g. "CRC-16/MODBUS", with
+    // precomputed byte table: no allocation, no table generation. Slicing
+    // (and crc32c) tables are made once, by its first run of 16 bytes or more,
+    // till then it runs on the byte table. It lives for the whole process and
+    // can't be pinned or tuned, crc_util_model_fini on it does nothing.
+    crc_model_t crc_util_model_get(const char *name);
 
 #ifdef _DEBUG
     void crc_util_model_debug(const crc_model_t model, const uint8_t *p, size_t len);
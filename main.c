@@ -14,6 +14,8 @@
 
 const uint8_t str[] = "123456789";
 uint8_t str_crc[20] = "123456789";
+// random input of 1 MB and one byte, filled by main
+uint8_t str_big[(1 << 20) + 1];
 
 const crc_model_param_s crc16 = { "CRC16(IBM/ARC/LHA)",
 16, 1, 1, 0, 0x8005, 0x0000, 0x0000, 0xBB3D
@@ -71,6 +73,12 @@ const crc_model_param_s crc32 = { "CRC32",
 const crc_model_param_s crc32_r = { "CRC32",
 32, 0, 0, 0, 0xedb88320, 0xffffffff, 0xffffffff, 0xCBF43926
 };
+const crc_model_param_s crc64_ecma = { "CRC64-ECMA",
+64, 0, 0, 0, 0x42F0E1EBA9EA3693, 0x0000000000000000, 0x0000000000000000, 0x6C40DF5F0B497347
+};
+const crc_model_param_s crc64_xz = { "CRC64-XZ",
+64, 1, 1, 0, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x995DC9BBDF1939FA
+};
 
 void smoke_test(const crc_model_param_s param) {
     crc_model_t m = crc_util_model_init(param, NULL);
@@ -85,37 +93,103 @@ void smoke_test(const crc_model_param_s param) {
     size_t str_len = strlen((const char *)str);
     crc_util_model_debug(m, str, str_len);
 
-    // test3: check crc with raw data
-    crc_t crc = crc_util_model_run(m, str, str_len) ^ param.xorout;
-    size_t i, crc_len = param.width / 8;
-#if 0
-    printf("crc: 0x"CRC_F" 0x", crc);
-    for (i = 0; i < sizeof(crc); i++) {
-        printf("%02X", ((const uint8_t *)&crc)[i]);
+    // test3: append crc to frame, check frame against model residue (whole
+    // bytes of crc only)
+    crc_t crc;
+    size_t i, frame_len;
+    if (0 == (param.width & 7)) {
+        frame_len = crc_util_model_append(m, str_crc, str_len);
+        if (!crc_util_model_verify(m, str_crc, frame_len)) log_error("unexpected crc check error!\n");
+        str_crc[0] ^= 0x01;
+        if (crc_util_model_verify(m, str_crc, frame_len)) log_error("unexpected crc check pass!\n");
+        str_crc[0] ^= 0x01;
     }
-    printf("\n");
-#endif
-    // reset str with crc
-    memset(str_crc + str_len, 0x00, 20 - str_len);
-    // append crc value to str
-    const uint8_t *_crc = (const uint8_t *)&crc;
-    for (i = str_len; i < str_len + crc_len; i++) {
-        str_crc[i] = (param.refout ^ param.swapout) ?
-            _crc[i - str_len] : _crc[crc_len - i + str_len - 1];
+
+    // test4: incremental calculation in chunks
+    crc_ctx_s ctx;
+    crc_util_begin(&ctx, m);
+    for (i = 0; i < str_len; i += 2) {
+        crc_util_update(&ctx, str + i, (str_len - i < 2) ? str_len - i : 2);
     }
-    crc = crc_util_model_run(m, str_crc, str_len + crc_len);
-#if 0
-    printf("str with crc[%d]: 0x", (int)crc_len);
-    for (i = 0; i < str_len + crc_len; i++) {
-        printf("%02X", str_crc[i]);
+    if (crc_util_final(&ctx) != param.check) log_error("unexpected crc stream error!\n");
+
+    // test5: combine crc of two halves, then run of zeros
+    crc = crc_util_model_combine(m, crc_util_model_run(m, str, 4),
+        crc_util_model_run(m, str + 4, str_len - 4), str_len - 4);
+    if (crc != param.check) log_error("unexpected crc combine error!\n");
+    uint8_t zeros[16] = "123456789";
+    crc = crc_util_model_zeros(m, param.check, 16 - str_len);
+    if (crc != crc_util_model_run(m, zeros, 16)) log_error("unexpected crc zeros error!\n");
+
+    // test6: patch a region of the message
+    uint8_t patch[9];
+    memcpy(patch, "12ABC6789", 9);
+    crc = crc_util_model_update_region(m, crc_util_model_run(m, patch, 9), 9, 2, patch + 2, str + 2, 3);
+    if (crc != param.check) log_error("unexpected crc region error!\n");
+
+    // test7: batch of messages, then same size records
+    const uint8_t *batch_p[5] = { str, str, str, str, str };
+    size_t batch_len[5] = { str_len, str_len, str_len, str_len, str_len };
+    crc_t batch_crc[5];
+    crc_util_model_run_batch(m, batch_p, batch_len, batch_crc, 5);
+    for (i = 0; i < 5; i++) {
+        if (batch_crc[i] != param.check) log_error("unexpected crc batch error!\n");
+    }
+    crc_util_model_run_stride(m, str, str_len, 0, batch_crc, 5);
+    for (i = 0; i < 5; i++) {
+        if (batch_crc[i] != param.check) log_error("unexpected crc stride error!\n");
     }
-    printf(", check: 0x"CRC_F"\n", crc);
-#endif
-    if (crc != param.xorout) log_error("unexpected crc check error!\n");
+
+    // test8: scattered message
+    struct iovec iov[3] = { { (void *)str, 2 }, { (void *)(str + 2), 0 }, { (void *)(str + 2), str_len - 2 } };
+    if (crc_util_model_runv(m, iov, 3) != param.check) log_error("unexpected crc iovec error!\n");
+
+    // test9: copy while checking
+    uint8_t copy[20];
+    if (crc_util_model_copy_run(m, copy, str, str_len) != param.check || memcmp(copy, str, str_len)) {
+        log_error("unexpected crc copy error!\n");
+    }
+
+    // test10: engines tuned per input length
+    crc_util_model_tune(m, NULL);
+    if (crc_util_model_run(m, str, str_len) != param.check) log_error("unexpected crc tune error!\n");
+
+    // test11: split over threads, odd length
+    int threads[4] = { 1, 2, 3, 8 };
+    crc = crc_util_model_run(m, str_big, sizeof(str_big));
+    for (i = 0; i < 4; i++) {
+        if (crc_util_model_run_parallel(m, str_big, sizeof(str_big), threads[i]) != crc) {
+            log_error("unexpected crc parallel error: %d threads!\n", threads[i]);
+        }
+    }
+
+    // test12: every engine against bit by bit, on random input of some sizes
+    // (crc32c engine for Castagnoli only, merging 3 streams from 768 aligned
+    // bytes on and 3 long ones from 24K on, input + 3 takes 5 bytes to align)
+    size_t sizes[] = { 1, 15, 16, 63, 64, 65, 255, 772, 773, 1000, 4097, 24581 };
+    int castagnoli = 32 == param.width && 0x1EDC6F41 == param.poly && param.refin;
+    crc_engine_e e;
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        crc_util_model_engine(m, CRC_ENGINE_BITBYBIT);
+        crc = crc_util_model_run(m, str_big + 3, sizes[i]);
+        for (e = CRC_ENGINE_TABLE; crc_util_engine_name(e); e++) {
+            if ((CRC_ENGINE_CRC32C == e && !castagnoli) || crc_util_model_engine(m, e)) continue;
+            if (crc_util_model_run(m, str_big + 3, sizes[i]) != crc) {
+                log_error("unexpected crc engine error: %s, %lu bytes!\n", crc_util_engine_name(e), (unsigned long)sizes[i]);
+            }
+        }
+    }
+    crc_util_model_engine(m, CRC_ENGINE_AUTO);
     crc_util_model_fini(m);
 }
 
 int main(int argc, char *argv[]) {
+    uint32_t seed = 1;
+    size_t n;
+    for (n = 0; n < sizeof(str_big); n++) {
+        seed = seed * 1103515245 + 12345;
+        str_big[n] = (uint8_t)(seed >> 16);
+    }
     smoke_test(crc16);
     smoke_test(crc16_maxim);
     smoke_test(crc16_usb);
@@ -133,5 +207,24 @@ int main(int argc, char *argv[]) {
     smoke_test(crc16_x25);
     smoke_test(crc32);
     smoke_test(crc32_r);
+    smoke_test(*crc_util_model_param("CRC-32/BZIP2"));
+    smoke_test(crc64_ecma);
+    smoke_test(crc64_xz);
+    // built-in catalogue, runs on SSE4.2 crc32 instruction if available
+    smoke_test(*crc_util_model_param("CRC32C"));
+    // widths not a whole number of bytes (CRC-12/UMTS: refin != refout)
+    smoke_test(*crc_util_model_param("CRC-5/USB"));
+    smoke_test(*crc_util_model_param("CRC-12/UMTS"));
+    smoke_test(*crc_util_model_param("CRC-15/CAN"));
+    smoke_test(*crc_util_model_param("CRC-31/PHILIPS"));
+    // all catalogue models with precomputed tables
+    const crc_model_param_s *param;
+    size_t k;
+    for (k = 0; NULL != (param = crc_util_model_param_at(k)); k++) {
+        crc_model_t m = crc_util_model_get(param->name);
+        if (crc_util_model_run(m, str, strlen((const char *)str)) != param->check) {
+            log_error("unexpected crc check error: %s!\n", param->name);
+        }
+    }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,292 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: built-in crc model catalogue
+// @file:       crc_catalog.c
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+#include <stddef.h> // for: NULL
+#include <ctype.h>  // for: toupper
+/* user headers */
+#include "crc_utils.h"
+#include "crc_catalog.h"
+
+typedef struct _crc_catalog_s {
+    const char *alias;  // other names, separated by '|'
+    crc_model_param_s param;
+} crc_catalog_s;
+
+// Parameters as listed in "CRC RevEng" catalogue (widths up to 64), sorted by
+// width and name. Tables in crc_catalog_table.h follow the same order, so run
+// "make catalog" after any change here.
+static const crc_catalog_s crc_catalog[] = {
+    { NULL, { "CRC-3/GSM",
+    3, 0, 0, 0, 0x3, 0x0, 0x7, 0x4 } },
+    { NULL, { "CRC-3/ROHC",
+    3, 1, 1, 0, 0x3, 0x7, 0x0, 0x6 } },
+    { "CRC-4/ITU", { "CRC-4/G-704",
+    4, 1, 1, 0, 0x3, 0x0, 0x0, 0x7 } },
+    { NULL, { "CRC-4/INTERLAKEN",
+    4, 0, 0, 0, 0x3, 0xF, 0xF, 0xB } },
+    { "CRC-5/EPC", { "CRC-5/EPC-C1G2",
+    5, 0, 0, 0, 0x09, 0x09, 0x00, 0x00 } },
+    { "CRC-5/ITU", { "CRC-5/G-704",
+    5, 1, 1, 0, 0x15, 0x00, 0x00, 0x07 } },
+    { NULL, { "CRC-5/USB",
+    5, 1, 1, 0, 0x05, 0x1F, 0x1F, 0x19 } },
+    { NULL, { "CRC-6/CDMA2000-A",
+    6, 0, 0, 0, 0x27, 0x3F, 0x00, 0x0D } },
+    { NULL, { "CRC-6/CDMA2000-B",
+    6, 0, 0, 0, 0x07, 0x3F, 0x00, 0x3B } },
+    { NULL, { "CRC-6/DARC",
+    6, 1, 1, 0, 0x19, 0x00, 0x00, 0x26 } },
+    { "CRC-6/ITU", { "CRC-6/G-704",
+    6, 1, 1, 0, 0x03, 0x00, 0x00, 0x06 } },
+    { NULL, { "CRC-6/GSM",
+    6, 0, 0, 0, 0x2F, 0x00, 0x3F, 0x13 } },
+    { "CRC-7", { "CRC-7/MMC",
+    7, 0, 0, 0, 0x09, 0x00, 0x00, 0x75 } },
+    { NULL, { "CRC-7/ROHC",
+    7, 1, 1, 0, 0x4F, 0x7F, 0x00, 0x53 } },
+    { NULL, { "CRC-7/UMTS",
+    7, 0, 0, 0, 0x45, 0x00, 0x00, 0x61 } },
+    { NULL, { "CRC-8/AUTOSAR",
+    8, 0, 0, 0, 0x2F, 0xFF, 0xFF, 0xDF } },
+    { NULL, { "CRC-8/BLUETOOTH",
+    8, 1, 1, 0, 0xA7, 0x00, 0x00, 0x26 } },
+    { NULL, { "CRC-8/CDMA2000",
+    8, 0, 0, 0, 0x9B, 0xFF, 0x00, 0xDA } },
+    { NULL, { "CRC-8/DARC",
+    8, 1, 1, 0, 0x39, 0x00, 0x00, 0x15 } },
+    { NULL, { "CRC-8/DVB-S2",
+    8, 0, 0, 0, 0xD5, 0x00, 0x00, 0xBC } },
+    { NULL, { "CRC-8/GSM-A",
+    8, 0, 0, 0, 0x1D, 0x00, 0x00, 0x37 } },
+    { NULL, { "CRC-8/GSM-B",
+    8, 0, 0, 0, 0x49, 0x00, 0xFF, 0x94 } },
+    { NULL, { "CRC-8/HITAG",
+    8, 0, 0, 0, 0x1D, 0xFF, 0x00, 0xB4 } },
+    { "CRC-8/ITU", { "CRC-8/I-432-1",
+    8, 0, 0, 0, 0x07, 0x00, 0x55, 0xA1 } },
+    { NULL, { "CRC-8/I-CODE",
+    8, 0, 0, 0, 0x1D, 0xFD, 0x00, 0x7E } },
+    { NULL, { "CRC-8/LTE",
+    8, 0, 0, 0, 0x9B, 0x00, 0x00, 0xEA } },
+    { "CRC-8/MAXIM|DOW-CRC", { "CRC-8/MAXIM-DOW",
+    8, 1, 1, 0, 0x31, 0x00, 0x00, 0xA1 } },
+    { NULL, { "CRC-8/MIFARE-MAD",
+    8, 0, 0, 0, 0x1D, 0xC7, 0x00, 0x99 } },
+    { NULL, { "CRC-8/NRSC-5",
+    8, 0, 0, 0, 0x31, 0xFF, 0x00, 0xF7 } },
+    { NULL, { "CRC-8/OPENSAFETY",
+    8, 0, 0, 0, 0x2F, 0x00, 0x00, 0x3E } },
+    { NULL, { "CRC-8/ROHC",
+    8, 1, 1, 0, 0x07, 0xFF, 0x00, 0xD0 } },
+    { NULL, { "CRC-8/SAE-J1850",
+    8, 0, 0, 0, 0x1D, 0xFF, 0xFF, 0x4B } },
+    { "CRC-8", { "CRC-8/SMBUS",
+    8, 0, 0, 0, 0x07, 0x00, 0x00, 0xF4 } },
+    { "CRC-8/AES|CRC-8/EBU", { "CRC-8/TECH-3250",
+    8, 1, 1, 0, 0x1D, 0xFF, 0x00, 0x97 } },
+    { NULL, { "CRC-8/WCDMA",
+    8, 1, 1, 0, 0x9B, 0x00, 0x00, 0x25 } },
+    { "CRC-10|CRC-10/I-610", { "CRC-10/ATM",
+    10, 0, 0, 0, 0x233, 0x000, 0x000, 0x199 } },
+    { NULL, { "CRC-10/CDMA2000",
+    10, 0, 0, 0, 0x3D9, 0x3FF, 0x000, 0x233 } },
+    { NULL, { "CRC-10/GSM",
+    10, 0, 0, 0, 0x175, 0x000, 0x3FF, 0x12A } },
+    { "CRC-11", { "CRC-11/FLEXRAY",
+    11, 0, 0, 0, 0x385, 0x01A, 0x000, 0x5A3 } },
+    { NULL, { "CRC-11/UMTS",
+    11, 0, 0, 0, 0x307, 0x000, 0x000, 0x061 } },
+    { NULL, { "CRC-12/CDMA2000",
+    12, 0, 0, 0, 0xF13, 0xFFF, 0x000, 0xD4D } },
+    { "X-CRC-12", { "CRC-12/DECT",
+    12, 0, 0, 0, 0x80F, 0x000, 0x000, 0xF5B } },
+    { NULL, { "CRC-12/GSM",
+    12, 0, 0, 0, 0xD31, 0x000, 0xFFF, 0xB34 } },
+    { "CRC-12/3GPP", { "CRC-12/UMTS",
+    12, 0, 1, 0, 0x80F, 0x000, 0x000, 0xDAF } },
+    { NULL, { "CRC-13/BBC",
+    13, 0, 0, 0, 0x1CF5, 0x0000, 0x0000, 0x04FA } },
+    { NULL, { "CRC-14/DARC",
+    14, 1, 1, 0, 0x0805, 0x0000, 0x0000, 0x082D } },
+    { NULL, { "CRC-14/GSM",
+    14, 0, 0, 0, 0x202D, 0x0000, 0x3FFF, 0x30AE } },
+    { "CRC-15", { "CRC-15/CAN",
+    15, 0, 0, 0, 0x4599, 0x0000, 0x0000, 0x059E } },
+    { NULL, { "CRC-15/MPT1327",
+    15, 0, 0, 0, 0x6815, 0x0000, 0x0001, 0x2566 } },
+    { "ARC|CRC-16|CRC-16/LHA|CRC-IBM", { "CRC-16/ARC",
+    16, 1, 1, 0, 0x8005, 0x0000, 0x0000, 0xBB3D } },
+    { NULL, { "CRC-16/CDMA2000",
+    16, 0, 0, 0, 0xC867, 0xFFFF, 0x0000, 0x4C06 } },
+    { NULL, { "CRC-16/CMS",
+    16, 0, 0, 0, 0x8005, 0xFFFF, 0x0000, 0xAEE7 } },
+    { NULL, { "CRC-16/DDS-110",
+    16, 0, 0, 0, 0x8005, 0x800D, 0x0000, 0x9ECF } },
+    { "R-CRC-16", { "CRC-16/DECT-R",
+    16, 0, 0, 0, 0x0589, 0x0000, 0x0001, 0x007E } },
+    { "X-CRC-16", { "CRC-16/DECT-X",
+    16, 0, 0, 0, 0x0589, 0x0000, 0x0000, 0x007F } },
+    { NULL, { "CRC-16/DNP",
+    16, 1, 1, 0, 0x3D65, 0x0000, 0xFFFF, 0xEA82 } },
+    { NULL, { "CRC-16/EN-13757",
+    16, 0, 0, 0, 0x3D65, 0x0000, 0xFFFF, 0xC2B7 } },
+    { "CRC-16/DARC|CRC-16/EPC|CRC-16/EPC-C1G2|CRC-16/I-CODE", { "CRC-16/GENIBUS",
+    16, 0, 0, 0, 0x1021, 0xFFFF, 0xFFFF, 0xD64E } },
+    { NULL, { "CRC-16/GSM",
+    16, 0, 0, 0, 0x1021, 0x0000, 0xFFFF, 0xCE3C } },
+    { "CRC-16/AUTOSAR|CRC-16/CCITT-FALSE", { "CRC-16/IBM-3740",
+    16, 0, 0, 0, 0x1021, 0xFFFF, 0x0000, 0x29B1 } },
+    { "CRC-16/ISO-HDLC|CRC-16/ISO-IEC-14443-3-B|CRC-16/X-25|CRC-B|X-25", { "CRC-16/IBM-SDLC",
+    16, 1, 1, 0, 0x1021, 0xFFFF, 0xFFFF, 0x906E } },
+    { "CRC-A", { "CRC-16/ISO-IEC-14443-3-A",
+    16, 1, 1, 0, 0x1021, 0xC6C6, 0x0000, 0xBF05 } },
+    { "CRC-16/BLUETOOTH|CRC-16/CCITT|CRC-16/CCITT-TRUE|CRC-16/V-41-LSB|CRC-CCITT|KERMIT", { "CRC-16/KERMIT",
+    16, 1, 1, 0, 0x1021, 0x0000, 0x0000, 0x2189 } },
+    { NULL, { "CRC-16/LJ1200",
+    16, 0, 0, 0, 0x6F63, 0x0000, 0x0000, 0xBDF4 } },
+    { NULL, { "CRC-16/M17",
+    16, 0, 0, 0, 0x5935, 0xFFFF, 0x0000, 0x772B } },
+    { "CRC-16/MAXIM", { "CRC-16/MAXIM-DOW",
+    16, 1, 1, 0, 0x8005, 0x0000, 0xFFFF, 0x44C2 } },
+    { NULL, { "CRC-16/MCRF4XX",
+    16, 1, 1, 0, 0x1021, 0xFFFF, 0x0000, 0x6F91 } },
+    { "MODBUS", { "CRC-16/MODBUS",
+    16, 1, 1, 0, 0x8005, 0xFFFF, 0x0000, 0x4B37 } },
+    { NULL, { "CRC-16/NRSC-5",
+    16, 1, 1, 0, 0x080B, 0xFFFF, 0x0000, 0xA066 } },
+    { NULL, { "CRC-16/OPENSAFETY-A",
+    16, 0, 0, 0, 0x5935, 0x0000, 0x0000, 0x5D38 } },
+    { NULL, { "CRC-16/OPENSAFETY-B",
+    16, 0, 0, 0, 0x755B, 0x0000, 0x0000, 0x20FE } },
+    { "CRC-16/IEC-61158-2", { "CRC-16/PROFIBUS",
+    16, 0, 0, 0, 0x1DCF, 0xFFFF, 0xFFFF, 0xA819 } },
+    { NULL, { "CRC-16/RIELLO",
+    16, 1, 1, 0, 0x1021, 0xB2AA, 0x0000, 0x63D0 } },
+    { "CRC-16/AUG-CCITT", { "CRC-16/SPI-FUJITSU",
+    16, 0, 0, 0, 0x1021, 0x1D0F, 0x0000, 0xE5CC } },
+    { NULL, { "CRC-16/T10-DIF",
+    16, 0, 0, 0, 0x8BB7, 0x0000, 0x0000, 0xD0DB } },
+    { NULL, { "CRC-16/TELEDISK",
+    16, 0, 0, 0, 0xA097, 0x0000, 0x0000, 0x0FB3 } },
+    { NULL, { "CRC-16/TMS37157",
+    16, 1, 1, 0, 0x1021, 0x89EC, 0x0000, 0x26B1 } },
+    { "CRC-16/BUYPASS|CRC-16/VERIFONE", { "CRC-16/UMTS",
+    16, 0, 0, 0, 0x8005, 0x0000, 0x0000, 0xFEE8 } },
+    { NULL, { "CRC-16/USB",
+    16, 1, 1, 0, 0x8005, 0xFFFF, 0xFFFF, 0xB4C8 } },
+    { "CRC-16/ACORN|CRC-16/LTE|CRC-16/V-41-MSB|XMODEM|ZMODEM", { "CRC-16/XMODEM",
+    16, 0, 0, 0, 0x1021, 0x0000, 0x0000, 0x31C3 } },
+    { NULL, { "CRC-17/CAN-FD",
+    17, 0, 0, 0, 0x1685B, 0x00000, 0x00000, 0x04F03 } },
+    { NULL, { "CRC-21/CAN-FD",
+    21, 0, 0, 0, 0x102899, 0x000000, 0x000000, 0x0ED841 } },
+    { NULL, { "CRC-24/BLE",
+    24, 1, 1, 0, 0x00065B, 0x555555, 0x000000, 0xC25A56 } },
+    { NULL, { "CRC-24/FLEXRAY-A",
+    24, 0, 0, 0, 0x5D6DCB, 0xFEDCBA, 0x000000, 0x7979BD } },
+    { NULL, { "CRC-24/FLEXRAY-B",
+    24, 0, 0, 0, 0x5D6DCB, 0xABCDEF, 0x000000, 0x1F23B8 } },
+    { NULL, { "CRC-24/INTERLAKEN",
+    24, 0, 0, 0, 0x328B63, 0xFFFFFF, 0xFFFFFF, 0xB4F3E6 } },
+    { NULL, { "CRC-24/LTE-A",
+    24, 0, 0, 0, 0x864CFB, 0x000000, 0x000000, 0xCDE703 } },
+    { NULL, { "CRC-24/LTE-B",
+    24, 0, 0, 0, 0x800063, 0x000000, 0x000000, 0x23EF52 } },
+    { "CRC-24", { "CRC-24/OPENPGP",
+    24, 0, 0, 0, 0x864CFB, 0xB704CE, 0x000000, 0x21CF02 } },
+    { NULL, { "CRC-24/OS-9",
+    24, 0, 0, 0, 0x800063, 0xFFFFFF, 0xFFFFFF, 0x200FA5 } },
+    { NULL, { "CRC-30/CDMA",
+    30, 0, 0, 0, 0x2030B9C7, 0x3FFFFFFF, 0x3FFFFFFF, 0x04C34ABF } },
+    { NULL, { "CRC-31/PHILIPS",
+    31, 0, 0, 0, 0x04C11DB7, 0x7FFFFFFF, 0x7FFFFFFF, 0x0CE9E46C } },
+    { "CRC-32Q", { "CRC-32/AIXM",
+    32, 0, 0, 0, 0x814141AB, 0x00000000, 0x00000000, 0x3010BF7F } },
+    { NULL, { "CRC-32/AUTOSAR",
+    32, 1, 1, 0, 0xF4ACFB13, 0xFFFFFFFF, 0xFFFFFFFF, 0x1697D06A } },
+    { "CRC-32D", { "CRC-32/BASE91-D",
+    32, 1, 1, 0, 0xA833982B, 0xFFFFFFFF, 0xFFFFFFFF, 0x87315576 } },
+    { "CRC-32/AAL5|CRC-32/DECT-B|B-CRC-32", { "CRC-32/BZIP2",
+    32, 0, 0, 0, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC891918 } },
+    { NULL, { "CRC-32/CD-ROM-EDC",
+    32, 1, 1, 0, 0x8001801B, 0x00000000, 0x00000000, 0x6EC2EDC4 } },
+    { "CKSUM|CRC-32/POSIX", { "CRC-32/CKSUM",
+    32, 0, 0, 0, 0x04C11DB7, 0x00000000, 0xFFFFFFFF, 0x765E7680 } },
+    { "CRC32C|CRC-32C|CRC-32/BASE91-C|CRC-32/CASTAGNOLI|CRC-32/INTERLAKEN", { "CRC-32/ISCSI",
+    32, 1, 1, 0, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, 0xE3069283 } },
+    { "CRC32|CRC-32|CRC-32/ADCCP|CRC-32/V-42|CRC-32/XZ|PKZIP", { "CRC-32/ISO-HDLC",
+    32, 1, 1, 0, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926 } },
+    { "JAMCRC", { "CRC-32/JAMCRC",
+    32, 1, 1, 0, 0x04C11DB7, 0xFFFFFFFF, 0x00000000, 0x340BC6D9 } },
+    { NULL, { "CRC-32/MEF",
+    32, 1, 1, 0, 0x741B8CD7, 0xFFFFFFFF, 0x00000000, 0xD2C22F51 } },
+    { NULL, { "CRC-32/MPEG-2",
+    32, 0, 0, 0, 0x04C11DB7, 0xFFFFFFFF, 0x00000000, 0x0376E6E7 } },
+    { "XFER", { "CRC-32/XFER",
+    32, 0, 0, 0, 0x000000AF, 0x00000000, 0x00000000, 0xBD0BE338 } },
+    { NULL, { "CRC-40/GSM",
+    40, 0, 0, 0, 0x0004820009, 0x0000000000, 0xFFFFFFFFFF, 0xD4164FC646 } },
+    { "CRC-64", { "CRC-64/ECMA-182",
+    64, 0, 0, 0, 0x42F0E1EBA9EA3693, 0x0000000000000000, 0x0000000000000000, 0x6C40DF5F0B497347 } },
+    { NULL, { "CRC-64/GO-ISO",
+    64, 1, 1, 0, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xB90956C775A41001 } },
+    { NULL, { "CRC-64/MS",
+    64, 1, 1, 0, 0x259C84CBA6426349, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000, 0x75D4B74F024ECEEA } },
+    { NULL, { "CRC-64/REDIS",
+    64, 1, 1, 0, 0xAD93D23594C935A9, 0x0000000000000000, 0x0000000000000000, 0xE9C6D914C4B8D9CA } },
+    { NULL, { "CRC-64/WE",
+    64, 0, 0, 0, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x62EC59E3F1A4F00A } },
+    { "CRC-64/GO-ECMA", { "CRC-64/XZ",
+    64, 1, 1, 0, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x995DC9BBDF1939FA } },
+};
+
+#define CRC_CATALOG_SIZE    (int)(sizeof(crc_catalog) / sizeof(crc_catalog[0]))
+
+#ifndef CRC_CATALOG_GEN
+#include "crc_catalog_table.h"
+// generated tables must match the catalogue above
+typedef char crc_catalog_size_check[(CRC_CATALOG_SIZE == CRC_CATALOG_NUM &&
+    CRC_CATALOG_NUM <= CRC_CATALOG_MAX) ? 1 : -1];
+#endif /* CRC_CATALOG_GEN */
+
+// Compare two names, ignoring case, 'b' ends at '\0' or '|'.
+static int crc_util_name_match(const char *a, const char *b) {
+    for (; *a && *b && '|' != *b; a++, b++) {
+        if (toupper((unsigned char)*a) != toupper((unsigned char)*b)) return 0;
+    }
+    return !*a && (!*b || '|' == *b);
+}
+
+int crc_catalog_find(const char *name) {
+    int i;
+    const char *alias;
+    if (NULL == name) return -1;
+    for (i = 0; i < CRC_CATALOG_SIZE; i++) {
+        if (crc_util_name_match(name, crc_catalog[i].param.name)) return i;
+        for (alias = crc_catalog[i].alias; alias && *alias; alias++) {
+            if (crc_util_name_match(name, alias)) return i;
+            while (*alias && '|' != *alias) alias++;
+            if (!*alias) break;
+        }
+    }
+    return -1;
+}
+
+const crc_model_param_s *crc_util_model_param(const char *name) {
+    int i = crc_catalog_find(name);
+    return (i < 0) ? NULL : &crc_catalog[i].param;
+}
+
+const crc_model_param_s *crc_util_model_param_at(size_t index) {
+    return (index < (size_t)CRC_CATALOG_SIZE) ? &crc_catalog[index].param : NULL;
+}
+
+#ifndef CRC_CATALOG_GEN
+const void *crc_catalog_table(int index) {
+    return (0 <= index && index < CRC_CATALOG_SIZE) ? crc_catalog_tables[index] : NULL;
+}
+#endif /* CRC_CATALOG_GEN */
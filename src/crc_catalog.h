@@ -0,0 +1,20 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: built-in crc model catalogue (private)
+// @file:       crc_catalog.h
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+#ifndef _CRC_CATALOG_H_
+#define _CRC_CATALOG_H_
+
+// Max number of catalogue models, for static model storage.
+#define CRC_CATALOG_MAX     128
+
+// Catalogue index of model by name or alias, -1 if unknown.
+int crc_catalog_find(const char *name);
+// Precomputed byte table of model 'index': the table[0] of crc_utils.c, i.e.
+// for poly left-aligned to whole bytes, in uint16/32/64_t by register bits.
+const void *crc_catalog_table(int index);
+
+#endif // !_CRC_CATALOG_H_
@@ -0,0 +1,3102 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: precomputed tables of built-in catalogue
+// @file:       crc_catalog_table.h
+// ------------------------------------------------------------------------
+
+// Generated by extsrc/crc_catalog_gen.c (make catalog), don't edit.
+
+// CRC-3/GSM
+static const uint16_t crc_catalog_table_0[256] = {
+    0x0000, 0x0060, 0x00C0, 0x00A0, 0x00E0, 0x0080, 0x0020, 0x0040,
+    0x00A0, 0x00C0, 0x0060, 0x0000, 0x0040, 0x0020, 0x0080, 0x00E0,
+    0x0020, 0x0040, 0x00E0, 0x0080, 0x00C0, 0x00A0, 0x0000, 0x0060,
+    0x0080, 0x00E0, 0x0040, 0x0020, 0x0060, 0x0000, 0x00A0, 0x00C0,
+    0x0040, 0x0020, 0x0080, 0x00E0, 0x00A0, 0x00C0, 0x0060, 0x0000,
+    0x00E0, 0x0080, 0x0020, 0x0040, 0x0000, 0x0060, 0x00C0, 0x00A0,
+    0x0060, 0x0000, 0x00A0, 0x00C0, 0x0080, 0x00E0, 0x0040, 0x0020,
+    0x00C0, 0x00A0, 0x0000, 0x0060, 0x0020, 0x0040, 0x00E0, 0x0080,
+    0x0080, 0x00E0, 0x0040, 0x0020, 0x0060, 0x0000, 0x00A0, 0x00C0,
+    0x0020, 0x0040, 0x00E0, 0x0080, 0x00C0, 0x00A0, 0x0000, 0x0060,
+    0x00A0, 0x00C0, 0x0060, 0x0000, 0x0040, 0x0020, 0x0080, 0x00E0,
+    0x0000, 0x0060, 0x00C0, 0x00A0, 0x00E0, 0x0080, 0x0020, 0x0040,
+    0x00C0, 0x00A0, 0x0000, 0x0060, 0x0020, 0x0040, 0x00E0, 0x0080,
+    0x0060, 0x0000, 0x00A0, 0x00C0, 0x0080, 0x00E0, 0x0040, 0x0020,
+    0x00E0, 0x0080, 0x0020, 0x0040, 0x0000, 0x0060, 0x00C0, 0x00A0,
+    0x0040, 0x0020, 0x0080, 0x00E0, 0x00A0, 0x00C0, 0x0060, 0x0000,
+    0x0060, 0x0000, 0x00A0, 0x00C0, 0x0080, 0x00E0, 0x0040, 0x0020,
+    0x00C0, 0x00A0, 0x0000, 0x0060, 0x0020, 0x0040, 0x00E0, 0x0080,
+    0x0040, 0x0020, 0x0080, 0x00E0, 0x00A0, 0x00C0, 0x0060, 0x0000,
+    0x00E0, 0x0080, 0x0020, 0x0040, 0x0000, 0x0060, 0x00C0, 0x00A0,
+    0x0020, 0x0040, 0x00E0, 0x0080, 0x00C0, 0x00A0, 0x0000, 0x0060,
+    0x0080, 0x00E0, 0x0040, 0x0020, 0x0060, 0x0000, 0x00A0, 0x00C0,
+    0x0000, 0x0060, 0x00C0, 0x00A0, 0x00E0, 0x0080, 0x0020, 0x0040,
+    0x00A0, 0x00C0, 0x0060, 0x0000, 0x0040, 0x0020, 0x0080, 0x00E0,
+    0x00E0, 0x0080, 0x0020, 0x0040, 0x0000, 0x0060, 0x00C0, 0x00A0,
+    0x0040, 0x0020, 0x0080, 0x00E0, 0x00A0, 0x00C0, 0x0060, 0x0000,
+    0x00C0, 0x00A0, 0x0000, 0x0060, 0x0020, 0x0040, 0x00E0, 0x0080,
+    0x0060, 0x0000, 0x00A0, 0x00C0, 0x0080, 0x00E0, 0x0040, 0x0020,
+    0x00A0, 0x00C0, 0x0060, 0x0000, 0x0040, 0x0020, 0x0080, 0x00E0,
+    0x0000, 0x0060, 0x00C0, 0x00A0, 0x00E0, 0x0080, 0x0020, 0x0040,
+    0x0080, 0x00E0, 0x0040, 0x0020, 0x0060, 0x0000, 0x00A0, 0x00C0,
+    0x0020, 0x0040, 0x00E0, 0x0080, 0x00C0, 0x00A0, 0x0000, 0x0060,
+};
+
+// CRC-3/ROHC
+static const uint16_t crc_catalog_table_1[256] = {
+    0x0000, 0x0006, 0x0001, 0x0007, 0x0002, 0x0004, 0x0003, 0x0005,
+    0x0004, 0x0002, 0x0005, 0x0003, 0x0006, 0x0000, 0x0007, 0x0001,
+    0x0005, 0x0003, 0x0004, 0x0002, 0x0007, 0x0001, 0x0006, 0x0000,
+    0x0001, 0x0007, 0x0000, 0x0006, 0x0003, 0x0005, 0x0002, 0x0004,
+    0x0007, 0x0001, 0x0006, 0x0000, 0x0005, 0x0003, 0x0004, 0x0002,
+    0x0003, 0x0005, 0x0002, 0x0004, 0x0001, 0x0007, 0x0000, 0x0006,
+    0x0002, 0x0004, 0x0003, 0x0005, 0x0000, 0x0006, 0x0001, 0x0007,
+    0x0006, 0x0000, 0x0007, 0x0001, 0x0004, 0x0002, 0x0005, 0x0003,
+    0x0003, 0x0005, 0x0002, 0x0004, 0x0001, 0x0007, 0x0000, 0x0006,
+    0x0007, 0x0001, 0x0006, 0x0000, 0x0005, 0x0003, 0x0004, 0x0002,
+    0x0006, 0x0000, 0x0007, 0x0001, 0x0004, 0x0002, 0x0005, 0x0003,
+    0x0002, 0x0004, 0x0003, 0x0005, 0x0000, 0x0006, 0x0001, 0x0007,
+    0x0004, 0x0002, 0x0005, 0x0003, 0x0006, 0x0000, 0x0007, 0x0001,
+    0x0000, 0x0006, 0x0001, 0x0007, 0x0002, 0x0004, 0x0003, 0x0005,
+    0x0001, 0x0007, 0x0000, 0x0006, 0x0003, 0x0005, 0x0002, 0x0004,
+    0x0005, 0x0003, 0x0004, 0x0002, 0x0007, 0x0001, 0x0006, 0x0000,
+    0x0006, 0x0000, 0x0007, 0x0001, 0x0004, 0x0002, 0x0005, 0x0003,
+    0x0002, 0x0004, 0x0003, 0x0005, 0x0000, 0x0006, 0x0001, 0x0007,
+    0x0003, 0x0005, 0x0002, 0x0004, 0x0001, 0x0007, 0x0000, 0x0006,
+    0x0007, 0x0001, 0x0006, 0x0000, 0x0005, 0x0003, 0x0004, 0x0002,
+    0x0001, 0x0007, 0x0000, 0x0006, 0x0003, 0x0005, 0x0002, 0x0004,
+    0x0005, 0x0003, 0x0004, 0x0002, 0x0007, 0x0001, 0x0006, 0x0000,
+    0x0004, 0x0002, 0x0005, 0x0003, 0x0006, 0x0000, 0x0007, 0x0001,
+    0x0000, 0x0006, 0x0001, 0x0007, 0x0002, 0x0004, 0x0003, 0x0005,
+    0x0005, 0x0003, 0x0004, 0x0002, 0x0007, 0x0001, 0x0006, 0x0000,
+    0x0001, 0x0007, 0x0000, 0x0006, 0x0003, 0x0005, 0x0002, 0x0004,
+    0x0000, 0x0006, 0x0001, 0x0007, 0x0002, 0x0004, 0x0003, 0x0005,
+    0x0004, 0x0002, 0x0005, 0x0003, 0x0006, 0x0000, 0x0007, 0x0001,
+    0x0002, 0x0004, 0x0003, 0x0005, 0x0000, 0x0006, 0x0001, 0x0007,
+    0x0006, 0x0000, 0x0007, 0x0001, 0x0004, 0x0002, 0x0005, 0x0003,
+    0x0007, 0x0001, 0x0006, 0x0000, 0x0005, 0x0003, 0x0004, 0x0002,
+    0x0003, 0x0005, 0x0002, 0x0004, 0x0001, 0x0007, 0x0000, 0x0006,
+};
+
+// CRC-4/G-704
+static const uint16_t crc_catalog_table_2[256] = {
+    0x0000, 0x0007, 0x000E, 0x0009, 0x0005, 0x0002, 0x000B, 0x000C,
+    0x000A, 0x000D, 0x0004, 0x0003, 0x000F, 0x0008, 0x0001, 0x0006,
+    0x000D, 0x000A, 0x0003, 0x0004, 0x0008, 0x000F, 0x0006, 0x0001,
+    0x0007, 0x0000, 0x0009, 0x000E, 0x0002, 0x0005, 0x000C, 0x000B,
+    0x0003, 0x0004, 0x000D, 0x000A, 0x0006, 0x0001, 0x0008, 0x000F,
+    0x0009, 0x000E, 0x0007, 0x0000, 0x000C, 0x000B, 0x0002, 0x0005,
+    0x000E, 0x0009, 0x0000, 0x0007, 0x000B, 0x000C, 0x0005, 0x0002,
+    0x0004, 0x0003, 0x000A, 0x000D, 0x0001, 0x0006, 0x000F, 0x0008,
+    0x0006, 0x0001, 0x0008, 0x000F, 0x0003, 0x0004, 0x000D, 0x000A,
+    0x000C, 0x000B, 0x0002, 0x0005, 0x0009, 0x000E, 0x0007, 0x0000,
+    0x000B, 0x000C, 0x0005, 0x0002, 0x000E, 0x0009, 0x0000, 0x0007,
+    0x0001, 0x0006, 0x000F, 0x0008, 0x0004, 0x0003, 0x000A, 0x000D,
+    0x0005, 0x0002, 0x000B, 0x000C, 0x0000, 0x0007, 0x000E, 0x0009,
+    0x000F, 0x0008, 0x0001, 0x0006, 0x000A, 0x000D, 0x0004, 0x0003,
+    0x0008, 0x000F, 0x0006, 0x0001, 0x000D, 0x000A, 0x0003, 0x0004,
+    0x0002, 0x0005, 0x000C, 0x000B, 0x0007, 0x0000, 0x0009, 0x000E,
+    0x000C, 0x000B, 0x0002, 0x0005, 0x0009, 0x000E, 0x0007, 0x0000,
+    0x0006, 0x0001, 0x0008, 0x000F, 0x0003, 0x0004, 0x000D, 0x000A,
+    0x0001, 0x0006, 0x000F, 0x0008, 0x0004, 0x0003, 0x000A, 0x000D,
+    0x000B, 0x000C, 0x0005, 0x0002, 0x000E, 0x0009, 0x0000, 0x0007,
+    0x000F, 0x0008, 0x0001, 0x0006, 0x000A, 0x000D, 0x0004, 0x0003,
+    0x0005, 0x0002, 0x000B, 0x000C, 0x0000, 0x0007, 0x000E, 0x0009,
+    0x0002, 0x0005, 0x000C, 0x000B, 0x0007, 0x0000, 0x0009, 0x000E,
+    0x0008, 0x000F, 0x0006, 0x0001, 0x000D, 0x000A, 0x0003, 0x0004,
+    0x000A, 0x000D, 0x0004, 0x0003, 0x000F, 0x0008, 0x0001, 0x0006,
+    0x0000, 0x0007, 0x000E, 0x0009, 0x0005, 0x0002, 0x000B, 0x000C,
+    0x0007, 0x0000, 0x0009, 0x000E, 0x0002, 0x0005, 0x000C, 0x000B,
+    0x000D, 0x000A, 0x0003, 0x0004, 0x0008, 0x000F, 0x0006, 0x0001,
+    0x0009, 0x000E, 0x0007, 0x0000, 0x000C, 0x000B, 0x0002, 0x0005,
+    0x0003, 0x0004, 0x000D, 0x000A, 0x0006, 0x0001, 0x0008, 0x000F,
+    0x0004, 0x0003, 0x000A, 0x000D, 0x0001, 0x0006, 0x000F, 0x0008,
+    0x000E, 0x0009, 0x0000, 0x0007, 0x000B, 0x000C, 0x0005, 0x0002,
+};
+
+// CRC-4/INTERLAKEN
+static const uint16_t crc_catalog_table_3[256] = {
+    0x0000, 0x0030, 0x0060, 0x0050, 0x00C0, 0x00F0, 0x00A0, 0x0090,
+    0x00B0, 0x0080, 0x00D0, 0x00E0, 0x0070, 0x0040, 0x0010, 0x0020,
+    0x0050, 0x0060, 0x0030, 0x0000, 0x0090, 0x00A0, 0x00F0, 0x00C0,
+    0x00E0, 0x00D0, 0x0080, 0x00B0, 0x0020, 0x0010, 0x0040, 0x0070,
+    0x00A0, 0x0090, 0x00C0, 0x00F0, 0x0060, 0x0050, 0x0000, 0x0030,
+    0x0010, 0x0020, 0x0070, 0x0040, 0x00D0, 0x00E0, 0x00B0, 0x0080,
+    0x00F0, 0x00C0, 0x0090, 0x00A0, 0x0030, 0x0000, 0x0050, 0x0060,
+    0x0040, 0x0070, 0x0020, 0x0010, 0x0080, 0x00B0, 0x00E0, 0x00D0,
+    0x0070, 0x0040, 0x0010, 0x0020, 0x00B0, 0x0080, 0x00D0, 0x00E0,
+    0x00C0, 0x00F0, 0x00A0, 0x0090, 0x0000, 0x0030, 0x0060, 0x0050,
+    0x0020, 0x0010, 0x0040, 0x0070, 0x00E0, 0x00D0, 0x0080, 0x00B0,
+    0x0090, 0x00A0, 0x00F0, 0x00C0, 0x0050, 0x0060, 0x0030, 0x0000,
+    0x00D0, 0x00E0, 0x00B0, 0x0080, 0x0010, 0x0020, 0x0070, 0x0040,
+    0x0060, 0x0050, 0x0000, 0x0030, 0x00A0, 0x0090, 0x00C0, 0x00F0,
+    0x0080, 0x00B0, 0x00E0, 0x00D0, 0x0040, 0x0070, 0x0020, 0x0010,
+    0x0030, 0x0000, 0x0050, 0x0060, 0x00F0, 0x00C0, 0x0090, 0x00A0,
+    0x00E0, 0x00D0, 0x0080, 0x00B0, 0x0020, 0x0010, 0x0040, 0x0070,
+    0x0050, 0x0060, 0x0030, 0x0000, 0x0090, 0x00A0, 0x00F0, 0x00C0,
+    0x00B0, 0x0080, 0x00D0, 0x00E0, 0x0070, 0x0040, 0x0010, 0x0020,
+    0x0000, 0x0030, 0x0060, 0x0050, 0x00C0, 0x00F0, 0x00A0, 0x0090,
+    0x0040, 0x0070, 0x0020, 0x0010, 0x0080, 0x00B0, 0x00E0, 0x00D0,
+    0x00F0, 0x00C0, 0x0090, 0x00A0, 0x0030, 0x0000, 0x0050, 0x0060,
+    0x0010, 0x0020, 0x0070, 0x0040, 0x00D0, 0x00E0, 0x00B0, 0x0080,
+    0x00A0, 0x0090, 0x00C0, 0x00F0, 0x0060, 0x0050, 0x0000, 0x0030,
+    0x0090, 0x00A0, 0x00F0, 0x00C0, 0x0050, 0x0060, 0x0030, 0x0000,
+    0x0020, 0x0010, 0x0040, 0x0070, 0x00E0, 0x00D0, 0x0080, 0x00B0,
+    0x00C0, 0x00F0, 0x00A0, 0x0090, 0x0000, 0x0030, 0x0060, 0x0050,
+    0x0070, 0x0040, 0x0010, 0x0020, 0x00B0, 0x0080, 0x00D0, 0x00E0,
+    0x0030, 0x0000, 0x0050, 0x0060, 0x00F0, 0x00C0, 0x0090, 0x00A0,
+    0x0080, 0x00B0, 0x00E0, 0x00D0, 0x0040, 0x0070, 0x0020, 0x0010,
+    0x0060, 0x0050, 0x0000, 0x0030, 0x00A0, 0x0090, 0x00C0, 0x00F0,
+    0x00D0, 0x00E0, 0x00B0, 0x0080, 0x0010, 0x0020, 0x0070, 0x0040,
+};
+
+// CRC-5/EPC-C1G2
+static const uint16_t crc_catalog_table_4[256] = {
+    0x0000, 0x0048, 0x0090, 0x00D8, 0x0068, 0x0020, 0x00F8, 0x00B0,
+    0x00D0, 0x0098, 0x0040, 0x0008, 0x00B8, 0x00F0, 0x0028, 0x0060,
+    0x00E8, 0x00A0, 0x0078, 0x0030, 0x0080, 0x00C8, 0x0010, 0x0058,
+    0x0038, 0x0070, 0x00A8, 0x00E0, 0x0050, 0x0018, 0x00C0, 0x0088,
+    0x0098, 0x00D0, 0x0008, 0x0040, 0x00F0, 0x00B8, 0x0060, 0x0028,
+    0x0048, 0x0000, 0x00D8, 0x0090, 0x0020, 0x0068, 0x00B0, 0x00F8,
+    0x0070, 0x0038, 0x00E0, 0x00A8, 0x0018, 0x0050, 0x0088, 0x00C0,
+    0x00A0, 0x00E8, 0x0030, 0x0078, 0x00C8, 0x0080, 0x0058, 0x0010,
+    0x0078, 0x0030, 0x00E8, 0x00A0, 0x0010, 0x0058, 0x0080, 0x00C8,
+    0x00A8, 0x00E0, 0x0038, 0x0070, 0x00C0, 0x0088, 0x0050, 0x0018,
+    0x0090, 0x00D8, 0x0000, 0x0048, 0x00F8, 0x00B0, 0x0068, 0x0020,
+    0x0040, 0x0008, 0x00D0, 0x0098, 0x0028, 0x0060, 0x00B8, 0x00F0,
+    0x00E0, 0x00A8, 0x0070, 0x0038, 0x0088, 0x00C0, 0x0018, 0x0050,
+    0x0030, 0x0078, 0x00A0, 0x00E8, 0x0058, 0x0010, 0x00C8, 0x0080,
+    0x0008, 0x0040, 0x0098, 0x00D0, 0x0060, 0x0028, 0x00F0, 0x00B8,
+    0x00D8, 0x0090, 0x0048, 0x0000, 0x00B0, 0x00F8, 0x0020, 0x0068,
+    0x00F0, 0x00B8, 0x0060, 0x0028, 0x0098, 0x00D0, 0x0008, 0x0040,
+    0x0020, 0x0068, 0x00B0, 0x00F8, 0x0048, 0x0000, 0x00D8, 0x0090,
+    0x0018, 0x0050, 0x0088, 0x00C0, 0x0070, 0x0038, 0x00E0, 0x00A8,
+    0x00C8, 0x0080, 0x0058, 0x0010, 0x00A0, 0x00E8, 0x0030, 0x0078,
+    0x0068, 0x0020, 0x00F8, 0x00B0, 0x0000, 0x0048, 0x0090, 0x00D8,
+    0x00B8, 0x00F0, 0x0028, 0x0060, 0x00D0, 0x0098, 0x0040, 0x0008,
+    0x0080, 0x00C8, 0x0010, 0x0058, 0x00E8, 0x00A0, 0x0078, 0x0030,
+    0x0050, 0x0018, 0x00C0, 0x0088, 0x0038, 0x0070, 0x00A8, 0x00E0,
+    0x0088, 0x00C0, 0x0018, 0x0050, 0x00E0, 0x00A8, 0x0070, 0x0038,
+    0x0058, 0x0010, 0x00C8, 0x0080, 0x0030, 0x0078, 0x00A0, 0x00E8,
+    0x0060, 0x0028, 0x00F0, 0x00B8, 0x0008, 0x0040, 0x0098, 0x00D0,
+    0x00B0, 0x00F8, 0x0020, 0x0068, 0x00D8, 0x0090, 0x0048, 0x0000,
+    0x0010, 0x0058, 0x0080, 0x00C8, 0x0078, 0x0030, 0x00E8, 0x00A0,
+    0x00C0, 0x0088, 0x0050, 0x0018, 0x00A8, 0x00E0, 0x0038, 0x0070,
+    0x00F8, 0x00B0, 0x0068, 0x0020, 0x0090, 0x00D8, 0x0000, 0x0048,
+    0x0028, 0x0060, 0x00B8, 0x00F0, 0x0040, 0x0008, 0x00D0, 0x0098,
+};
+
+// CRC-5/G-704
+static const uint16_t crc_catalog_table_5[256] = {
+    0x0000, 0x0007, 0x000E, 0x0009, 0x001C, 0x001B, 0x0012, 0x0015,
+    0x0013, 0x0014, 0x001D, 0x001A, 0x000F, 0x0008, 0x0001, 0x0006,
+    0x000D, 0x000A, 0x0003, 0x0004, 0x0011, 0x0016, 0x001F, 0x0018,
+    0x001E, 0x0019, 0x0010, 0x0017, 0x0002, 0x0005, 0x000C, 0x000B,
+    0x001A, 0x001D, 0x0014, 0x0013, 0x0006, 0x0001, 0x0008, 0x000F,
+    0x0009, 0x000E, 0x0007, 0x0000, 0x0015, 0x0012, 0x001B, 0x001C,
+    0x0017, 0x0010, 0x0019, 0x001E, 0x000B, 0x000C, 0x0005, 0x0002,
+    0x0004, 0x0003, 0x000A, 0x000D, 0x0018, 0x001F, 0x0016, 0x0011,
+    0x001F, 0x0018, 0x0011, 0x0016, 0x0003, 0x0004, 0x000D, 0x000A,
+    0x000C, 0x000B, 0x0002, 0x0005, 0x0010, 0x0017, 0x001E, 0x0019,
+    0x0012, 0x0015, 0x001C, 0x001B, 0x000E, 0x0009, 0x0000, 0x0007,
+    0x0001, 0x0006, 0x000F, 0x0008, 0x001D, 0x001A, 0x0013, 0x0014,
+    0x0005, 0x0002, 0x000B, 0x000C, 0x0019, 0x001E, 0x0017, 0x0010,
+    0x0016, 0x0011, 0x0018, 0x001F, 0x000A, 0x000D, 0x0004, 0x0003,
+    0x0008, 0x000F, 0x0006, 0x0001, 0x0014, 0x0013, 0x001A, 0x001D,
+    0x001B, 0x001C, 0x0015, 0x0012, 0x0007, 0x0000, 0x0009, 0x000E,
+    0x0015, 0x0012, 0x001B, 0x001C, 0x0009, 0x000E, 0x0007, 0x0000,
+    0x0006, 0x0001, 0x0008, 0x000F, 0x001A, 0x001D, 0x0014, 0x0013,
+    0x0018, 0x001F, 0x0016, 0x0011, 0x0004, 0x0003, 0x000A, 0x000D,
+    0x000B, 0x000C, 0x0005, 0x0002, 0x0017, 0x0010, 0x0019, 0x001E,
+    0x000F, 0x0008, 0x0001, 0x0006, 0x0013, 0x0014, 0x001D, 0x001A,
+    0x001C, 0x001B, 0x0012, 0x0015, 0x0000, 0x0007, 0x000E, 0x0009,
+    0x0002, 0x0005, 0x000C, 0x000B, 0x001E, 0x0019, 0x0010, 0x0017,
+    0x0011, 0x0016, 0x001F, 0x0018, 0x000D, 0x000A, 0x0003, 0x0004,
+    0x000A, 0x000D, 0x0004, 0x0003, 0x0016, 0x0011, 0x0018, 0x001F,
+    0x0019, 0x001E, 0x0017, 0x0010, 0x0005, 0x0002, 0x000B, 0x000C,
+    0x0007, 0x0000, 0x0009, 0x000E, 0x001B, 0x001C, 0x0015, 0x0012,
+    0x0014, 0x0013, 0x001A, 0x001D, 0x0008, 0x000F, 0x0006, 0x0001,
+    0x0010, 0x0017, 0x001E, 0x0019, 0x000C, 0x000B, 0x0002, 0x0005,
+    0x0003, 0x0004, 0x000D, 0x000A, 0x001F, 0x0018, 0x0011, 0x0016,
+    0x001D, 0x001A, 0x0013, 0x0014, 0x0001, 0x0006, 0x000F, 0x0008,
+    0x000E, 0x0009, 0x0000, 0x0007, 0x0012, 0x0015, 0x001C, 0x001B,
+};
+
+// CRC-5/USB
+static const uint16_t crc_catalog_table_6[256] = {
+    0x0000, 0x000E, 0x001C, 0x0012, 0x0011, 0x001F, 0x000D, 0x0003,
+    0x000B, 0x0005, 0x0017, 0x0019, 0x001A, 0x0014, 0x0006, 0x0008,
+    0x0016, 0x0018, 0x000A, 0x0004, 0x0007, 0x0009, 0x001B, 0x0015,
+    0x001D, 0x0013, 0x0001, 0x000F, 0x000C, 0x0002, 0x0010, 0x001E,
+    0x0005, 0x000B, 0x0019, 0x0017, 0x0014, 0x001A, 0x0008, 0x0006,
+    0x000E, 0x0000, 0x0012, 0x001C, 0x001F, 0x0011, 0x0003, 0x000D,
+    0x0013, 0x001D, 0x000F, 0x0001, 0x0002, 0x000C, 0x001E, 0x0010,
+    0x0018, 0x0016, 0x0004, 0x000A, 0x0009, 0x0007, 0x0015, 0x001B,
+    0x000A, 0x0004, 0x0016, 0x0018, 0x001B, 0x0015, 0x0007, 0x0009,
+    0x0001, 0x000F, 0x001D, 0x0013, 0x0010, 0x001E, 0x000C, 0x0002,
+    0x001C, 0x0012, 0x0000, 0x000E, 0x000D, 0x0003, 0x0011, 0x001F,
+    0x0017, 0x0019, 0x000B, 0x0005, 0x0006, 0x0008, 0x001A, 0x0014,
+    0x000F, 0x0001, 0x0013, 0x001D, 0x001E, 0x0010, 0x0002, 0x000C,
+    0x0004, 0x000A, 0x0018, 0x0016, 0x0015, 0x001B, 0x0009, 0x0007,
+    0x0019, 0x0017, 0x0005, 0x000B, 0x0008, 0x0006, 0x0014, 0x001A,
+    0x0012, 0x001C, 0x000E, 0x0000, 0x0003, 0x000D, 0x001F, 0x0011,
+    0x0014, 0x001A, 0x0008, 0x0006, 0x0005, 0x000B, 0x0019, 0x0017,
+    0x001F, 0x0011, 0x0003, 0x000D, 0x000E, 0x0000, 0x0012, 0x001C,
+    0x0002, 0x000C, 0x001E, 0x0010, 0x0013, 0x001D, 0x000F, 0x0001,
+    0x0009, 0x0007, 0x0015, 0x001B, 0x0018, 0x0016, 0x0004, 0x000A,
+    0x0011, 0x001F, 0x000D, 0x0003, 0x0000, 0x000E, 0x001C, 0x0012,
+    0x001A, 0x0014, 0x0006, 0x0008, 0x000B, 0x0005, 0x0017, 0x0019,
+    0x0007, 0x0009, 0x001B, 0x0015, 0x0016, 0x0018, 0x000A, 0x0004,
+    0x000C, 0x0002, 0x0010, 0x001E, 0x001D, 0x0013, 0x0001, 0x000F,
+    0x001E, 0x0010, 0x0002, 0x000C, 0x000F, 0x0001, 0x0013, 0x001D,
+    0x0015, 0x001B, 0x0009, 0x0007, 0x0004, 0x000A, 0x0018, 0x0016,
+    0x0008, 0x0006, 0x0014, 0x001A, 0x0019, 0x0017, 0x0005, 0x000B,
+    0x0003, 0x000D, 0x001F, 0x0011, 0x0012, 0x001C, 0x000E, 0x0000,
+    0x001B, 0x0015, 0x0007, 0x0009, 0x000A, 0x0004, 0x0016, 0x0018,
+    0x0010, 0x001E, 0x000C, 0x0002, 0x0001, 0x000F, 0x001D, 0x0013,
+    0x000D, 0x0003, 0x0011, 0x001F, 0x001C, 0x0012, 0x0000, 0x000E,
+    0x0006, 0x0008, 0x001A, 0x0014, 0x0017, 0x0019, 0x000B, 0x0005,
+};
+
+// CRC-6/CDMA2000-A
+static const uint16_t crc_catalog_table_7[256] = {
+    0x0000, 0x009C, 0x00A4, 0x0038, 0x00D4, 0x0048, 0x0070, 0x00EC,
+    0x0034, 0x00A8, 0x0090, 0x000C, 0x00E0, 0x007C, 0x0044, 0x00D8,
+    0x0068, 0x00F4, 0x00CC, 0x0050, 0x00BC, 0x0020, 0x0018, 0x0084,
+    0x005C, 0x00C0, 0x00F8, 0x0064, 0x0088, 0x0014, 0x002C, 0x00B0,
+    0x00D0, 0x004C, 0x0074, 0x00E8, 0x0004, 0x0098, 0x00A0, 0x003C,
+    0x00E4, 0x0078, 0x0040, 0x00DC, 0x0030, 0x00AC, 0x0094, 0x0008,
+    0x00B8, 0x0024, 0x001C, 0x0080, 0x006C, 0x00F0, 0x00C8, 0x0054,
+    0x008C, 0x0010, 0x0028, 0x00B4, 0x0058, 0x00C4, 0x00FC, 0x0060,
+    0x003C, 0x00A0, 0x0098, 0x0004, 0x00E8, 0x0074, 0x004C, 0x00D0,
+    0x0008, 0x0094, 0x00AC, 0x0030, 0x00DC, 0x0040, 0x0078, 0x00E4,
+    0x0054, 0x00C8, 0x00F0, 0x006C, 0x0080, 0x001C, 0x0024, 0x00B8,
+    0x0060, 0x00FC, 0x00C4, 0x0058, 0x00B4, 0x0028, 0x0010, 0x008C,
+    0x00EC, 0x0070, 0x0048, 0x00D4, 0x0038, 0x00A4, 0x009C, 0x0000,
+    0x00D8, 0x0044, 0x007C, 0x00E0, 0x000C, 0x0090, 0x00A8, 0x0034,
+    0x0084, 0x0018, 0x0020, 0x00BC, 0x0050, 0x00CC, 0x00F4, 0x0068,
+    0x00B0, 0x002C, 0x0014, 0x0088, 0x0064, 0x00F8, 0x00C0, 0x005C,
+    0x0078, 0x00E4, 0x00DC, 0x0040, 0x00AC, 0x0030, 0x0008, 0x0094,
+    0x004C, 0x00D0, 0x00E8, 0x0074, 0x0098, 0x0004, 0x003C, 0x00A0,
+    0x0010, 0x008C, 0x00B4, 0x0028, 0x00C4, 0x0058, 0x0060, 0x00FC,
+    0x0024, 0x00B8, 0x0080, 0x001C, 0x00F0, 0x006C, 0x0054, 0x00C8,
+    0x00A8, 0x0034, 0x000C, 0x0090, 0x007C, 0x00E0, 0x00D8, 0x0044,
+    0x009C, 0x0000, 0x0038, 0x00A4, 0x0048, 0x00D4, 0x00EC, 0x0070,
+    0x00C0, 0x005C, 0x0064, 0x00F8, 0x0014, 0x0088, 0x00B0, 0x002C,
+    0x00F4, 0x0068, 0x0050, 0x00CC, 0x0020, 0x00BC, 0x0084, 0x0018,
+    0x0044, 0x00D8, 0x00E0, 0x007C, 0x0090, 0x000C, 0x0034, 0x00A8,
+    0x0070, 0x00EC, 0x00D4, 0x0048, 0x00A4, 0x0038, 0x0000, 0x009C,
+    0x002C, 0x00B0, 0x0088, 0x0014, 0x00F8, 0x0064, 0x005C, 0x00C0,
+    0x0018, 0x0084, 0x00BC, 0x0020, 0x00CC, 0x0050, 0x0068, 0x00F4,
+    0x0094, 0x0008, 0x0030, 0x00AC, 0x0040, 0x00DC, 0x00E4, 0x0078,
+    0x00A0, 0x003C, 0x0004, 0x0098, 0x0074, 0x00E8, 0x00D0, 0x004C,
+    0x00FC, 0x0060, 0x0058, 0x00C4, 0x0028, 0x00B4, 0x008C, 0x0010,
+    0x00C8, 0x0054, 0x006C, 0x00F0, 0x001C, 0x0080, 0x00B8, 0x0024,
+};
+
+// CRC-6/CDMA2000-B
+static const uint16_t crc_catalog_table_8[256] = {
+    0x0000, 0x001C, 0x0038, 0x0024, 0x0070, 0x006C, 0x0048, 0x0054,
+    0x00E0, 0x00FC, 0x00D8, 0x00C4, 0x0090, 0x008C, 0x00A8, 0x00B4,
+    0x00DC, 0x00C0, 0x00E4, 0x00F8, 0x00AC, 0x00B0, 0x0094, 0x0088,
+    0x003C, 0x0020, 0x0004, 0x0018, 0x004C, 0x0050, 0x0074, 0x0068,
+    0x00A4, 0x00B8, 0x009C, 0x0080, 0x00D4, 0x00C8, 0x00EC, 0x00F0,
+    0x0044, 0x0058, 0x007C, 0x0060, 0x0034, 0x0028, 0x000C, 0x0010,
+    0x0078, 0x0064, 0x0040, 0x005C, 0x0008, 0x0014, 0x0030, 0x002C,
+    0x0098, 0x0084, 0x00A0, 0x00BC, 0x00E8, 0x00F4, 0x00D0, 0x00CC,
+    0x0054, 0x0048, 0x006C, 0x0070, 0x0024, 0x0038, 0x001C, 0x0000,
+    0x00B4, 0x00A8, 0x008C, 0x0090, 0x00C4, 0x00D8, 0x00FC, 0x00E0,
+    0x0088, 0x0094, 0x00B0, 0x00AC, 0x00F8, 0x00E4, 0x00C0, 0x00DC,
+    0x0068, 0x0074, 0x0050, 0x004C, 0x0018, 0x0004, 0x0020, 0x003C,
+    0x00F0, 0x00EC, 0x00C8, 0x00D4, 0x0080, 0x009C, 0x00B8, 0x00A4,
+    0x0010, 0x000C, 0x0028, 0x0034, 0x0060, 0x007C, 0x0058, 0x0044,
+    0x002C, 0x0030, 0x0014, 0x0008, 0x005C, 0x0040, 0x0064, 0x0078,
+    0x00CC, 0x00D0, 0x00F4, 0x00E8, 0x00BC, 0x00A0, 0x0084, 0x0098,
+    0x00A8, 0x00B4, 0x0090, 0x008C, 0x00D8, 0x00C4, 0x00E0, 0x00FC,
+    0x0048, 0x0054, 0x0070, 0x006C, 0x0038, 0x0024, 0x0000, 0x001C,
+    0x0074, 0x0068, 0x004C, 0x0050, 0x0004, 0x0018, 0x003C, 0x0020,
+    0x0094, 0x0088, 0x00AC, 0x00B0, 0x00E4, 0x00F8, 0x00DC, 0x00C0,
+    0x000C, 0x0010, 0x0034, 0x0028, 0x007C, 0x0060, 0x0044, 0x0058,
+    0x00EC, 0x00F0, 0x00D4, 0x00C8, 0x009C, 0x0080, 0x00A4, 0x00B8,
+    0x00D0, 0x00CC, 0x00E8, 0x00F4, 0x00A0, 0x00BC, 0x0098, 0x0084,
+    0x0030, 0x002C, 0x0008, 0x0014, 0x0040, 0x005C, 0x0078, 0x0064,
+    0x00FC, 0x00E0, 0x00C4, 0x00D8, 0x008C, 0x0090, 0x00B4, 0x00A8,
+    0x001C, 0x0000, 0x0024, 0x0038, 0x006C, 0x0070, 0x0054, 0x0048,
+    0x0020, 0x003C, 0x0018, 0x0004, 0x0050, 0x004C, 0x0068, 0x0074,
+    0x00C0, 0x00DC, 0x00F8, 0x00E4, 0x00B0, 0x00AC, 0x0088, 0x0094,
+    0x0058, 0x0044, 0x0060, 0x007C, 0x0028, 0x0034, 0x0010, 0x000C,
+    0x00B8, 0x00A4, 0x0080, 0x009C, 0x00C8, 0x00D4, 0x00F0, 0x00EC,
+    0x0084, 0x0098, 0x00BC, 0x00A0, 0x00F4, 0x00E8, 0x00CC, 0x00D0,
+    0x0064, 0x0078, 0x005C, 0x0040, 0x0014, 0x0008, 0x002C, 0x0030,
+};
+
+// CRC-6/DARC
+static const uint16_t crc_catalog_table_9[256] = {
+    0x0000, 0x0032, 0x0029, 0x001B, 0x001F, 0x002D, 0x0036, 0x0004,
+    0x003E, 0x000C, 0x0017, 0x0025, 0x0021, 0x0013, 0x0008, 0x003A,
+    0x0031, 0x0003, 0x0018, 0x002A, 0x002E, 0x001C, 0x0007, 0x0035,
+    0x000F, 0x003D, 0x0026, 0x0014, 0x0010, 0x0022, 0x0039, 0x000B,
+    0x002F, 0x001D, 0x0006, 0x0034, 0x0030, 0x0002, 0x0019, 0x002B,
+    0x0011, 0x0023, 0x0038, 0x000A, 0x000E, 0x003C, 0x0027, 0x0015,
+    0x001E, 0x002C, 0x0037, 0x0005, 0x0001, 0x0033, 0x0028, 0x001A,
+    0x0020, 0x0012, 0x0009, 0x003B, 0x003F, 0x000D, 0x0016, 0x0024,
+    0x0013, 0x0021, 0x003A, 0x0008, 0x000C, 0x003E, 0x0025, 0x0017,
+    0x002D, 0x001F, 0x0004, 0x0036, 0x0032, 0x0000, 0x001B, 0x0029,
+    0x0022, 0x0010, 0x000B, 0x0039, 0x003D, 0x000F, 0x0014, 0x0026,
+    0x001C, 0x002E, 0x0035, 0x0007, 0x0003, 0x0031, 0x002A, 0x0018,
+    0x003C, 0x000E, 0x0015, 0x0027, 0x0023, 0x0011, 0x000A, 0x0038,
+    0x0002, 0x0030, 0x002B, 0x0019, 0x001D, 0x002F, 0x0034, 0x0006,
+    0x000D, 0x003F, 0x0024, 0x0016, 0x0012, 0x0020, 0x003B, 0x0009,
+    0x0033, 0x0001, 0x001A, 0x0028, 0x002C, 0x001E, 0x0005, 0x0037,
+    0x0026, 0x0014, 0x000F, 0x003D, 0x0039, 0x000B, 0x0010, 0x0022,
+    0x0018, 0x002A, 0x0031, 0x0003, 0x0007, 0x0035, 0x002E, 0x001C,
+    0x0017, 0x0025, 0x003E, 0x000C, 0x0008, 0x003A, 0x0021, 0x0013,
+    0x0029, 0x001B, 0x0000, 0x0032, 0x0036, 0x0004, 0x001F, 0x002D,
+    0x0009, 0x003B, 0x0020, 0x0012, 0x0016, 0x0024, 0x003F, 0x000D,
+    0x0037, 0x0005, 0x001E, 0x002C, 0x0028, 0x001A, 0x0001, 0x0033,
+    0x0038, 0x000A, 0x0011, 0x0023, 0x0027, 0x0015, 0x000E, 0x003C,
+    0x0006, 0x0034, 0x002F, 0x001D, 0x0019, 0x002B, 0x0030, 0x0002,
+    0x0035, 0x0007, 0x001C, 0x002E, 0x002A, 0x0018, 0x0003, 0x0031,
+    0x000B, 0x0039, 0x0022, 0x0010, 0x0014, 0x0026, 0x003D, 0x000F,
+    0x0004, 0x0036, 0x002D, 0x001F, 0x001B, 0x0029, 0x0032, 0x0000,
+    0x003A, 0x0008, 0x0013, 0x0021, 0x0025, 0x0017, 0x000C, 0x003E,
+    0x001A, 0x0028, 0x0033, 0x0001, 0x0005, 0x0037, 0x002C, 0x001E,
+    0x0024, 0x0016, 0x000D, 0x003F, 0x003B, 0x0009, 0x0012, 0x0020,
+    0x002B, 0x0019, 0x0002, 0x0030, 0x0034, 0x0006, 0x001D, 0x002F,
+    0x0015, 0x0027, 0x003C, 0x000E, 0x000A, 0x0038, 0x0023, 0x0011,
+};
+
+// CRC-6/G-704
+static const uint16_t crc_catalog_table_10[256] = {
+    0x0000, 0x0014, 0x0028, 0x003C, 0x0031, 0x0025, 0x0019, 0x000D,
+    0x0003, 0x0017, 0x002B, 0x003F, 0x0032, 0x0026, 0x001A, 0x000E,
+    0x0006, 0x0012, 0x002E, 0x003A, 0x0037, 0x0023, 0x001F, 0x000B,
+    0x0005, 0x0011, 0x002D, 0x0039, 0x0034, 0x0020, 0x001C, 0x0008,
+    0x000C, 0x0018, 0x0024, 0x0030, 0x003D, 0x0029, 0x0015, 0x0001,
+    0x000F, 0x001B, 0x0027, 0x0033, 0x003E, 0x002A, 0x0016, 0x0002,
+    0x000A, 0x001E, 0x0022, 0x0036, 0x003B, 0x002F, 0x0013, 0x0007,
+    0x0009, 0x001D, 0x0021, 0x0035, 0x0038, 0x002C, 0x0010, 0x0004,
+    0x0018, 0x000C, 0x0030, 0x0024, 0x0029, 0x003D, 0x0001, 0x0015,
+    0x001B, 0x000F, 0x0033, 0x0027, 0x002A, 0x003E, 0x0002, 0x0016,
+    0x001E, 0x000A, 0x0036, 0x0022, 0x002F, 0x003B, 0x0007, 0x0013,
+    0x001D, 0x0009, 0x0035, 0x0021, 0x002C, 0x0038, 0x0004, 0x0010,
+    0x0014, 0x0000, 0x003C, 0x0028, 0x0025, 0x0031, 0x000D, 0x0019,
+    0x0017, 0x0003, 0x003F, 0x002B, 0x0026, 0x0032, 0x000E, 0x001A,
+    0x0012, 0x0006, 0x003A, 0x002E, 0x0023, 0x0037, 0x000B, 0x001F,
+    0x0011, 0x0005, 0x0039, 0x002D, 0x0020, 0x0034, 0x0008, 0x001C,
+    0x0030, 0x0024, 0x0018, 0x000C, 0x0001, 0x0015, 0x0029, 0x003D,
+    0x0033, 0x0027, 0x001B, 0x000F, 0x0002, 0x0016, 0x002A, 0x003E,
+    0x0036, 0x0022, 0x001E, 0x000A, 0x0007, 0x0013, 0x002F, 0x003B,
+    0x0035, 0x0021, 0x001D, 0x0009, 0x0004, 0x0010, 0x002C, 0x0038,
+    0x003C, 0x0028, 0x0014, 0x0000, 0x000D, 0x0019, 0x0025, 0x0031,
+    0x003F, 0x002B, 0x0017, 0x0003, 0x000E, 0x001A, 0x0026, 0x0032,
+    0x003A, 0x002E, 0x0012, 0x0006, 0x000B, 0x001F, 0x0023, 0x0037,
+    0x0039, 0x002D, 0x0011, 0x0005, 0x0008, 0x001C, 0x0020, 0x0034,
+    0x0028, 0x003C, 0x0000, 0x0014, 0x0019, 0x000D, 0x0031, 0x0025,
+    0x002B, 0x003F, 0x0003, 0x0017, 0x001A, 0x000E, 0x0032, 0x0026,
+    0x002E, 0x003A, 0x0006, 0x0012, 0x001F, 0x000B, 0x0037, 0x0023,
+    0x002D, 0x0039, 0x0005, 0x0011, 0x001C, 0x0008, 0x0034, 0x0020,
+    0x0024, 0x0030, 0x000C, 0x0018, 0x0015, 0x0001, 0x003D, 0x0029,
+    0x0027, 0x0033, 0x000F, 0x001B, 0x0016, 0x0002, 0x003E, 0x002A,
+    0x0022, 0x0036, 0x000A, 0x001E, 0x0013, 0x0007, 0x003B, 0x002F,
+    0x0021, 0x0035, 0x0009, 0x001D, 0x0010, 0x0004, 0x0038, 0x002C,
+};
+
+// CRC-6/GSM
+static const uint16_t crc_catalog_table_11[256] = {
+    0x0000, 0x00BC, 0x00C4, 0x0078, 0x0034, 0x0088, 0x00F0, 0x004C,
+    0x0068, 0x00D4, 0x00AC, 0x0010, 0x005C, 0x00E0, 0x0098, 0x0024,
+    0x00D0, 0x006C, 0x0014, 0x00A8, 0x00E4, 0x0058, 0x0020, 0x009C,
+    0x00B8, 0x0004, 0x007C, 0x00C0, 0x008C, 0x0030, 0x0048, 0x00F4,
+    0x001C, 0x00A0, 0x00D8, 0x0064, 0x0028, 0x0094, 0x00EC, 0x0050,
+    0x0074, 0x00C8, 0x00B0, 0x000C, 0x0040, 0x00FC, 0x0084, 0x0038,
+    0x00CC, 0x0070, 0x0008, 0x00B4, 0x00F8, 0x0044, 0x003C, 0x0080,
+    0x00A4, 0x0018, 0x0060, 0x00DC, 0x0090, 0x002C, 0x0054, 0x00E8,
+    0x0038, 0x0084, 0x00FC, 0x0040, 0x000C, 0x00B0, 0x00C8, 0x0074,
+    0x0050, 0x00EC, 0x0094, 0x0028, 0x0064, 0x00D8, 0x00A0, 0x001C,
+    0x00E8, 0x0054, 0x002C, 0x0090, 0x00DC, 0x0060, 0x0018, 0x00A4,
+    0x0080, 0x003C, 0x0044, 0x00F8, 0x00B4, 0x0008, 0x0070, 0x00CC,
+    0x0024, 0x0098, 0x00E0, 0x005C, 0x0010, 0x00AC, 0x00D4, 0x0068,
+    0x004C, 0x00F0, 0x0088, 0x0034, 0x0078, 0x00C4, 0x00BC, 0x0000,
+    0x00F4, 0x0048, 0x0030, 0x008C, 0x00C0, 0x007C, 0x0004, 0x00B8,
+    0x009C, 0x0020, 0x0058, 0x00E4, 0x00A8, 0x0014, 0x006C, 0x00D0,
+    0x0070, 0x00CC, 0x00B4, 0x0008, 0x0044, 0x00F8, 0x0080, 0x003C,
+    0x0018, 0x00A4, 0x00DC, 0x0060, 0x002C, 0x0090, 0x00E8, 0x0054,
+    0x00A0, 0x001C, 0x0064, 0x00D8, 0x0094, 0x0028, 0x0050, 0x00EC,
+    0x00C8, 0x0074, 0x000C, 0x00B0, 0x00FC, 0x0040, 0x0038, 0x0084,
+    0x006C, 0x00D0, 0x00A8, 0x0014, 0x0058, 0x00E4, 0x009C, 0x0020,
+    0x0004, 0x00B8, 0x00C0, 0x007C, 0x0030, 0x008C, 0x00F4, 0x0048,
+    0x00BC, 0x0000, 0x0078, 0x00C4, 0x0088, 0x0034, 0x004C, 0x00F0,
+    0x00D4, 0x0068, 0x0010, 0x00AC, 0x00E0, 0x005C, 0x0024, 0x0098,
+    0x0048, 0x00F4, 0x008C, 0x0030, 0x007C, 0x00C0, 0x00B8, 0x0004,
+    0x0020, 0x009C, 0x00E4, 0x0058, 0x0014, 0x00A8, 0x00D0, 0x006C,
+    0x0098, 0x0024, 0x005C, 0x00E0, 0x00AC, 0x0010, 0x0068, 0x00D4,
+    0x00F0, 0x004C, 0x0034, 0x0088, 0x00C4, 0x0078, 0x0000, 0x00BC,
+    0x0054, 0x00E8, 0x0090, 0x002C, 0x0060, 0x00DC, 0x00A4, 0x0018,
+    0x003C, 0x0080, 0x00F8, 0x0044, 0x0008, 0x00B4, 0x00CC, 0x0070,
+    0x0084, 0x0038, 0x0040, 0x00FC, 0x00B0, 0x000C, 0x0074, 0x00C8,
+    0x00EC, 0x0050, 0x0028, 0x0094, 0x00D8, 0x0064, 0x001C, 0x00A0,
+};
+
+// CRC-7/MMC
+static const uint16_t crc_catalog_table_12[256] = {
+    0x0000, 0x0012, 0x0024, 0x0036, 0x0048, 0x005A, 0x006C, 0x007E,
+    0x0090, 0x0082, 0x00B4, 0x00A6, 0x00D8, 0x00CA, 0x00FC, 0x00EE,
+    0x0032, 0x0020, 0x0016, 0x0004, 0x007A, 0x0068, 0x005E, 0x004C,
+    0x00A2, 0x00B0, 0x0086, 0x0094, 0x00EA, 0x00F8, 0x00CE, 0x00DC,
+    0x0064, 0x0076, 0x0040, 0x0052, 0x002C, 0x003E, 0x0008, 0x001A,
+    0x00F4, 0x00E6, 0x00D0, 0x00C2, 0x00BC, 0x00AE, 0x0098, 0x008A,
+    0x0056, 0x0044, 0x0072, 0x0060, 0x001E, 0x000C, 0x003A, 0x0028,
+    0x00C6, 0x00D4, 0x00E2, 0x00F0, 0x008E, 0x009C, 0x00AA, 0x00B8,
+    0x00C8, 0x00DA, 0x00EC, 0x00FE, 0x0080, 0x0092, 0x00A4, 0x00B6,
+    0x0058, 0x004A, 0x007C, 0x006E, 0x0010, 0x0002, 0x0034, 0x0026,
+    0x00FA, 0x00E8, 0x00DE, 0x00CC, 0x00B2, 0x00A0, 0x0096, 0x0084,
+    0x006A, 0x0078, 0x004E, 0x005C, 0x0022, 0x0030, 0x0006, 0x0014,
+    0x00AC, 0x00BE, 0x0088, 0x009A, 0x00E4, 0x00F6, 0x00C0, 0x00D2,
+    0x003C, 0x002E, 0x0018, 0x000A, 0x0074, 0x0066, 0x0050, 0x0042,
+    0x009E, 0x008C, 0x00BA, 0x00A8, 0x00D6, 0x00C4, 0x00F2, 0x00E0,
+    0x000E, 0x001C, 0x002A, 0x0038, 0x0046, 0x0054, 0x0062, 0x0070,
+    0x0082, 0x0090, 0x00A6, 0x00B4, 0x00CA, 0x00D8, 0x00EE, 0x00FC,
+    0x0012, 0x0000, 0x0036, 0x0024, 0x005A, 0x0048, 0x007E, 0x006C,
+    0x00B0, 0x00A2, 0x0094, 0x0086, 0x00F8, 0x00EA, 0x00DC, 0x00CE,
+    0x0020, 0x0032, 0x0004, 0x0016, 0x0068, 0x007A, 0x004C, 0x005E,
+    0x00E6, 0x00F4, 0x00C2, 0x00D0, 0x00AE, 0x00BC, 0x008A, 0x0098,
+    0x0076, 0x0064, 0x0052, 0x0040, 0x003E, 0x002C, 0x001A, 0x0008,
+    0x00D4, 0x00C6, 0x00F0, 0x00E2, 0x009C, 0x008E, 0x00B8, 0x00AA,
+    0x0044, 0x0056, 0x0060, 0x0072, 0x000C, 0x001E, 0x0028, 0x003A,
+    0x004A, 0x0058, 0x006E, 0x007C, 0x0002, 0x0010, 0x0026, 0x0034,
+    0x00DA, 0x00C8, 0x00FE, 0x00EC, 0x0092, 0x0080, 0x00B6, 0x00A4,
+    0x0078, 0x006A, 0x005C, 0x004E, 0x0030, 0x0022, 0x0014, 0x0006,
+    0x00E8, 0x00FA, 0x00CC, 0x00DE, 0x00A0, 0x00B2, 0x0084, 0x0096,
+    0x002E, 0x003C, 0x000A, 0x0018, 0x0066, 0x0074, 0x0042, 0x0050,
+    0x00BE, 0x00AC, 0x009A, 0x0088, 0x00F6, 0x00E4, 0x00D2, 0x00C0,
+    0x001C, 0x000E, 0x0038, 0x002A, 0x0054, 0x0046, 0x0070, 0x0062,
+    0x008C, 0x009E, 0x00A8, 0x00BA, 0x00C4, 0x00D6, 0x00E0, 0x00F2,
+};
+
+// CRC-7/ROHC
+static const uint16_t crc_catalog_table_13[256] = {
+    0x0000, 0x0040, 0x0073, 0x0033, 0x0015, 0x0055, 0x0066, 0x0026,
+    0x002A, 0x006A, 0x0059, 0x0019, 0x003F, 0x007F, 0x004C, 0x000C,
+    0x0054, 0x0014, 0x0027, 0x0067, 0x0041, 0x0001, 0x0032, 0x0072,
+    0x007E, 0x003E, 0x000D, 0x004D, 0x006B, 0x002B, 0x0018, 0x0058,
+    0x005B, 0x001B, 0x0028, 0x0068, 0x004E, 0x000E, 0x003D, 0x007D,
+    0x0071, 0x0031, 0x0002, 0x0042, 0x0064, 0x0024, 0x0017, 0x0057,
+    0x000F, 0x004F, 0x007C, 0x003C, 0x001A, 0x005A, 0x0069, 0x0029,
+    0x0025, 0x0065, 0x0056, 0x0016, 0x0030, 0x0070, 0x0043, 0x0003,
+    0x0045, 0x0005, 0x0036, 0x0076, 0x0050, 0x0010, 0x0023, 0x0063,
+    0x006F, 0x002F, 0x001C, 0x005C, 0x007A, 0x003A, 0x0009, 0x0049,
+    0x0011, 0x0051, 0x0062, 0x0022, 0x0004, 0x0044, 0x0077, 0x0037,
+    0x003B, 0x007B, 0x0048, 0x0008, 0x002E, 0x006E, 0x005D, 0x001D,
+    0x001E, 0x005E, 0x006D, 0x002D, 0x000B, 0x004B, 0x0078, 0x0038,
+    0x0034, 0x0074, 0x0047, 0x0007, 0x0021, 0x0061, 0x0052, 0x0012,
+    0x004A, 0x000A, 0x0039, 0x0079, 0x005F, 0x001F, 0x002C, 0x006C,
+    0x0060, 0x0020, 0x0013, 0x0053, 0x0075, 0x0035, 0x0006, 0x0046,
+    0x0079, 0x0039, 0x000A, 0x004A, 0x006C, 0x002C, 0x001F, 0x005F,
+    0x0053, 0x0013, 0x0020, 0x0060, 0x0046, 0x0006, 0x0035, 0x0075,
+    0x002D, 0x006D, 0x005E, 0x001E, 0x0038, 0x0078, 0x004B, 0x000B,
+    0x0007, 0x0047, 0x0074, 0x0034, 0x0012, 0x0052, 0x0061, 0x0021,
+    0x0022, 0x0062, 0x0051, 0x0011, 0x0037, 0x0077, 0x0044, 0x0004,
+    0x0008, 0x0048, 0x007B, 0x003B, 0x001D, 0x005D, 0x006E, 0x002E,
+    0x0076, 0x0036, 0x0005, 0x0045, 0x0063, 0x0023, 0x0010, 0x0050,
+    0x005C, 0x001C, 0x002F, 0x006F, 0x0049, 0x0009, 0x003A, 0x007A,
+    0x003C, 0x007C, 0x004F, 0x000F, 0x0029, 0x0069, 0x005A, 0x001A,
+    0x0016, 0x0056, 0x0065, 0x0025, 0x0003, 0x0043, 0x0070, 0x0030,
+    0x0068, 0x0028, 0x001B, 0x005B, 0x007D, 0x003D, 0x000E, 0x004E,
+    0x0042, 0x0002, 0x0031, 0x0071, 0x0057, 0x0017, 0x0024, 0x0064,
+    0x0067, 0x0027, 0x0014, 0x0054, 0x0072, 0x0032, 0x0001, 0x0041,
+    0x004D, 0x000D, 0x003E, 0x007E, 0x0058, 0x0018, 0x002B, 0x006B,
+    0x0033, 0x0073, 0x0040, 0x0000, 0x0026, 0x0066, 0x0055, 0x0015,
+    0x0019, 0x0059, 0x006A, 0x002A, 0x000C, 0x004C, 0x007F, 0x003F,
+};
+
+// CRC-7/UMTS
+static const uint16_t crc_catalog_table_14[256] = {
+    0x0000, 0x008A, 0x009E, 0x0014, 0x00B6, 0x003C, 0x0028, 0x00A2,
+    0x00E6, 0x006C, 0x0078, 0x00F2, 0x0050, 0x00DA, 0x00CE, 0x0044,
+    0x0046, 0x00CC, 0x00D8, 0x0052, 0x00F0, 0x007A, 0x006E, 0x00E4,
+    0x00A0, 0x002A, 0x003E, 0x00B4, 0x0016, 0x009C, 0x0088, 0x0002,
+    0x008C, 0x0006, 0x0012, 0x0098, 0x003A, 0x00B0, 0x00A4, 0x002E,
+    0x006A, 0x00E0, 0x00F4, 0x007E, 0x00DC, 0x0056, 0x0042, 0x00C8,
+    0x00CA, 0x0040, 0x0054, 0x00DE, 0x007C, 0x00F6, 0x00E2, 0x0068,
+    0x002C, 0x00A6, 0x00B2, 0x0038, 0x009A, 0x0010, 0x0004, 0x008E,
+    0x0092, 0x0018, 0x000C, 0x0086, 0x0024, 0x00AE, 0x00BA, 0x0030,
+    0x0074, 0x00FE, 0x00EA, 0x0060, 0x00C2, 0x0048, 0x005C, 0x00D6,
+    0x00D4, 0x005E, 0x004A, 0x00C0, 0x0062, 0x00E8, 0x00FC, 0x0076,
+    0x0032, 0x00B8, 0x00AC, 0x0026, 0x0084, 0x000E, 0x001A, 0x0090,
+    0x001E, 0x0094, 0x0080, 0x000A, 0x00A8, 0x0022, 0x0036, 0x00BC,
+    0x00F8, 0x0072, 0x0066, 0x00EC, 0x004E, 0x00C4, 0x00D0, 0x005A,
+    0x0058, 0x00D2, 0x00C6, 0x004C, 0x00EE, 0x0064, 0x0070, 0x00FA,
+    0x00BE, 0x0034, 0x0020, 0x00AA, 0x0008, 0x0082, 0x0096, 0x001C,
+    0x00AE, 0x0024, 0x0030, 0x00BA, 0x0018, 0x0092, 0x0086, 0x000C,
+    0x0048, 0x00C2, 0x00D6, 0x005C, 0x00FE, 0x0074, 0x0060, 0x00EA,
+    0x00E8, 0x0062, 0x0076, 0x00FC, 0x005E, 0x00D4, 0x00C0, 0x004A,
+    0x000E, 0x0084, 0x0090, 0x001A, 0x00B8, 0x0032, 0x0026, 0x00AC,
+    0x0022, 0x00A8, 0x00BC, 0x0036, 0x0094, 0x001E, 0x000A, 0x0080,
+    0x00C4, 0x004E, 0x005A, 0x00D0, 0x0072, 0x00F8, 0x00EC, 0x0066,
+    0x0064, 0x00EE, 0x00FA, 0x0070, 0x00D2, 0x0058, 0x004C, 0x00C6,
+    0x0082, 0x0008, 0x001C, 0x0096, 0x0034, 0x00BE, 0x00AA, 0x0020,
+    0x003C, 0x00B6, 0x00A2, 0x0028, 0x008A, 0x0000, 0x0014, 0x009E,
+    0x00DA, 0x0050, 0x0044, 0x00CE, 0x006C, 0x00E6, 0x00F2, 0x0078,
+    0x007A, 0x00F0, 0x00E4, 0x006E, 0x00CC, 0x0046, 0x0052, 0x00D8,
+    0x009C, 0x0016, 0x0002, 0x0088, 0x002A, 0x00A0, 0x00B4, 0x003E,
+    0x00B0, 0x003A, 0x002E, 0x00A4, 0x0006, 0x008C, 0x0098, 0x0012,
+    0x0056, 0x00DC, 0x00C8, 0x0042, 0x00E0, 0x006A, 0x007E, 0x00F4,
+    0x00F6, 0x007C, 0x0068, 0x00E2, 0x0040, 0x00CA, 0x00DE, 0x0054,
+    0x0010, 0x009A, 0x008E, 0x0004, 0x00A6, 0x002C, 0x0038, 0x00B2,
+};
+
+// CRC-8/AUTOSAR
+static const uint16_t crc_catalog_table_15[256] = {
+    0x0000, 0x002F, 0x005E, 0x0071, 0x00BC, 0x0093, 0x00E2, 0x00CD,
+    0x0057, 0x0078, 0x0009, 0x0026, 0x00EB, 0x00C4, 0x00B5, 0x009A,
+    0x00AE, 0x0081, 0x00F0, 0x00DF, 0x0012, 0x003D, 0x004C, 0x0063,
+    0x00F9, 0x00D6, 0x00A7, 0x0088, 0x0045, 0x006A, 0x001B, 0x0034,
+    0x0073, 0x005C, 0x002D, 0x0002, 0x00CF, 0x00E0, 0x0091, 0x00BE,
+    0x0024, 0x000B, 0x007A, 0x0055, 0x0098, 0x00B7, 0x00C6, 0x00E9,
+    0x00DD, 0x00F2, 0x0083, 0x00AC, 0x0061, 0x004E, 0x003F, 0x0010,
+    0x008A, 0x00A5, 0x00D4, 0x00FB, 0x0036, 0x0019, 0x0068, 0x0047,
+    0x00E6, 0x00C9, 0x00B8, 0x0097, 0x005A, 0x0075, 0x0004, 0x002B,
+    0x00B1, 0x009E, 0x00EF, 0x00C0, 0x000D, 0x0022, 0x0053, 0x007C,
+    0x0048, 0x0067, 0x0016, 0x0039, 0x00F4, 0x00DB, 0x00AA, 0x0085,
+    0x001F, 0x0030, 0x0041, 0x006E, 0x00A3, 0x008C, 0x00FD, 0x00D2,
+    0x0095, 0x00BA, 0x00CB, 0x00E4, 0x0029, 0x0006, 0x0077, 0x0058,
+    0x00C2, 0x00ED, 0x009C, 0x00B3, 0x007E, 0x0051, 0x0020, 0x000F,
+    0x003B, 0x0014, 0x0065, 0x004A, 0x0087, 0x00A8, 0x00D9, 0x00F6,
+    0x006C, 0x0043, 0x0032, 0x001D, 0x00D0, 0x00FF, 0x008E, 0x00A1,
+    0x00E3, 0x00CC, 0x00BD, 0x0092, 0x005F, 0x0070, 0x0001, 0x002E,
+    0x00B4, 0x009B, 0x00EA, 0x00C5, 0x0008, 0x0027, 0x0056, 0x0079,
+    0x004D, 0x0062, 0x0013, 0x003C, 0x00F1, 0x00DE, 0x00AF, 0x0080,
+    0x001A, 0x0035, 0x0044, 0x006B, 0x00A6, 0x0089, 0x00F8, 0x00D7,
+    0x0090, 0x00BF, 0x00CE, 0x00E1, 0x002C, 0x0003, 0x0072, 0x005D,
+    0x00C7, 0x00E8, 0x0099, 0x00B6, 0x007B, 0x0054, 0x0025, 0x000A,
+    0x003E, 0x0011, 0x0060, 0x004F, 0x0082, 0x00AD, 0x00DC, 0x00F3,
+    0x0069, 0x0046, 0x0037, 0x0018, 0x00D5, 0x00FA, 0x008B, 0x00A4,
+    0x0005, 0x002A, 0x005B, 0x0074, 0x00B9, 0x0096, 0x00E7, 0x00C8,
+    0x0052, 0x007D, 0x000C, 0x0023, 0x00EE, 0x00C1, 0x00B0, 0x009F,
+    0x00AB, 0x0084, 0x00F5, 0x00DA, 0x0017, 0x0038, 0x0049, 0x0066,
+    0x00FC, 0x00D3, 0x00A2, 0x008D, 0x0040, 0x006F, 0x001E, 0x0031,
+    0x0076, 0x0059, 0x0028, 0x0007, 0x00CA, 0x00E5, 0x0094, 0x00BB,
+    0x0021, 0x000E, 0x007F, 0x0050, 0x009D, 0x00B2, 0x00C3, 0x00EC,
+    0x00D8, 0x00F7, 0x0086, 0x00A9, 0x0064, 0x004B, 0x003A, 0x0015,
+    0x008F, 0x00A0, 0x00D1, 0x00FE, 0x0033, 0x001C, 0x006D, 0x0042,
+};
+
+// CRC-8/BLUETOOTH
+static const uint16_t crc_catalog_table_16[256] = {
+    0x0000, 0x006B, 0x00D6, 0x00BD, 0x0067, 0x000C, 0x00B1, 0x00DA,
+    0x00CE, 0x00A5, 0x0018, 0x0073, 0x00A9, 0x00C2, 0x007F, 0x0014,
+    0x0057, 0x003C, 0x0081, 0x00EA, 0x0030, 0x005B, 0x00E6, 0x008D,
+    0x0099, 0x00F2, 0x004F, 0x0024, 0x00FE, 0x0095, 0x0028, 0x0043,
+    0x00AE, 0x00C5, 0x0078, 0x0013, 0x00C9, 0x00A2, 0x001F, 0x0074,
+    0x0060, 0x000B, 0x00B6, 0x00DD, 0x0007, 0x006C, 0x00D1, 0x00BA,
+    0x00F9, 0x0092, 0x002F, 0x0044, 0x009E, 0x00F5, 0x0048, 0x0023,
+    0x0037, 0x005C, 0x00E1, 0x008A, 0x0050, 0x003B, 0x0086, 0x00ED,
+    0x0097, 0x00FC, 0x0041, 0x002A, 0x00F0, 0x009B, 0x0026, 0x004D,
+    0x0059, 0x0032, 0x008F, 0x00E4, 0x003E, 0x0055, 0x00E8, 0x0083,
+    0x00C0, 0x00AB, 0x0016, 0x007D, 0x00A7, 0x00CC, 0x0071, 0x001A,
+    0x000E, 0x0065, 0x00D8, 0x00B3, 0x0069, 0x0002, 0x00BF, 0x00D4,
+    0x0039, 0x0052, 0x00EF, 0x0084, 0x005E, 0x0035, 0x0088, 0x00E3,
+    0x00F7, 0x009C, 0x0021, 0x004A, 0x0090, 0x00FB, 0x0046, 0x002D,
+    0x006E, 0x0005, 0x00B8, 0x00D3, 0x0009, 0x0062, 0x00DF, 0x00B4,
+    0x00A0, 0x00CB, 0x0076, 0x001D, 0x00C7, 0x00AC, 0x0011, 0x007A,
+    0x00E5, 0x008E, 0x0033, 0x0058, 0x0082, 0x00E9, 0x0054, 0x003F,
+    0x002B, 0x0040, 0x00FD, 0x0096, 0x004C, 0x0027, 0x009A, 0x00F1,
+    0x00B2, 0x00D9, 0x0064, 0x000F, 0x00D5, 0x00BE, 0x0003, 0x0068,
+    0x007C, 0x0017, 0x00AA, 0x00C1, 0x001B, 0x0070, 0x00CD, 0x00A6,
+    0x004B, 0x0020, 0x009D, 0x00F6, 0x002C, 0x0047, 0x00FA, 0x0091,
+    0x0085, 0x00EE, 0x0053, 0x0038, 0x00E2, 0x0089, 0x0034, 0x005F,
+    0x001C, 0x0077, 0x00CA, 0x00A1, 0x007B, 0x0010, 0x00AD, 0x00C6,
+    0x00D2, 0x00B9, 0x0004, 0x006F, 0x00B5, 0x00DE, 0x0063, 0x0008,
+    0x0072, 0x0019, 0x00A4, 0x00CF, 0x0015, 0x007E, 0x00C3, 0x00A8,
+    0x00BC, 0x00D7, 0x006A, 0x0001, 0x00DB, 0x00B0, 0x000D, 0x0066,
+    0x0025, 0x004E, 0x00F3, 0x0098, 0x0042, 0x0029, 0x0094, 0x00FF,
+    0x00EB, 0x0080, 0x003D, 0x0056, 0x008C, 0x00E7, 0x005A, 0x0031,
+    0x00DC, 0x00B7, 0x000A, 0x0061, 0x00BB, 0x00D0, 0x006D, 0x0006,
+    0x0012, 0x0079, 0x00C4, 0x00AF, 0x0075, 0x001E, 0x00A3, 0x00C8,
+    0x008B, 0x00E0, 0x005D, 0x0036, 0x00EC, 0x0087, 0x003A, 0x0051,
+    0x0045, 0x002E, 0x0093, 0x00F8, 0x0022, 0x0049, 0x00F4, 0x009F,
+};
+
+// CRC-8/CDMA2000
+static const uint16_t crc_catalog_table_17[256] = {
+    0x0000, 0x009B, 0x00AD, 0x0036, 0x00C1, 0x005A, 0x006C, 0x00F7,
+    0x0019, 0x0082, 0x00B4, 0x002F, 0x00D8, 0x0043, 0x0075, 0x00EE,
+    0x0032, 0x00A9, 0x009F, 0x0004, 0x00F3, 0x0068, 0x005E, 0x00C5,
+    0x002B, 0x00B0, 0x0086, 0x001D, 0x00EA, 0x0071, 0x0047, 0x00DC,
+    0x0064, 0x00FF, 0x00C9, 0x0052, 0x00A5, 0x003E, 0x0008, 0x0093,
+    0x007D, 0x00E6, 0x00D0, 0x004B, 0x00BC, 0x0027, 0x0011, 0x008A,
+    0x0056, 0x00CD, 0x00FB, 0x0060, 0x0097, 0x000C, 0x003A, 0x00A1,
+    0x004F, 0x00D4, 0x00E2, 0x0079, 0x008E, 0x0015, 0x0023, 0x00B8,
+    0x00C8, 0x0053, 0x0065, 0x00FE, 0x0009, 0x0092, 0x00A4, 0x003F,
+    0x00D1, 0x004A, 0x007C, 0x00E7, 0x0010, 0x008B, 0x00BD, 0x0026,
+    0x00FA, 0x0061, 0x0057, 0x00CC, 0x003B, 0x00A0, 0x0096, 0x000D,
+    0x00E3, 0x0078, 0x004E, 0x00D5, 0x0022, 0x00B9, 0x008F, 0x0014,
+    0x00AC, 0x0037, 0x0001, 0x009A, 0x006D, 0x00F6, 0x00C0, 0x005B,
+    0x00B5, 0x002E, 0x0018, 0x0083, 0x0074, 0x00EF, 0x00D9, 0x0042,
+    0x009E, 0x0005, 0x0033, 0x00A8, 0x005F, 0x00C4, 0x00F2, 0x0069,
+    0x0087, 0x001C, 0x002A, 0x00B1, 0x0046, 0x00DD, 0x00EB, 0x0070,
+    0x000B, 0x0090, 0x00A6, 0x003D, 0x00CA, 0x0051, 0x0067, 0x00FC,
+    0x0012, 0x0089, 0x00BF, 0x0024, 0x00D3, 0x0048, 0x007E, 0x00E5,
+    0x0039, 0x00A2, 0x0094, 0x000F, 0x00F8, 0x0063, 0x0055, 0x00CE,
+    0x0020, 0x00BB, 0x008D, 0x0016, 0x00E1, 0x007A, 0x004C, 0x00D7,
+    0x006F, 0x00F4, 0x00C2, 0x0059, 0x00AE, 0x0035, 0x0003, 0x0098,
+    0x0076, 0x00ED, 0x00DB, 0x0040, 0x00B7, 0x002C, 0x001A, 0x0081,
+    0x005D, 0x00C6, 0x00F0, 0x006B, 0x009C, 0x0007, 0x0031, 0x00AA,
+    0x0044, 0x00DF, 0x00E9, 0x0072, 0x0085, 0x001E, 0x0028, 0x00B3,
+    0x00C3, 0x0058, 0x006E, 0x00F5, 0x0002, 0x0099, 0x00AF, 0x0034,
+    0x00DA, 0x0041, 0x0077, 0x00EC, 0x001B, 0x0080, 0x00B6, 0x002D,
+    0x00F1, 0x006A, 0x005C, 0x00C7, 0x0030, 0x00AB, 0x009D, 0x0006,
+    0x00E8, 0x0073, 0x0045, 0x00DE, 0x0029, 0x00B2, 0x0084, 0x001F,
+    0x00A7, 0x003C, 0x000A, 0x0091, 0x0066, 0x00FD, 0x00CB, 0x0050,
+    0x00BE, 0x0025, 0x0013, 0x0088, 0x007F, 0x00E4, 0x00D2, 0x0049,
+    0x0095, 0x000E, 0x0038, 0x00A3, 0x0054, 0x00CF, 0x00F9, 0x0062,
+    0x008C, 0x0017, 0x0021, 0x00BA, 0x004D, 0x00D6, 0x00E0, 0x007B,
+};
+
+// CRC-8/DARC
+static const uint16_t crc_catalog_table_18[256] = {
+    0x0000, 0x0072, 0x00E4, 0x0096, 0x00F1, 0x0083, 0x0015, 0x0067,
+    0x00DB, 0x00A9, 0x003F, 0x004D, 0x002A, 0x0058, 0x00CE, 0x00BC,
+    0x008F, 0x00FD, 0x006B, 0x0019, 0x007E, 0x000C, 0x009A, 0x00E8,
+    0x0054, 0x0026, 0x00B0, 0x00C2, 0x00A5, 0x00D7, 0x0041, 0x0033,
+    0x0027, 0x0055, 0x00C3, 0x00B1, 0x00D6, 0x00A4, 0x0032, 0x0040,
+    0x00FC, 0x008E, 0x0018, 0x006A, 0x000D, 0x007F, 0x00E9, 0x009B,
+    0x00A8, 0x00DA, 0x004C, 0x003E, 0x0059, 0x002B, 0x00BD, 0x00CF,
+    0x0073, 0x0001, 0x0097, 0x00E5, 0x0082, 0x00F0, 0x0066, 0x0014,
+    0x004E, 0x003C, 0x00AA, 0x00D8, 0x00BF, 0x00CD, 0x005B, 0x0029,
+    0x0095, 0x00E7, 0x0071, 0x0003, 0x0064, 0x0016, 0x0080, 0x00F2,
+    0x00C1, 0x00B3, 0x0025, 0x0057, 0x0030, 0x0042, 0x00D4, 0x00A6,
+    0x001A, 0x0068, 0x00FE, 0x008C, 0x00EB, 0x0099, 0x000F, 0x007D,
+    0x0069, 0x001B, 0x008D, 0x00FF, 0x0098, 0x00EA, 0x007C, 0x000E,
+    0x00B2, 0x00C0, 0x0056, 0x0024, 0x0043, 0x0031, 0x00A7, 0x00D5,
+    0x00E6, 0x0094, 0x0002, 0x0070, 0x0017, 0x0065, 0x00F3, 0x0081,
+    0x003D, 0x004F, 0x00D9, 0x00AB, 0x00CC, 0x00BE, 0x0028, 0x005A,
+    0x009C, 0x00EE, 0x0078, 0x000A, 0x006D, 0x001F, 0x0089, 0x00FB,
+    0x0047, 0x0035, 0x00A3, 0x00D1, 0x00B6, 0x00C4, 0x0052, 0x0020,
+    0x0013, 0x0061, 0x00F7, 0x0085, 0x00E2, 0x0090, 0x0006, 0x0074,
+    0x00C8, 0x00BA, 0x002C, 0x005E, 0x0039, 0x004B, 0x00DD, 0x00AF,
+    0x00BB, 0x00C9, 0x005F, 0x002D, 0x004A, 0x0038, 0x00AE, 0x00DC,
+    0x0060, 0x0012, 0x0084, 0x00F6, 0x0091, 0x00E3, 0x0075, 0x0007,
+    0x0034, 0x0046, 0x00D0, 0x00A2, 0x00C5, 0x00B7, 0x0021, 0x0053,
+    0x00EF, 0x009D, 0x000B, 0x0079, 0x001E, 0x006C, 0x00FA, 0x0088,
+    0x00D2, 0x00A0, 0x0036, 0x0044, 0x0023, 0x0051, 0x00C7, 0x00B5,
+    0x0009, 0x007B, 0x00ED, 0x009F, 0x00F8, 0x008A, 0x001C, 0x006E,
+    0x005D, 0x002F, 0x00B9, 0x00CB, 0x00AC, 0x00DE, 0x0048, 0x003A,
+    0x0086, 0x00F4, 0x0062, 0x0010, 0x0077, 0x0005, 0x0093, 0x00E1,
+    0x00F5, 0x0087, 0x0011, 0x0063, 0x0004, 0x0076, 0x00E0, 0x0092,
+    0x002E, 0x005C, 0x00CA, 0x00B8, 0x00DF, 0x00AD, 0x003B, 0x0049,
+    0x007A, 0x0008, 0x009E, 0x00EC, 0x008B, 0x00F9, 0x006F, 0x001D,
+    0x00A1, 0x00D3, 0x0045, 0x0037, 0x0050, 0x0022, 0x00B4, 0x00C6,
+};
+
+// CRC-8/DVB-S2
+static const uint16_t crc_catalog_table_19[256] = {
+    0x0000, 0x00D5, 0x007F, 0x00AA, 0x00FE, 0x002B, 0x0081, 0x0054,
+    0x0029, 0x00FC, 0x0056, 0x0083, 0x00D7, 0x0002, 0x00A8, 0x007D,
+    0x0052, 0x0087, 0x002D, 0x00F8, 0x00AC, 0x0079, 0x00D3, 0x0006,
+    0x007B, 0x00AE, 0x0004, 0x00D1, 0x0085, 0x0050, 0x00FA, 0x002F,
+    0x00A4, 0x0071, 0x00DB, 0x000E, 0x005A, 0x008F, 0x0025, 0x00F0,
+    0x008D, 0x0058, 0x00F2, 0x0027, 0x0073, 0x00A6, 0x000C, 0x00D9,
+    0x00F6, 0x0023, 0x0089, 0x005C, 0x0008, 0x00DD, 0x0077, 0x00A2,
+    0x00DF, 0x000A, 0x00A0, 0x0075, 0x0021, 0x00F4, 0x005E, 0x008B,
+    0x009D, 0x0048, 0x00E2, 0x0037, 0x0063, 0x00B6, 0x001C, 0x00C9,
+    0x00B4, 0x0061, 0x00CB, 0x001E, 0x004A, 0x009F, 0x0035, 0x00E0,
+    0x00CF, 0x001A, 0x00B0, 0x0065, 0x0031, 0x00E4, 0x004E, 0x009B,
+    0x00E6, 0x0033, 0x0099, 0x004C, 0x0018, 0x00CD, 0x0067, 0x00B2,
+    0x0039, 0x00EC, 0x0046, 0x0093, 0x00C7, 0x0012, 0x00B8, 0x006D,
+    0x0010, 0x00C5, 0x006F, 0x00BA, 0x00EE, 0x003B, 0x0091, 0x0044,
+    0x006B, 0x00BE, 0x0014, 0x00C1, 0x0095, 0x0040, 0x00EA, 0x003F,
+    0x0042, 0x0097, 0x003D, 0x00E8, 0x00BC, 0x0069, 0x00C3, 0x0016,
+    0x00EF, 0x003A, 0x0090, 0x0045, 0x0011, 0x00C4, 0x006E, 0x00BB,
+    0x00C6, 0x0013, 0x00B9, 0x006C, 0x0038, 0x00ED, 0x0047, 0x0092,
+    0x00BD, 0x0068, 0x00C2, 0x0017, 0x0043, 0x0096, 0x003C, 0x00E9,
+    0x0094, 0x0041, 0x00EB, 0x003E, 0x006A, 0x00BF, 0x0015, 0x00C0,
+    0x004B, 0x009E, 0x0034, 0x00E1, 0x00B5, 0x0060, 0x00CA, 0x001F,
+    0x0062, 0x00B7, 0x001D, 0x00C8, 0x009C, 0x0049, 0x00E3, 0x0036,
+    0x0019, 0x00CC, 0x0066, 0x00B3, 0x00E7, 0x0032, 0x0098, 0x004D,
+    0x0030, 0x00E5, 0x004F, 0x009A, 0x00CE, 0x001B, 0x00B1, 0x0064,
+    0x0072, 0x00A7, 0x000D, 0x00D8, 0x008C, 0x0059, 0x00F3, 0x0026,
+    0x005B, 0x008E, 0x0024, 0x00F1, 0x00A5, 0x0070, 0x00DA, 0x000F,
+    0x0020, 0x00F5, 0x005F, 0x008A, 0x00DE, 0x000B, 0x00A1, 0x0074,
+    0x0009, 0x00DC, 0x0076, 0x00A3, 0x00F7, 0x0022, 0x0088, 0x005D,
+    0x00D6, 0x0003, 0x00A9, 0x007C, 0x0028, 0x00FD, 0x0057, 0x0082,
+    0x00FF, 0x002A, 0x0080, 0x0055, 0x0001, 0x00D4, 0x007E, 0x00AB,
+    0x0084, 0x0051, 0x00FB, 0x002E, 0x007A, 0x00AF, 0x0005, 0x00D0,
+    0x00AD, 0x0078, 0x00D2, 0x0007, 0x0053, 0x0086, 0x002C, 0x00F9,
+};
+
+// CRC-8/GSM-A
+static const uint16_t crc_catalog_table_20[256] = {
+    0x0000, 0x001D, 0x003A, 0x0027, 0x0074, 0x0069, 0x004E, 0x0053,
+    0x00E8, 0x00F5, 0x00D2, 0x00CF, 0x009C, 0x0081, 0x00A6, 0x00BB,
+    0x00CD, 0x00D0, 0x00F7, 0x00EA, 0x00B9, 0x00A4, 0x0083, 0x009E,
+    0x0025, 0x0038, 0x001F, 0x0002, 0x0051, 0x004C, 0x006B, 0x0076,
+    0x0087, 0x009A, 0x00BD, 0x00A0, 0x00F3, 0x00EE, 0x00C9, 0x00D4,
+    0x006F, 0x0072, 0x0055, 0x0048, 0x001B, 0x0006, 0x0021, 0x003C,
+    0x004A, 0x0057, 0x0070, 0x006D, 0x003E, 0x0023, 0x0004, 0x0019,
+    0x00A2, 0x00BF, 0x0098, 0x0085, 0x00D6, 0x00CB, 0x00EC, 0x00F1,
+    0x0013, 0x000E, 0x0029, 0x0034, 0x0067, 0x007A, 0x005D, 0x0040,
+    0x00FB, 0x00E6, 0x00C1, 0x00DC, 0x008F, 0x0092, 0x00B5, 0x00A8,
+    0x00DE, 0x00C3, 0x00E4, 0x00F9, 0x00AA, 0x00B7, 0x0090, 0x008D,
+    0x0036, 0x002B, 0x000C, 0x0011, 0x0042, 0x005F, 0x0078, 0x0065,
+    0x0094, 0x0089, 0x00AE, 0x00B3, 0x00E0, 0x00FD, 0x00DA, 0x00C7,
+    0x007C, 0x0061, 0x0046, 0x005B, 0x0008, 0x0015, 0x0032, 0x002F,
+    0x0059, 0x0044, 0x0063, 0x007E, 0x002D, 0x0030, 0x0017, 0x000A,
+    0x00B1, 0x00AC, 0x008B, 0x0096, 0x00C5, 0x00D8, 0x00FF, 0x00E2,
+    0x0026, 0x003B, 0x001C, 0x0001, 0x0052, 0x004F, 0x0068, 0x0075,
+    0x00CE, 0x00D3, 0x00F4, 0x00E9, 0x00BA, 0x00A7, 0x0080, 0x009D,
+    0x00EB, 0x00F6, 0x00D1, 0x00CC, 0x009F, 0x0082, 0x00A5, 0x00B8,
+    0x0003, 0x001E, 0x0039, 0x0024, 0x0077, 0x006A, 0x004D, 0x0050,
+    0x00A1, 0x00BC, 0x009B, 0x0086, 0x00D5, 0x00C8, 0x00EF, 0x00F2,
+    0x0049, 0x0054, 0x0073, 0x006E, 0x003D, 0x0020, 0x0007, 0x001A,
+    0x006C, 0x0071, 0x0056, 0x004B, 0x0018, 0x0005, 0x0022, 0x003F,
+    0x0084, 0x0099, 0x00BE, 0x00A3, 0x00F0, 0x00ED, 0x00CA, 0x00D7,
+    0x0035, 0x0028, 0x000F, 0x0012, 0x0041, 0x005C, 0x007B, 0x0066,
+    0x00DD, 0x00C0, 0x00E7, 0x00FA, 0x00A9, 0x00B4, 0x0093, 0x008E,
+    0x00F8, 0x00E5, 0x00C2, 0x00DF, 0x008C, 0x0091, 0x00B6, 0x00AB,
+    0x0010, 0x000D, 0x002A, 0x0037, 0x0064, 0x0079, 0x005E, 0x0043,
+    0x00B2, 0x00AF, 0x0088, 0x0095, 0x00C6, 0x00DB, 0x00FC, 0x00E1,
+    0x005A, 0x0047, 0x0060, 0x007D, 0x002E, 0x0033, 0x0014, 0x0009,
+    0x007F, 0x0062, 0x0045, 0x0058, 0x000B, 0x0016, 0x0031, 0x002C,
+    0x0097, 0x008A, 0x00AD, 0x00B0, 0x00E3, 0x00FE, 0x00D9, 0x00C4,
+};
+
+// CRC-8/GSM-B
+static const uint16_t crc_catalog_table_21[256] = {
+    0x0000, 0x0049, 0x0092, 0x00DB, 0x006D, 0x0024, 0x00FF, 0x00B6,
+    0x00DA, 0x0093, 0x0048, 0x0001, 0x00B7, 0x00FE, 0x0025, 0x006C,
+    0x00FD, 0x00B4, 0x006F, 0x0026, 0x0090, 0x00D9, 0x0002, 0x004B,
+    0x0027, 0x006E, 0x00B5, 0x00FC, 0x004A, 0x0003, 0x00D8, 0x0091,
+    0x00B3, 0x00FA, 0x0021, 0x0068, 0x00DE, 0x0097, 0x004C, 0x0005,
+    0x0069, 0x0020, 0x00FB, 0x00B2, 0x0004, 0x004D, 0x0096, 0x00DF,
+    0x004E, 0x0007, 0x00DC, 0x0095, 0x0023, 0x006A, 0x00B1, 0x00F8,
+    0x0094, 0x00DD, 0x0006, 0x004F, 0x00F9, 0x00B0, 0x006B, 0x0022,
+    0x002F, 0x0066, 0x00BD, 0x00F4, 0x0042, 0x000B, 0x00D0, 0x0099,
+    0x00F5, 0x00BC, 0x0067, 0x002E, 0x0098, 0x00D1, 0x000A, 0x0043,
+    0x00D2, 0x009B, 0x0040, 0x0009, 0x00BF, 0x00F6, 0x002D, 0x0064,
+    0x0008, 0x0041, 0x009A, 0x00D3, 0x0065, 0x002C, 0x00F7, 0x00BE,
+    0x009C, 0x00D5, 0x000E, 0x0047, 0x00F1, 0x00B8, 0x0063, 0x002A,
+    0x0046, 0x000F, 0x00D4, 0x009D, 0x002B, 0x0062, 0x00B9, 0x00F0,
+    0x0061, 0x0028, 0x00F3, 0x00BA, 0x000C, 0x0045, 0x009E, 0x00D7,
+    0x00BB, 0x00F2, 0x0029, 0x0060, 0x00D6, 0x009F, 0x0044, 0x000D,
+    0x005E, 0x0017, 0x00CC, 0x0085, 0x0033, 0x007A, 0x00A1, 0x00E8,
+    0x0084, 0x00CD, 0x0016, 0x005F, 0x00E9, 0x00A0, 0x007B, 0x0032,
+    0x00A3, 0x00EA, 0x0031, 0x0078, 0x00CE, 0x0087, 0x005C, 0x0015,
+    0x0079, 0x0030, 0x00EB, 0x00A2, 0x0014, 0x005D, 0x0086, 0x00CF,
+    0x00ED, 0x00A4, 0x007F, 0x0036, 0x0080, 0x00C9, 0x0012, 0x005B,
+    0x0037, 0x007E, 0x00A5, 0x00EC, 0x005A, 0x0013, 0x00C8, 0x0081,
+    0x0010, 0x0059, 0x0082, 0x00CB, 0x007D, 0x0034, 0x00EF, 0x00A6,
+    0x00CA, 0x0083, 0x0058, 0x0011, 0x00A7, 0x00EE, 0x0035, 0x007C,
+    0x0071, 0x0038, 0x00E3, 0x00AA, 0x001C, 0x0055, 0x008E, 0x00C7,
+    0x00AB, 0x00E2, 0x0039, 0x0070, 0x00C6, 0x008F, 0x0054, 0x001D,
+    0x008C, 0x00C5, 0x001E, 0x0057, 0x00E1, 0x00A8, 0x0073, 0x003A,
+    0x0056, 0x001F, 0x00C4, 0x008D, 0x003B, 0x0072, 0x00A9, 0x00E0,
+    0x00C2, 0x008B, 0x0050, 0x0019, 0x00AF, 0x00E6, 0x003D, 0x0074,
+    0x0018, 0x0051, 0x008A, 0x00C3, 0x0075, 0x003C, 0x00E7, 0x00AE,
+    0x003F, 0x0076, 0x00AD, 0x00E4, 0x0052, 0x001B, 0x00C0, 0x0089,
+    0x00E5, 0x00AC, 0x0077, 0x003E, 0x0088, 0x00C1, 0x001A, 0x0053,
+};
+
+// CRC-8/I-432-1
+static const uint16_t crc_catalog_table_23[256] = {
+    0x0000, 0x0007, 0x000E, 0x0009, 0x001C, 0x001B, 0x0012, 0x0015,
+    0x0038, 0x003F, 0x0036, 0x0031, 0x0024, 0x0023, 0x002A, 0x002D,
+    0x0070, 0x0077, 0x007E, 0x0079, 0x006C, 0x006B, 0x0062, 0x0065,
+    0x0048, 0x004F, 0x0046, 0x0041, 0x0054, 0x0053, 0x005A, 0x005D,
+    0x00E0, 0x00E7, 0x00EE, 0x00E9, 0x00FC, 0x00FB, 0x00F2, 0x00F5,
+    0x00D8, 0x00DF, 0x00D6, 0x00D1, 0x00C4, 0x00C3, 0x00CA, 0x00CD,
+    0x0090, 0x0097, 0x009E, 0x0099, 0x008C, 0x008B, 0x0082, 0x0085,
+    0x00A8, 0x00AF, 0x00A6, 0x00A1, 0x00B4, 0x00B3, 0x00BA, 0x00BD,
+    0x00C7, 0x00C0, 0x00C9, 0x00CE, 0x00DB, 0x00DC, 0x00D5, 0x00D2,
+    0x00FF, 0x00F8, 0x00F1, 0x00F6, 0x00E3, 0x00E4, 0x00ED, 0x00EA,
+    0x00B7, 0x00B0, 0x00B9, 0x00BE, 0x00AB, 0x00AC, 0x00A5, 0x00A2,
+    0x008F, 0x0088, 0x0081, 0x0086, 0x0093, 0x0094, 0x009D, 0x009A,
+    0x0027, 0x0020, 0x0029, 0x002E, 0x003B, 0x003C, 0x0035, 0x0032,
+    0x001F, 0x0018, 0x0011, 0x0016, 0x0003, 0x0004, 0x000D, 0x000A,
+    0x0057, 0x0050, 0x0059, 0x005E, 0x004B, 0x004C, 0x0045, 0x0042,
+    0x006F, 0x0068, 0x0061, 0x0066, 0x0073, 0x0074, 0x007D, 0x007A,
+    0x0089, 0x008E, 0x0087, 0x0080, 0x0095, 0x0092, 0x009B, 0x009C,
+    0x00B1, 0x00B6, 0x00BF, 0x00B8, 0x00AD, 0x00AA, 0x00A3, 0x00A4,
+    0x00F9, 0x00FE, 0x00F7, 0x00F0, 0x00E5, 0x00E2, 0x00EB, 0x00EC,
+    0x00C1, 0x00C6, 0x00CF, 0x00C8, 0x00DD, 0x00DA, 0x00D3, 0x00D4,
+    0x0069, 0x006E, 0x0067, 0x0060, 0x0075, 0x0072, 0x007B, 0x007C,
+    0x0051, 0x0056, 0x005F, 0x0058, 0x004D, 0x004A, 0x0043, 0x0044,
+    0x0019, 0x001E, 0x0017, 0x0010, 0x0005, 0x0002, 0x000B, 0x000C,
+    0x0021, 0x0026, 0x002F, 0x0028, 0x003D, 0x003A, 0x0033, 0x0034,
+    0x004E, 0x0049, 0x0040, 0x0047, 0x0052, 0x0055, 0x005C, 0x005B,
+    0x0076, 0x0071, 0x0078, 0x007F, 0x006A, 0x006D, 0x0064, 0x0063,
+    0x003E, 0x0039, 0x0030, 0x0037, 0x0022, 0x0025, 0x002C, 0x002B,
+    0x0006, 0x0001, 0x0008, 0x000F, 0x001A, 0x001D, 0x0014, 0x0013,
+    0x00AE, 0x00A9, 0x00A0, 0x00A7, 0x00B2, 0x00B5, 0x00BC, 0x00BB,
+    0x0096, 0x0091, 0x0098, 0x009F, 0x008A, 0x008D, 0x0084, 0x0083,
+    0x00DE, 0x00D9, 0x00D0, 0x00D7, 0x00C2, 0x00C5, 0x00CC, 0x00CB,
+    0x00E6, 0x00E1, 0x00E8, 0x00EF, 0x00FA, 0x00FD, 0x00F4, 0x00F3,
+};
+
+// CRC-8/MAXIM-DOW
+static const uint16_t crc_catalog_table_26[256] = {
+    0x0000, 0x005E, 0x00BC, 0x00E2, 0x0061, 0x003F, 0x00DD, 0x0083,
+    0x00C2, 0x009C, 0x007E, 0x0020, 0x00A3, 0x00FD, 0x001F, 0x0041,
+    0x009D, 0x00C3, 0x0021, 0x007F, 0x00FC, 0x00A2, 0x0040, 0x001E,
+    0x005F, 0x0001, 0x00E3, 0x00BD, 0x003E, 0x0060, 0x0082, 0x00DC,
+    0x0023, 0x007D, 0x009F, 0x00C1, 0x0042, 0x001C, 0x00FE, 0x00A0,
+    0x00E1, 0x00BF, 0x005D, 0x0003, 0x0080, 0x00DE, 0x003C, 0x0062,
+    0x00BE, 0x00E0, 0x0002, 0x005C, 0x00DF, 0x0081, 0x0063, 0x003D,
+    0x007C, 0x0022, 0x00C0, 0x009E, 0x001D, 0x0043, 0x00A1, 0x00FF,
+    0x0046, 0x0018, 0x00FA, 0x00A4, 0x0027, 0x0079, 0x009B, 0x00C5,
+    0x0084, 0x00DA, 0x0038, 0x0066, 0x00E5, 0x00BB, 0x0059, 0x0007,
+    0x00DB, 0x0085, 0x0067, 0x0039, 0x00BA, 0x00E4, 0x0006, 0x0058,
+    0x0019, 0x0047, 0x00A5, 0x00FB, 0x0078, 0x0026, 0x00C4, 0x009A,
+    0x0065, 0x003B, 0x00D9, 0x0087, 0x0004, 0x005A, 0x00B8, 0x00E6,
+    0x00A7, 0x00F9, 0x001B, 0x0045, 0x00C6, 0x0098, 0x007A, 0x0024,
+    0x00F8, 0x00A6, 0x0044, 0x001A, 0x0099, 0x00C7, 0x0025, 0x007B,
+    0x003A, 0x0064, 0x0086, 0x00D8, 0x005B, 0x0005, 0x00E7, 0x00B9,
+    0x008C, 0x00D2, 0x0030, 0x006E, 0x00ED, 0x00B3, 0x0051, 0x000F,
+    0x004E, 0x0010, 0x00F2, 0x00AC, 0x002F, 0x0071, 0x0093, 0x00CD,
+    0x0011, 0x004F, 0x00AD, 0x00F3, 0x0070, 0x002E, 0x00CC, 0x0092,
+    0x00D3, 0x008D, 0x006F, 0x0031, 0x00B2, 0x00EC, 0x000E, 0x0050,
+    0x00AF, 0x00F1, 0x0013, 0x004D, 0x00CE, 0x0090, 0x0072, 0x002C,
+    0x006D, 0x0033, 0x00D1, 0x008F, 0x000C, 0x0052, 0x00B0, 0x00EE,
+    0x0032, 0x006C, 0x008E, 0x00D0, 0x0053, 0x000D, 0x00EF, 0x00B1,
+    0x00F0, 0x00AE, 0x004C, 0x0012, 0x0091, 0x00CF, 0x002D, 0x0073,
+    0x00CA, 0x0094, 0x0076, 0x0028, 0x00AB, 0x00F5, 0x0017, 0x0049,
+    0x0008, 0x0056, 0x00B4, 0x00EA, 0x0069, 0x0037, 0x00D5, 0x008B,
+    0x0057, 0x0009, 0x00EB, 0x00B5, 0x0036, 0x0068, 0x008A, 0x00D4,
+    0x0095, 0x00CB, 0x0029, 0x0077, 0x00F4, 0x00AA, 0x0048, 0x0016,
+    0x00E9, 0x00B7, 0x0055, 0x000B, 0x0088, 0x00D6, 0x0034, 0x006A,
+    0x002B, 0x0075, 0x0097, 0x00C9, 0x004A, 0x0014, 0x00F6, 0x00A8,
+    0x0074, 0x002A, 0x00C8, 0x0096, 0x0015, 0x004B, 0x00A9, 0x00F7,
+    0x00B6, 0x00E8, 0x000A, 0x0054, 0x00D7, 0x0089, 0x006B, 0x0035,
+};
+
+// CRC-8/NRSC-5
+static const uint16_t crc_catalog_table_28[256] = {
+    0x0000, 0x0031, 0x0062, 0x0053, 0x00C4, 0x00F5, 0x00A6, 0x0097,
+    0x00B9, 0x0088, 0x00DB, 0x00EA, 0x007D, 0x004C, 0x001F, 0x002E,
+    0x0043, 0x0072, 0x0021, 0x0010, 0x0087, 0x00B6, 0x00E5, 0x00D4,
+    0x00FA, 0x00CB, 0x0098, 0x00A9, 0x003E, 0x000F, 0x005C, 0x006D,
+    0x0086, 0x00B7, 0x00E4, 0x00D5, 0x0042, 0x0073, 0x0020, 0x0011,
+    0x003F, 0x000E, 0x005D, 0x006C, 0x00FB, 0x00CA, 0x0099, 0x00A8,
+    0x00C5, 0x00F4, 0x00A7, 0x0096, 0x0001, 0x0030, 0x0063, 0x0052,
+    0x007C, 0x004D, 0x001E, 0x002F, 0x00B8, 0x0089, 0x00DA, 0x00EB,
+    0x003D, 0x000C, 0x005F, 0x006E, 0x00F9, 0x00C8, 0x009B, 0x00AA,
+    0x0084, 0x00B5, 0x00E6, 0x00D7, 0x0040, 0x0071, 0x0022, 0x0013,
+    0x007E, 0x004F, 0x001C, 0x002D, 0x00BA, 0x008B, 0x00D8, 0x00E9,
+    0x00C7, 0x00F6, 0x00A5, 0x0094, 0x0003, 0x0032, 0x0061, 0x0050,
+    0x00BB, 0x008A, 0x00D9, 0x00E8, 0x007F, 0x004E, 0x001D, 0x002C,
+    0x0002, 0x0033, 0x0060, 0x0051, 0x00C6, 0x00F7, 0x00A4, 0x0095,
+    0x00F8, 0x00C9, 0x009A, 0x00AB, 0x003C, 0x000D, 0x005E, 0x006F,
+    0x0041, 0x0070, 0x0023, 0x0012, 0x0085, 0x00B4, 0x00E7, 0x00D6,
+    0x007A, 0x004B, 0x0018, 0x0029, 0x00BE, 0x008F, 0x00DC, 0x00ED,
+    0x00C3, 0x00F2, 0x00A1, 0x0090, 0x0007, 0x0036, 0x0065, 0x0054,
+    0x0039, 0x0008, 0x005B, 0x006A, 0x00FD, 0x00CC, 0x009F, 0x00AE,
+    0x0080, 0x00B1, 0x00E2, 0x00D3, 0x0044, 0x0075, 0x0026, 0x0017,
+    0x00FC, 0x00CD, 0x009E, 0x00AF, 0x0038, 0x0009, 0x005A, 0x006B,
+    0x0045, 0x0074, 0x0027, 0x0016, 0x0081, 0x00B0, 0x00E3, 0x00D2,
+    0x00BF, 0x008E, 0x00DD, 0x00EC, 0x007B, 0x004A, 0x0019, 0x0028,
+    0x0006, 0x0037, 0x0064, 0x0055, 0x00C2, 0x00F3, 0x00A0, 0x0091,
+    0x0047, 0x0076, 0x0025, 0x0014, 0x0083, 0x00B2, 0x00E1, 0x00D0,
+    0x00FE, 0x00CF, 0x009C, 0x00AD, 0x003A, 0x000B, 0x0058, 0x0069,
+    0x0004, 0x0035, 0x0066, 0x0057, 0x00C0, 0x00F1, 0x00A2, 0x0093,
+    0x00BD, 0x008C, 0x00DF, 0x00EE, 0x0079, 0x0048, 0x001B, 0x002A,
+    0x00C1, 0x00F0, 0x00A3, 0x0092, 0x0005, 0x0034, 0x0067, 0x0056,
+    0x0078, 0x0049, 0x001A, 0x002B, 0x00BC, 0x008D, 0x00DE, 0x00EF,
+    0x0082, 0x00B3, 0x00E0, 0x00D1, 0x0046, 0x0077, 0x0024, 0x0015,
+    0x003B, 0x000A, 0x0059, 0x0068, 0x00FF, 0x00CE, 0x009D, 0x00AC,
+};
+
+// CRC-8/ROHC
+static const uint16_t crc_catalog_table_30[256] = {
+    0x0000, 0x0091, 0x00E3, 0x0072, 0x0007, 0x0096, 0x00E4, 0x0075,
+    0x000E, 0x009F, 0x00ED, 0x007C, 0x0009, 0x0098, 0x00EA, 0x007B,
+    0x001C, 0x008D, 0x00FF, 0x006E, 0x001B, 0x008A, 0x00F8, 0x0069,
+    0x0012, 0x0083, 0x00F1, 0x0060, 0x0015, 0x0084, 0x00F6, 0x0067,
+    0x0038, 0x00A9, 0x00DB, 0x004A, 0x003F, 0x00AE, 0x00DC, 0x004D,
+    0x0036, 0x00A7, 0x00D5, 0x0044, 0x0031, 0x00A0, 0x00D2, 0x0043,
+    0x0024, 0x00B5, 0x00C7, 0x0056, 0x0023, 0x00B2, 0x00C0, 0x0051,
+    0x002A, 0x00BB, 0x00C9, 0x0058, 0x002D, 0x00BC, 0x00CE, 0x005F,
+    0x0070, 0x00E1, 0x0093, 0x0002, 0x0077, 0x00E6, 0x0094, 0x0005,
+    0x007E, 0x00EF, 0x009D, 0x000C, 0x0079, 0x00E8, 0x009A, 0x000B,
+    0x006C, 0x00FD, 0x008F, 0x001E, 0x006B, 0x00FA, 0x0088, 0x0019,
+    0x0062, 0x00F3, 0x0081, 0x0010, 0x0065, 0x00F4, 0x0086, 0x0017,
+    0x0048, 0x00D9, 0x00AB, 0x003A, 0x004F, 0x00DE, 0x00AC, 0x003D,
+    0x0046, 0x00D7, 0x00A5, 0x0034, 0x0041, 0x00D0, 0x00A2, 0x0033,
+    0x0054, 0x00C5, 0x00B7, 0x0026, 0x0053, 0x00C2, 0x00B0, 0x0021,
+    0x005A, 0x00CB, 0x00B9, 0x0028, 0x005D, 0x00CC, 0x00BE, 0x002F,
+    0x00E0, 0x0071, 0x0003, 0x0092, 0x00E7, 0x0076, 0x0004, 0x0095,
+    0x00EE, 0x007F, 0x000D, 0x009C, 0x00E9, 0x0078, 0x000A, 0x009B,
+    0x00FC, 0x006D, 0x001F, 0x008E, 0x00FB, 0x006A, 0x0018, 0x0089,
+    0x00F2, 0x0063, 0x0011, 0x0080, 0x00F5, 0x0064, 0x0016, 0x0087,
+    0x00D8, 0x0049, 0x003B, 0x00AA, 0x00DF, 0x004E, 0x003C, 0x00AD,
+    0x00D6, 0x0047, 0x0035, 0x00A4, 0x00D1, 0x0040, 0x0032, 0x00A3,
+    0x00C4, 0x0055, 0x0027, 0x00B6, 0x00C3, 0x0052, 0x0020, 0x00B1,
+    0x00CA, 0x005B, 0x0029, 0x00B8, 0x00CD, 0x005C, 0x002E, 0x00BF,
+    0x0090, 0x0001, 0x0073, 0x00E2, 0x0097, 0x0006, 0x0074, 0x00E5,
+    0x009E, 0x000F, 0x007D, 0x00EC, 0x0099, 0x0008, 0x007A, 0x00EB,
+    0x008C, 0x001D, 0x006F, 0x00FE, 0x008B, 0x001A, 0x0068, 0x00F9,
+    0x0082, 0x0013, 0x0061, 0x00F0, 0x0085, 0x0014, 0x0066, 0x00F7,
+    0x00A8, 0x0039, 0x004B, 0x00DA, 0x00AF, 0x003E, 0x004C, 0x00DD,
+    0x00A6, 0x0037, 0x0045, 0x00D4, 0x00A1, 0x0030, 0x0042, 0x00D3,
+    0x00B4, 0x0025, 0x0057, 0x00C6, 0x00B3, 0x0022, 0x0050, 0x00C1,
+    0x00BA, 0x002B, 0x0059, 0x00C8, 0x00BD, 0x002C, 0x005E, 0x00CF,
+};
+
+// CRC-8/TECH-3250
+static const uint16_t crc_catalog_table_33[256] = {
+    0x0000, 0x0064, 0x00C8, 0x00AC, 0x00E1, 0x0085, 0x0029, 0x004D,
+    0x00B3, 0x00D7, 0x007B, 0x001F, 0x0052, 0x0036, 0x009A, 0x00FE,
+    0x0017, 0x0073, 0x00DF, 0x00BB, 0x00F6, 0x0092, 0x003E, 0x005A,
+    0x00A4, 0x00C0, 0x006C, 0x0008, 0x0045, 0x0021, 0x008D, 0x00E9,
+    0x002E, 0x004A, 0x00E6, 0x0082, 0x00CF, 0x00AB, 0x0007, 0x0063,
+    0x009D, 0x00F9, 0x0055, 0x0031, 0x007C, 0x0018, 0x00B4, 0x00D0,
+    0x0039, 0x005D, 0x00F1, 0x0095, 0x00D8, 0x00BC, 0x0010, 0x0074,
+    0x008A, 0x00EE, 0x0042, 0x0026, 0x006B, 0x000F, 0x00A3, 0x00C7,
+    0x005C, 0x0038, 0x0094, 0x00F0, 0x00BD, 0x00D9, 0x0075, 0x0011,
+    0x00EF, 0x008B, 0x0027, 0x0043, 0x000E, 0x006A, 0x00C6, 0x00A2,
+    0x004B, 0x002F, 0x0083, 0x00E7, 0x00AA, 0x00CE, 0x0062, 0x0006,
+    0x00F8, 0x009C, 0x0030, 0x0054, 0x0019, 0x007D, 0x00D1, 0x00B5,
+    0x0072, 0x0016, 0x00BA, 0x00DE, 0x0093, 0x00F7, 0x005B, 0x003F,
+    0x00C1, 0x00A5, 0x0009, 0x006D, 0x0020, 0x0044, 0x00E8, 0x008C,
+    0x0065, 0x0001, 0x00AD, 0x00C9, 0x0084, 0x00E0, 0x004C, 0x0028,
+    0x00D6, 0x00B2, 0x001E, 0x007A, 0x0037, 0x0053, 0x00FF, 0x009B,
+    0x00B8, 0x00DC, 0x0070, 0x0014, 0x0059, 0x003D, 0x0091, 0x00F5,
+    0x000B, 0x006F, 0x00C3, 0x00A7, 0x00EA, 0x008E, 0x0022, 0x0046,
+    0x00AF, 0x00CB, 0x0067, 0x0003, 0x004E, 0x002A, 0x0086, 0x00E2,
+    0x001C, 0x0078, 0x00D4, 0x00B0, 0x00FD, 0x0099, 0x0035, 0x0051,
+    0x0096, 0x00F2, 0x005E, 0x003A, 0x0077, 0x0013, 0x00BF, 0x00DB,
+    0x0025, 0x0041, 0x00ED, 0x0089, 0x00C4, 0x00A0, 0x000C, 0x0068,
+    0x0081, 0x00E5, 0x0049, 0x002D, 0x0060, 0x0004, 0x00A8, 0x00CC,
+    0x0032, 0x0056, 0x00FA, 0x009E, 0x00D3, 0x00B7, 0x001B, 0x007F,
+    0x00E4, 0x0080, 0x002C, 0x0048, 0x0005, 0x0061, 0x00CD, 0x00A9,
+    0x0057, 0x0033, 0x009F, 0x00FB, 0x00B6, 0x00D2, 0x007E, 0x001A,
+    0x00F3, 0x0097, 0x003B, 0x005F, 0x0012, 0x0076, 0x00DA, 0x00BE,
+    0x0040, 0x0024, 0x0088, 0x00EC, 0x00A1, 0x00C5, 0x0069, 0x000D,
+    0x00CA, 0x00AE, 0x0002, 0x0066, 0x002B, 0x004F, 0x00E3, 0x0087,
+    0x0079, 0x001D, 0x00B1, 0x00D5, 0x0098, 0x00FC, 0x0050, 0x0034,
+    0x00DD, 0x00B9, 0x0015, 0x0071, 0x003C, 0x0058, 0x00F4, 0x0090,
+    0x006E, 0x000A, 0x00A6, 0x00C2, 0x008F, 0x00EB, 0x0047, 0x0023,
+};
+
+// CRC-8/WCDMA
+static const uint16_t crc_catalog_table_34[256] = {
+    0x0000, 0x00D0, 0x0013, 0x00C3, 0x0026, 0x00F6, 0x0035, 0x00E5,
+    0x004C, 0x009C, 0x005F, 0x008F, 0x006A, 0x00BA, 0x0079, 0x00A9,
+    0x0098, 0x0048, 0x008B, 0x005B, 0x00BE, 0x006E, 0x00AD, 0x007D,
+    0x00D4, 0x0004, 0x00C7, 0x0017, 0x00F2, 0x0022, 0x00E1, 0x0031,
+    0x0083, 0x0053, 0x0090, 0x0040, 0x00A5, 0x0075, 0x00B6, 0x0066,
+    0x00CF, 0x001F, 0x00DC, 0x000C, 0x00E9, 0x0039, 0x00FA, 0x002A,
+    0x001B, 0x00CB, 0x0008, 0x00D8, 0x003D, 0x00ED, 0x002E, 0x00FE,
+    0x0057, 0x0087, 0x0044, 0x0094, 0x0071, 0x00A1, 0x0062, 0x00B2,
+    0x00B5, 0x0065, 0x00A6, 0x0076, 0x0093, 0x0043, 0x0080, 0x0050,
+    0x00F9, 0x0029, 0x00EA, 0x003A, 0x00DF, 0x000F, 0x00CC, 0x001C,
+    0x002D, 0x00FD, 0x003E, 0x00EE, 0x000B, 0x00DB, 0x0018, 0x00C8,
+    0x0061, 0x00B1, 0x0072, 0x00A2, 0x0047, 0x0097, 0x0054, 0x0084,
+    0x0036, 0x00E6, 0x0025, 0x00F5, 0x0010, 0x00C0, 0x0003, 0x00D3,
+    0x007A, 0x00AA, 0x0069, 0x00B9, 0x005C, 0x008C, 0x004F, 0x009F,
+    0x00AE, 0x007E, 0x00BD, 0x006D, 0x0088, 0x0058, 0x009B, 0x004B,
+    0x00E2, 0x0032, 0x00F1, 0x0021, 0x00C4, 0x0014, 0x00D7, 0x0007,
+    0x00D9, 0x0009, 0x00CA, 0x001A, 0x00FF, 0x002F, 0x00EC, 0x003C,
+    0x0095, 0x0045, 0x0086, 0x0056, 0x00B3, 0x0063, 0x00A0, 0x0070,
+    0x0041, 0x0091, 0x0052, 0x0082, 0x0067, 0x00B7, 0x0074, 0x00A4,
+    0x000D, 0x00DD, 0x001E, 0x00CE, 0x002B, 0x00FB, 0x0038, 0x00E8,
+    0x005A, 0x008A, 0x0049, 0x0099, 0x007C, 0x00AC, 0x006F, 0x00BF,
+    0x0016, 0x00C6, 0x0005, 0x00D5, 0x0030, 0x00E0, 0x0023, 0x00F3,
+    0x00C2, 0x0012, 0x00D1, 0x0001, 0x00E4, 0x0034, 0x00F7, 0x0027,
+    0x008E, 0x005E, 0x009D, 0x004D, 0x00A8, 0x0078, 0x00BB, 0x006B,
+    0x006C, 0x00BC, 0x007F, 0x00AF, 0x004A, 0x009A, 0x0059, 0x0089,
+    0x0020, 0x00F0, 0x0033, 0x00E3, 0x0006, 0x00D6, 0x0015, 0x00C5,
+    0x00F4, 0x0024, 0x00E7, 0x0037, 0x00D2, 0x0002, 0x00C1, 0x0011,
+    0x00B8, 0x0068, 0x00AB, 0x007B, 0x009E, 0x004E, 0x008D, 0x005D,
+    0x00EF, 0x003F, 0x00FC, 0x002C, 0x00C9, 0x0019, 0x00DA, 0x000A,
+    0x00A3, 0x0073, 0x00B0, 0x0060, 0x0085, 0x0055, 0x0096, 0x0046,
+    0x0077, 0x00A7, 0x0064, 0x00B4, 0x0051, 0x0081, 0x0042, 0x0092,
+    0x003B, 0x00EB, 0x0028, 0x00F8, 0x001D, 0x00CD, 0x000E, 0x00DE,
+};
+
+// CRC-10/ATM
+static const uint16_t crc_catalog_table_35[256] = {
+    0x0000, 0x8CC0, 0x9540, 0x1980, 0xA640, 0x2A80, 0x3300, 0xBFC0,
+    0xC040, 0x4C80, 0x5500, 0xD9C0, 0x6600, 0xEAC0, 0xF340, 0x7F80,
+    0x0C40, 0x8080, 0x9900, 0x15C0, 0xAA00, 0x26C0, 0x3F40, 0xB380,
+    0xCC00, 0x40C0, 0x5940, 0xD580, 0x6A40, 0xE680, 0xFF00, 0x73C0,
+    0x1880, 0x9440, 0x8DC0, 0x0100, 0xBEC0, 0x3200, 0x2B80, 0xA740,
+    0xD8C0, 0x5400, 0x4D80, 0xC140, 0x7E80, 0xF240, 0xEBC0, 0x6700,
+    0x14C0, 0x9800, 0x8180, 0x0D40, 0xB280, 0x3E40, 0x27C0, 0xAB00,
+    0xD480, 0x5840, 0x41C0, 0xCD00, 0x72C0, 0xFE00, 0xE780, 0x6B40,
+    0x3100, 0xBDC0, 0xA440, 0x2880, 0x9740, 0x1B80, 0x0200, 0x8EC0,
+    0xF140, 0x7D80, 0x6400, 0xE8C0, 0x5700, 0xDBC0, 0xC240, 0x4E80,
+    0x3D40, 0xB180, 0xA800, 0x24C0, 0x9B00, 0x17C0, 0x0E40, 0x8280,
+    0xFD00, 0x71C0, 0x6840, 0xE480, 0x5B40, 0xD780, 0xCE00, 0x42C0,
+    0x2980, 0xA540, 0xBCC0, 0x3000, 0x8FC0, 0x0300, 0x1A80, 0x9640,
+    0xE9C0, 0x6500, 0x7C80, 0xF040, 0x4F80, 0xC340, 0xDAC0, 0x5600,
+    0x25C0, 0xA900, 0xB080, 0x3C40, 0x8380, 0x0F40, 0x16C0, 0x9A00,
+    0xE580, 0x6940, 0x70C0, 0xFC00, 0x43C0, 0xCF00, 0xD680, 0x5A40,
+    0x6200, 0xEEC0, 0xF740, 0x7B80, 0xC440, 0x4880, 0x5100, 0xDDC0,
+    0xA240, 0x2E80, 0x3700, 0xBBC0, 0x0400, 0x88C0, 0x9140, 0x1D80,
+    0x6E40, 0xE280, 0xFB00, 0x77C0, 0xC800, 0x44C0, 0x5D40, 0xD180,
+    0xAE00, 0x22C0, 0x3B40, 0xB780, 0x0840, 0x8480, 0x9D00, 0x11C0,
+    0x7A80, 0xF640, 0xEFC0, 0x6300, 0xDCC0, 0x5000, 0x4980, 0xC540,
+    0xBAC0, 0x3600, 0x2F80, 0xA340, 0x1C80, 0x9040, 0x89C0, 0x0500,
+    0x76C0, 0xFA00, 0xE380, 0x6F40, 0xD080, 0x5C40, 0x45C0, 0xC900,
+    0xB680, 0x3A40, 0x23C0, 0xAF00, 0x10C0, 0x9C00, 0x8580, 0x0940,
+    0x5300, 0xDFC0, 0xC640, 0x4A80, 0xF540, 0x7980, 0x6000, 0xECC0,
+    0x9340, 0x1F80, 0x0600, 0x8AC0, 0x3500, 0xB9C0, 0xA040, 0x2C80,
+    0x5F40, 0xD380, 0xCA00, 0x46C0, 0xF900, 0x75C0, 0x6C40, 0xE080,
+    0x9F00, 0x13C0, 0x0A40, 0x8680, 0x3940, 0xB580, 0xAC00, 0x20C0,
+    0x4B80, 0xC740, 0xDEC0, 0x5200, 0xEDC0, 0x6100, 0x7880, 0xF440,
+    0x8BC0, 0x0700, 0x1E80, 0x9240, 0x2D80, 0xA140, 0xB8C0, 0x3400,
+    0x47C0, 0xCB00, 0xD280, 0x5E40, 0xE180, 0x6D40, 0x74C0, 0xF800,
+    0x8780, 0x0B40, 0x12C0, 0x9E00, 0x21C0, 0xAD00, 0xB480, 0x3840,
+};
+
+// CRC-10/CDMA2000
+static const uint16_t crc_catalog_table_36[256] = {
+    0x0000, 0xF640, 0x1AC0, 0xEC80, 0x3580, 0xC3C0, 0x2F40, 0xD900,
+    0x6B00, 0x9D40, 0x71C0, 0x8780, 0x5E80, 0xA8C0, 0x4440, 0xB200,
+    0xD600, 0x2040, 0xCCC0, 0x3A80, 0xE380, 0x15C0, 0xF940, 0x0F00,
+    0xBD00, 0x4B40, 0xA7C0, 0x5180, 0x8880, 0x7EC0, 0x9240, 0x6400,
+    0x5A40, 0xAC00, 0x4080, 0xB6C0, 0x6FC0, 0x9980, 0x7500, 0x8340,
+    0x3140, 0xC700, 0x2B80, 0xDDC0, 0x04C0, 0xF280, 0x1E00, 0xE840,
+    0x8C40, 0x7A00, 0x9680, 0x60C0, 0xB9C0, 0x4F80, 0xA300, 0x5540,
+    0xE740, 0x1100, 0xFD80, 0x0BC0, 0xD2C0, 0x2480, 0xC800, 0x3E40,
+    0xB480, 0x42C0, 0xAE40, 0x5800, 0x8100, 0x7740, 0x9BC0, 0x6D80,
+    0xDF80, 0x29C0, 0xC540, 0x3300, 0xEA00, 0x1C40, 0xF0C0, 0x0680,
+    0x6280, 0x94C0, 0x7840, 0x8E00, 0x5700, 0xA140, 0x4DC0, 0xBB80,
+    0x0980, 0xFFC0, 0x1340, 0xE500, 0x3C00, 0xCA40, 0x26C0, 0xD080,
+    0xEEC0, 0x1880, 0xF400, 0x0240, 0xDB40, 0x2D00, 0xC180, 0x37C0,
+    0x85C0, 0x7380, 0x9F00, 0x6940, 0xB040, 0x4600, 0xAA80, 0x5CC0,
+    0x38C0, 0xCE80, 0x2200, 0xD440, 0x0D40, 0xFB00, 0x1780, 0xE1C0,
+    0x53C0, 0xA580, 0x4900, 0xBF40, 0x6640, 0x9000, 0x7C80, 0x8AC0,
+    0x9F40, 0x6900, 0x8580, 0x73C0, 0xAAC0, 0x5C80, 0xB000, 0x4640,
+    0xF440, 0x0200, 0xEE80, 0x18C0, 0xC1C0, 0x3780, 0xDB00, 0x2D40,
+    0x4940, 0xBF00, 0x5380, 0xA5C0, 0x7CC0, 0x8A80, 0x6600, 0x9040,
+    0x2240, 0xD400, 0x3880, 0xCEC0, 0x17C0, 0xE180, 0x0D00, 0xFB40,
+    0xC500, 0x3340, 0xDFC0, 0x2980, 0xF080, 0x06C0, 0xEA40, 0x1C00,
+    0xAE00, 0x5840, 0xB4C0, 0x4280, 0x9B80, 0x6DC0, 0x8140, 0x7700,
+    0x1300, 0xE540, 0x09C0, 0xFF80, 0x2680, 0xD0C0, 0x3C40, 0xCA00,
+    0x7800, 0x8E40, 0x62C0, 0x9480, 0x4D80, 0xBBC0, 0x5740, 0xA100,
+    0x2BC0, 0xDD80, 0x3100, 0xC740, 0x1E40, 0xE800, 0x0480, 0xF2C0,
+    0x40C0, 0xB680, 0x5A00, 0xAC40, 0x7540, 0x8300, 0x6F80, 0x99C0,
+    0xFDC0, 0x0B80, 0xE700, 0x1140, 0xC840, 0x3E00, 0xD280, 0x24C0,
+    0x96C0, 0x6080, 0x8C00, 0x7A40, 0xA340, 0x5500, 0xB980, 0x4FC0,
+    0x7180, 0x87C0, 0x6B40, 0x9D00, 0x4400, 0xB240, 0x5EC0, 0xA880,
+    0x1A80, 0xECC0, 0x0040, 0xF600, 0x2F00, 0xD940, 0x35C0, 0xC380,
+    0xA780, 0x51C0, 0xBD40, 0x4B00, 0x9200, 0x6440, 0x88C0, 0x7E80,
+    0xCC80, 0x3AC0, 0xD640, 0x2000, 0xF900, 0x0F40, 0xE3C0, 0x1580,
+};
+
+// CRC-10/GSM
+static const uint16_t crc_catalog_table_37[256] = {
+    0x0000, 0x5D40, 0xBA80, 0xE7C0, 0x2840, 0x7500, 0x92C0, 0xCF80,
+    0x5080, 0x0DC0, 0xEA00, 0xB740, 0x78C0, 0x2580, 0xC240, 0x9F00,
+    0xA100, 0xFC40, 0x1B80, 0x46C0, 0x8940, 0xD400, 0x33C0, 0x6E80,
+    0xF180, 0xACC0, 0x4B00, 0x1640, 0xD9C0, 0x8480, 0x6340, 0x3E00,
+    0x1F40, 0x4200, 0xA5C0, 0xF880, 0x3700, 0x6A40, 0x8D80, 0xD0C0,
+    0x4FC0, 0x1280, 0xF540, 0xA800, 0x6780, 0x3AC0, 0xDD00, 0x8040,
+    0xBE40, 0xE300, 0x04C0, 0x5980, 0x9600, 0xCB40, 0x2C80, 0x71C0,
+    0xEEC0, 0xB380, 0x5440, 0x0900, 0xC680, 0x9BC0, 0x7C00, 0x2140,
+    0x3E80, 0x63C0, 0x8400, 0xD940, 0x16C0, 0x4B80, 0xAC40, 0xF100,
+    0x6E00, 0x3340, 0xD480, 0x89C0, 0x4640, 0x1B00, 0xFCC0, 0xA180,
+    0x9F80, 0xC2C0, 0x2500, 0x7840, 0xB7C0, 0xEA80, 0x0D40, 0x5000,
+    0xCF00, 0x9240, 0x7580, 0x28C0, 0xE740, 0xBA00, 0x5DC0, 0x0080,
+    0x21C0, 0x7C80, 0x9B40, 0xC600, 0x0980, 0x54C0, 0xB300, 0xEE40,
+    0x7140, 0x2C00, 0xCBC0, 0x9680, 0x5900, 0x0440, 0xE380, 0xBEC0,
+    0x80C0, 0xDD80, 0x3A40, 0x6700, 0xA880, 0xF5C0, 0x1200, 0x4F40,
+    0xD040, 0x8D00, 0x6AC0, 0x3780, 0xF800, 0xA540, 0x4280, 0x1FC0,
+    0x7D00, 0x2040, 0xC780, 0x9AC0, 0x5540, 0x0800, 0xEFC0, 0xB280,
+    0x2D80, 0x70C0, 0x9700, 0xCA40, 0x05C0, 0x5880, 0xBF40, 0xE200,
+    0xDC00, 0x8140, 0x6680, 0x3BC0, 0xF440, 0xA900, 0x4EC0, 0x1380,
+    0x8C80, 0xD1C0, 0x3600, 0x6B40, 0xA4C0, 0xF980, 0x1E40, 0x4300,
+    0x6240, 0x3F00, 0xD8C0, 0x8580, 0x4A00, 0x1740, 0xF080, 0xADC0,
+    0x32C0, 0x6F80, 0x8840, 0xD500, 0x1A80, 0x47C0, 0xA000, 0xFD40,
+    0xC340, 0x9E00, 0x79C0, 0x2480, 0xEB00, 0xB640, 0x5180, 0x0CC0,
+    0x93C0, 0xCE80, 0x2940, 0x7400, 0xBB80, 0xE6C0, 0x0100, 0x5C40,
+    0x4380, 0x1EC0, 0xF900, 0xA440, 0x6BC0, 0x3680, 0xD140, 0x8C00,
+    0x1300, 0x4E40, 0xA980, 0xF4C0, 0x3B40, 0x6600, 0x81C0, 0xDC80,
+    0xE280, 0xBFC0, 0x5800, 0x0540, 0xCAC0, 0x9780, 0x7040, 0x2D00,
+    0xB200, 0xEF40, 0x0880, 0x55C0, 0x9A40, 0xC700, 0x20C0, 0x7D80,
+    0x5CC0, 0x0180, 0xE640, 0xBB00, 0x7480, 0x29C0, 0xCE00, 0x9340,
+    0x0C40, 0x5100, 0xB6C0, 0xEB80, 0x2400, 0x7940, 0x9E80, 0xC3C0,
+    0xFDC0, 0xA080, 0x4740, 0x1A00, 0xD580, 0x88C0, 0x6F00, 0x3240,
+    0xAD40, 0xF000, 0x17C0, 0x4A80, 0x8500, 0xD840, 0x3F80, 0x62C0,
+};
+
+// CRC-11/FLEXRAY
+static const uint16_t crc_catalog_table_38[256] = {
+    0x0000, 0x70A0, 0xE140, 0x91E0, 0xB220, 0xC280, 0x5360, 0x23C0,
+    0x14E0, 0x6440, 0xF5A0, 0x8500, 0xA6C0, 0xD660, 0x4780, 0x3720,
+    0x29C0, 0x5960, 0xC880, 0xB820, 0x9BE0, 0xEB40, 0x7AA0, 0x0A00,
+    0x3D20, 0x4D80, 0xDC60, 0xACC0, 0x8F00, 0xFFA0, 0x6E40, 0x1EE0,
+    0x5380, 0x2320, 0xB2C0, 0xC260, 0xE1A0, 0x9100, 0x00E0, 0x7040,
+    0x4760, 0x37C0, 0xA620, 0xD680, 0xF540, 0x85E0, 0x1400, 0x64A0,
+    0x7A40, 0x0AE0, 0x9B00, 0xEBA0, 0xC860, 0xB8C0, 0x2920, 0x5980,
+    0x6EA0, 0x1E00, 0x8FE0, 0xFF40, 0xDC80, 0xAC20, 0x3DC0, 0x4D60,
+    0xA700, 0xD7A0, 0x4640, 0x36E0, 0x1520, 0x6580, 0xF460, 0x84C0,
+    0xB3E0, 0xC340, 0x52A0, 0x2200, 0x01C0, 0x7160, 0xE080, 0x9020,
+    0x8EC0, 0xFE60, 0x6F80, 0x1F20, 0x3CE0, 0x4C40, 0xDDA0, 0xAD00,
+    0x9A20, 0xEA80, 0x7B60, 0x0BC0, 0x2800, 0x58A0, 0xC940, 0xB9E0,
+    0xF480, 0x8420, 0x15C0, 0x6560, 0x46A0, 0x3600, 0xA7E0, 0xD740,
+    0xE060, 0x90C0, 0x0120, 0x7180, 0x5240, 0x22E0, 0xB300, 0xC3A0,
+    0xDD40, 0xADE0, 0x3C00, 0x4CA0, 0x6F60, 0x1FC0, 0x8E20, 0xFE80,
+    0xC9A0, 0xB900, 0x28E0, 0x5840, 0x7B80, 0x0B20, 0x9AC0, 0xEA60,
+    0x3EA0, 0x4E00, 0xDFE0, 0xAF40, 0x8C80, 0xFC20, 0x6DC0, 0x1D60,
+    0x2A40, 0x5AE0, 0xCB00, 0xBBA0, 0x9860, 0xE8C0, 0x7920, 0x0980,
+    0x1760, 0x67C0, 0xF620, 0x8680, 0xA540, 0xD5E0, 0x4400, 0x34A0,
+    0x0380, 0x7320, 0xE2C0, 0x9260, 0xB1A0, 0xC100, 0x50E0, 0x2040,
+    0x6D20, 0x1D80, 0x8C60, 0xFCC0, 0xDF00, 0xAFA0, 0x3E40, 0x4EE0,
+    0x79C0, 0x0960, 0x9880, 0xE820, 0xCBE0, 0xBB40, 0x2AA0, 0x5A00,
+    0x44E0, 0x3440, 0xA5A0, 0xD500, 0xF6C0, 0x8660, 0x1780, 0x6720,
+    0x5000, 0x20A0, 0xB140, 0xC1E0, 0xE220, 0x9280, 0x0360, 0x73C0,
+    0x99A0, 0xE900, 0x78E0, 0x0840, 0x2B80, 0x5B20, 0xCAC0, 0xBA60,
+    0x8D40, 0xFDE0, 0x6C00, 0x1CA0, 0x3F60, 0x4FC0, 0xDE20, 0xAE80,
+    0xB060, 0xC0C0, 0x5120, 0x2180, 0x0240, 0x72E0, 0xE300, 0x93A0,
+    0xA480, 0xD420, 0x45C0, 0x3560, 0x16A0, 0x6600, 0xF7E0, 0x8740,
+    0xCA20, 0xBA80, 0x2B60, 0x5BC0, 0x7800, 0x08A0, 0x9940, 0xE9E0,
+    0xDEC0, 0xAE60, 0x3F80, 0x4F20, 0x6CE0, 0x1C40, 0x8DA0, 0xFD00,
+    0xE3E0, 0x9340, 0x02A0, 0x7200, 0x51C0, 0x2160, 0xB080, 0xC020,
+    0xF700, 0x87A0, 0x1640, 0x66E0, 0x4520, 0x3580, 0xA460, 0xD4C0,
+};
+
+// CRC-11/UMTS
+static const uint16_t crc_catalog_table_39[256] = {
+    0x0000, 0x60E0, 0xC1C0, 0xA120, 0xE360, 0x8380, 0x22A0, 0x4240,
+    0xA620, 0xC6C0, 0x67E0, 0x0700, 0x4540, 0x25A0, 0x8480, 0xE460,
+    0x2CA0, 0x4C40, 0xED60, 0x8D80, 0xCFC0, 0xAF20, 0x0E00, 0x6EE0,
+    0x8A80, 0xEA60, 0x4B40, 0x2BA0, 0x69E0, 0x0900, 0xA820, 0xC8C0,
+    0x5940, 0x39A0, 0x9880, 0xF860, 0xBA20, 0xDAC0, 0x7BE0, 0x1B00,
+    0xFF60, 0x9F80, 0x3EA0, 0x5E40, 0x1C00, 0x7CE0, 0xDDC0, 0xBD20,
+    0x75E0, 0x1500, 0xB420, 0xD4C0, 0x9680, 0xF660, 0x5740, 0x37A0,
+    0xD3C0, 0xB320, 0x1200, 0x72E0, 0x30A0, 0x5040, 0xF160, 0x9180,
+    0xB280, 0xD260, 0x7340, 0x13A0, 0x51E0, 0x3100, 0x9020, 0xF0C0,
+    0x14A0, 0x7440, 0xD560, 0xB580, 0xF7C0, 0x9720, 0x3600, 0x56E0,
+    0x9E20, 0xFEC0, 0x5FE0, 0x3F00, 0x7D40, 0x1DA0, 0xBC80, 0xDC60,
+    0x3800, 0x58E0, 0xF9C0, 0x9920, 0xDB60, 0xBB80, 0x1AA0, 0x7A40,
+    0xEBC0, 0x8B20, 0x2A00, 0x4AE0, 0x08A0, 0x6840, 0xC960, 0xA980,
+    0x4DE0, 0x2D00, 0x8C20, 0xECC0, 0xAE80, 0xCE60, 0x6F40, 0x0FA0,
+    0xC760, 0xA780, 0x06A0, 0x6640, 0x2400, 0x44E0, 0xE5C0, 0x8520,
+    0x6140, 0x01A0, 0xA080, 0xC060, 0x8220, 0xE2C0, 0x43E0, 0x2300,
+    0x05E0, 0x6500, 0xC420, 0xA4C0, 0xE680, 0x8660, 0x2740, 0x47A0,
+    0xA3C0, 0xC320, 0x6200, 0x02E0, 0x40A0, 0x2040, 0x8160, 0xE180,
+    0x2940, 0x49A0, 0xE880, 0x8860, 0xCA20, 0xAAC0, 0x0BE0, 0x6B00,
+    0x8F60, 0xEF80, 0x4EA0, 0x2E40, 0x6C00, 0x0CE0, 0xADC0, 0xCD20,
+    0x5CA0, 0x3C40, 0x9D60, 0xFD80, 0xBFC0, 0xDF20, 0x7E00, 0x1EE0,
+    0xFA80, 0x9A60, 0x3B40, 0x5BA0, 0x19E0, 0x7900, 0xD820, 0xB8C0,
+    0x7000, 0x10E0, 0xB1C0, 0xD120, 0x9360, 0xF380, 0x52A0, 0x3240,
+    0xD620, 0xB6C0, 0x17E0, 0x7700, 0x3540, 0x55A0, 0xF480, 0x9460,
+    0xB760, 0xD780, 0x76A0, 0x1640, 0x5400, 0x34E0, 0x95C0, 0xF520,
+    0x1140, 0x71A0, 0xD080, 0xB060, 0xF220, 0x92C0, 0x33E0, 0x5300,
+    0x9BC0, 0xFB20, 0x5A00, 0x3AE0, 0x78A0, 0x1840, 0xB960, 0xD980,
+    0x3DE0, 0x5D00, 0xFC20, 0x9CC0, 0xDE80, 0xBE60, 0x1F40, 0x7FA0,
+    0xEE20, 0x8EC0, 0x2FE0, 0x4F00, 0x0D40, 0x6DA0, 0xCC80, 0xAC60,
+    0x4800, 0x28E0, 0x89C0, 0xE920, 0xAB60, 0xCB80, 0x6AA0, 0x0A40,
+    0xC280, 0xA260, 0x0340, 0x63A0, 0x21E0, 0x4100, 0xE020, 0x80C0,
+    0x64A0, 0x0440, 0xA560, 0xC580, 0x87C0, 0xE720, 0x4600, 0x26E0,
+};
+
+// CRC-12/CDMA2000
+static const uint16_t crc_catalog_table_40[256] = {
+    0x0000, 0xF130, 0x1350, 0xE260, 0x26A0, 0xD790, 0x35F0, 0xC4C0,
+    0x4D40, 0xBC70, 0x5E10, 0xAF20, 0x6BE0, 0x9AD0, 0x78B0, 0x8980,
+    0x9A80, 0x6BB0, 0x89D0, 0x78E0, 0xBC20, 0x4D10, 0xAF70, 0x5E40,
+    0xD7C0, 0x26F0, 0xC490, 0x35A0, 0xF160, 0x0050, 0xE230, 0x1300,
+    0xC430, 0x3500, 0xD760, 0x2650, 0xE290, 0x13A0, 0xF1C0, 0x00F0,
+    0x8970, 0x7840, 0x9A20, 0x6B10, 0xAFD0, 0x5EE0, 0xBC80, 0x4DB0,
+    0x5EB0, 0xAF80, 0x4DE0, 0xBCD0, 0x7810, 0x8920, 0x6B40, 0x9A70,
+    0x13F0, 0xE2C0, 0x00A0, 0xF190, 0x3550, 0xC460, 0x2600, 0xD730,
+    0x7950, 0x8860, 0x6A00, 0x9B30, 0x5FF0, 0xAEC0, 0x4CA0, 0xBD90,
+    0x3410, 0xC520, 0x2740, 0xD670, 0x12B0, 0xE380, 0x01E0, 0xF0D0,
+    0xE3D0, 0x12E0, 0xF080, 0x01B0, 0xC570, 0x3440, 0xD620, 0x2710,
+    0xAE90, 0x5FA0, 0xBDC0, 0x4CF0, 0x8830, 0x7900, 0x9B60, 0x6A50,
+    0xBD60, 0x4C50, 0xAE30, 0x5F00, 0x9BC0, 0x6AF0, 0x8890, 0x79A0,
+    0xF020, 0x0110, 0xE370, 0x1240, 0xD680, 0x27B0, 0xC5D0, 0x34E0,
+    0x27E0, 0xD6D0, 0x34B0, 0xC580, 0x0140, 0xF070, 0x1210, 0xE320,
+    0x6AA0, 0x9B90, 0x79F0, 0x88C0, 0x4C00, 0xBD30, 0x5F50, 0xAE60,
+    0xF2A0, 0x0390, 0xE1F0, 0x10C0, 0xD400, 0x2530, 0xC750, 0x3660,
+    0xBFE0, 0x4ED0, 0xACB0, 0x5D80, 0x9940, 0x6870, 0x8A10, 0x7B20,
+    0x6820, 0x9910, 0x7B70, 0x8A40, 0x4E80, 0xBFB0, 0x5DD0, 0xACE0,
+    0x2560, 0xD450, 0x3630, 0xC700, 0x03C0, 0xF2F0, 0x1090, 0xE1A0,
+    0x3690, 0xC7A0, 0x25C0, 0xD4F0, 0x1030, 0xE100, 0x0360, 0xF250,
+    0x7BD0, 0x8AE0, 0x6880, 0x99B0, 0x5D70, 0xAC40, 0x4E20, 0xBF10,
+    0xAC10, 0x5D20, 0xBF40, 0x4E70, 0x8AB0, 0x7B80, 0x99E0, 0x68D0,
+    0xE150, 0x1060, 0xF200, 0x0330, 0xC7F0, 0x36C0, 0xD4A0, 0x2590,
+    0x8BF0, 0x7AC0, 0x98A0, 0x6990, 0xAD50, 0x5C60, 0xBE00, 0x4F30,
+    0xC6B0, 0x3780, 0xD5E0, 0x24D0, 0xE010, 0x1120, 0xF340, 0x0270,
+    0x1170, 0xE040, 0x0220, 0xF310, 0x37D0, 0xC6E0, 0x2480, 0xD5B0,
+    0x5C30, 0xAD00, 0x4F60, 0xBE50, 0x7A90, 0x8BA0, 0x69C0, 0x98F0,
+    0x4FC0, 0xBEF0, 0x5C90, 0xADA0, 0x6960, 0x9850, 0x7A30, 0x8B00,
+    0x0280, 0xF3B0, 0x11D0, 0xE0E0, 0x2420, 0xD510, 0x3770, 0xC640,
+    0xD540, 0x2470, 0xC610, 0x3720, 0xF3E0, 0x02D0, 0xE0B0, 0x1180,
+    0x9800, 0x6930, 0x8B50, 0x7A60, 0xBEA0, 0x4F90, 0xADF0, 0x5CC0,
+};
+
+// CRC-12/DECT
+static const uint16_t crc_catalog_table_41[256] = {
+    0x0000, 0x80F0, 0x8110, 0x01E0, 0x82D0, 0x0220, 0x03C0, 0x8330,
+    0x8550, 0x05A0, 0x0440, 0x84B0, 0x0780, 0x8770, 0x8690, 0x0660,
+    0x8A50, 0x0AA0, 0x0B40, 0x8BB0, 0x0880, 0x8870, 0x8990, 0x0960,
+    0x0F00, 0x8FF0, 0x8E10, 0x0EE0, 0x8DD0, 0x0D20, 0x0CC0, 0x8C30,
+    0x9450, 0x14A0, 0x1540, 0x95B0, 0x1680, 0x9670, 0x9790, 0x1760,
+    0x1100, 0x91F0, 0x9010, 0x10E0, 0x93D0, 0x1320, 0x12C0, 0x9230,
+    0x1E00, 0x9EF0, 0x9F10, 0x1FE0, 0x9CD0, 0x1C20, 0x1DC0, 0x9D30,
+    0x9B50, 0x1BA0, 0x1A40, 0x9AB0, 0x1980, 0x9970, 0x9890, 0x1860,
+    0xA850, 0x28A0, 0x2940, 0xA9B0, 0x2A80, 0xAA70, 0xAB90, 0x2B60,
+    0x2D00, 0xADF0, 0xAC10, 0x2CE0, 0xAFD0, 0x2F20, 0x2EC0, 0xAE30,
+    0x2200, 0xA2F0, 0xA310, 0x23E0, 0xA0D0, 0x2020, 0x21C0, 0xA130,
+    0xA750, 0x27A0, 0x2640, 0xA6B0, 0x2580, 0xA570, 0xA490, 0x2460,
+    0x3C00, 0xBCF0, 0xBD10, 0x3DE0, 0xBED0, 0x3E20, 0x3FC0, 0xBF30,
+    0xB950, 0x39A0, 0x3840, 0xB8B0, 0x3B80, 0xBB70, 0xBA90, 0x3A60,
+    0xB650, 0x36A0, 0x3740, 0xB7B0, 0x3480, 0xB470, 0xB590, 0x3560,
+    0x3300, 0xB3F0, 0xB210, 0x32E0, 0xB1D0, 0x3120, 0x30C0, 0xB030,
+    0xD050, 0x50A0, 0x5140, 0xD1B0, 0x5280, 0xD270, 0xD390, 0x5360,
+    0x5500, 0xD5F0, 0xD410, 0x54E0, 0xD7D0, 0x5720, 0x56C0, 0xD630,
+    0x5A00, 0xDAF0, 0xDB10, 0x5BE0, 0xD8D0, 0x5820, 0x59C0, 0xD930,
+    0xDF50, 0x5FA0, 0x5E40, 0xDEB0, 0x5D80, 0xDD70, 0xDC90, 0x5C60,
+    0x4400, 0xC4F0, 0xC510, 0x45E0, 0xC6D0, 0x4620, 0x47C0, 0xC730,
+    0xC150, 0x41A0, 0x4040, 0xC0B0, 0x4380, 0xC370, 0xC290, 0x4260,
+    0xCE50, 0x4EA0, 0x4F40, 0xCFB0, 0x4C80, 0xCC70, 0xCD90, 0x4D60,
+    0x4B00, 0xCBF0, 0xCA10, 0x4AE0, 0xC9D0, 0x4920, 0x48C0, 0xC830,
+    0x7800, 0xF8F0, 0xF910, 0x79E0, 0xFAD0, 0x7A20, 0x7BC0, 0xFB30,
+    0xFD50, 0x7DA0, 0x7C40, 0xFCB0, 0x7F80, 0xFF70, 0xFE90, 0x7E60,
+    0xF250, 0x72A0, 0x7340, 0xF3B0, 0x7080, 0xF070, 0xF190, 0x7160,
+    0x7700, 0xF7F0, 0xF610, 0x76E0, 0xF5D0, 0x7520, 0x74C0, 0xF430,
+    0xEC50, 0x6CA0, 0x6D40, 0xEDB0, 0x6E80, 0xEE70, 0xEF90, 0x6F60,
+    0x6900, 0xE9F0, 0xE810, 0x68E0, 0xEBD0, 0x6B20, 0x6AC0, 0xEA30,
+    0x6600, 0xE6F0, 0xE710, 0x67E0, 0xE4D0, 0x6420, 0x65C0, 0xE530,
+    0xE350, 0x63A0, 0x6240, 0xE2B0, 0x6180, 0xE170, 0xE090, 0x6060,
+};
+
+// CRC-12/GSM
+static const uint16_t crc_catalog_table_42[256] = {
+    0x0000, 0xD310, 0x7530, 0xA620, 0xEA60, 0x3970, 0x9F50, 0x4C40,
+    0x07D0, 0xD4C0, 0x72E0, 0xA1F0, 0xEDB0, 0x3EA0, 0x9880, 0x4B90,
+    0x0FA0, 0xDCB0, 0x7A90, 0xA980, 0xE5C0, 0x36D0, 0x90F0, 0x43E0,
+    0x0870, 0xDB60, 0x7D40, 0xAE50, 0xE210, 0x3100, 0x9720, 0x4430,
+    0x1F40, 0xCC50, 0x6A70, 0xB960, 0xF520, 0x2630, 0x8010, 0x5300,
+    0x1890, 0xCB80, 0x6DA0, 0xBEB0, 0xF2F0, 0x21E0, 0x87C0, 0x54D0,
+    0x10E0, 0xC3F0, 0x65D0, 0xB6C0, 0xFA80, 0x2990, 0x8FB0, 0x5CA0,
+    0x1730, 0xC420, 0x6200, 0xB110, 0xFD50, 0x2E40, 0x8860, 0x5B70,
+    0x3E80, 0xED90, 0x4BB0, 0x98A0, 0xD4E0, 0x07F0, 0xA1D0, 0x72C0,
+    0x3950, 0xEA40, 0x4C60, 0x9F70, 0xD330, 0x0020, 0xA600, 0x7510,
+    0x3120, 0xE230, 0x4410, 0x9700, 0xDB40, 0x0850, 0xAE70, 0x7D60,
+    0x36F0, 0xE5E0, 0x43C0, 0x90D0, 0xDC90, 0x0F80, 0xA9A0, 0x7AB0,
+    0x21C0, 0xF2D0, 0x54F0, 0x87E0, 0xCBA0, 0x18B0, 0xBE90, 0x6D80,
+    0x2610, 0xF500, 0x5320, 0x8030, 0xCC70, 0x1F60, 0xB940, 0x6A50,
+    0x2E60, 0xFD70, 0x5B50, 0x8840, 0xC400, 0x1710, 0xB130, 0x6220,
+    0x29B0, 0xFAA0, 0x5C80, 0x8F90, 0xC3D0, 0x10C0, 0xB6E0, 0x65F0,
+    0x7D00, 0xAE10, 0x0830, 0xDB20, 0x9760, 0x4470, 0xE250, 0x3140,
+    0x7AD0, 0xA9C0, 0x0FE0, 0xDCF0, 0x90B0, 0x43A0, 0xE580, 0x3690,
+    0x72A0, 0xA1B0, 0x0790, 0xD480, 0x98C0, 0x4BD0, 0xEDF0, 0x3EE0,
+    0x7570, 0xA660, 0x0040, 0xD350, 0x9F10, 0x4C00, 0xEA20, 0x3930,
+    0x6240, 0xB150, 0x1770, 0xC460, 0x8820, 0x5B30, 0xFD10, 0x2E00,
+    0x6590, 0xB680, 0x10A0, 0xC3B0, 0x8FF0, 0x5CE0, 0xFAC0, 0x29D0,
+    0x6DE0, 0xBEF0, 0x18D0, 0xCBC0, 0x8780, 0x5490, 0xF2B0, 0x21A0,
+    0x6A30, 0xB920, 0x1F00, 0xCC10, 0x8050, 0x5340, 0xF560, 0x2670,
+    0x4380, 0x9090, 0x36B0, 0xE5A0, 0xA9E0, 0x7AF0, 0xDCD0, 0x0FC0,
+    0x4450, 0x9740, 0x3160, 0xE270, 0xAE30, 0x7D20, 0xDB00, 0x0810,
+    0x4C20, 0x9F30, 0x3910, 0xEA00, 0xA640, 0x7550, 0xD370, 0x0060,
+    0x4BF0, 0x98E0, 0x3EC0, 0xEDD0, 0xA190, 0x7280, 0xD4A0, 0x07B0,
+    0x5CC0, 0x8FD0, 0x29F0, 0xFAE0, 0xB6A0, 0x65B0, 0xC390, 0x1080,
+    0x5B10, 0x8800, 0x2E20, 0xFD30, 0xB170, 0x6260, 0xC440, 0x1750,
+    0x5360, 0x8070, 0x2650, 0xF540, 0xB900, 0x6A10, 0xCC30, 0x1F20,
+    0x54B0, 0x87A0, 0x2180, 0xF290, 0xBED0, 0x6DC0, 0xCBE0, 0x18F0,
+};
+
+// CRC-13/BBC
+static const uint16_t crc_catalog_table_44[256] = {
+    0x0000, 0xE7A8, 0x28F8, 0xCF50, 0x51F0, 0xB658, 0x7908, 0x9EA0,
+    0xA3E0, 0x4448, 0x8B18, 0x6CB0, 0xF210, 0x15B8, 0xDAE8, 0x3D40,
+    0xA068, 0x47C0, 0x8890, 0x6F38, 0xF198, 0x1630, 0xD960, 0x3EC8,
+    0x0388, 0xE420, 0x2B70, 0xCCD8, 0x5278, 0xB5D0, 0x7A80, 0x9D28,
+    0xA778, 0x40D0, 0x8F80, 0x6828, 0xF688, 0x1120, 0xDE70, 0x39D8,
+    0x0498, 0xE330, 0x2C60, 0xCBC8, 0x5568, 0xB2C0, 0x7D90, 0x9A38,
+    0x0710, 0xE0B8, 0x2FE8, 0xC840, 0x56E0, 0xB148, 0x7E18, 0x99B0,
+    0xA4F0, 0x4358, 0x8C08, 0x6BA0, 0xF500, 0x12A8, 0xDDF8, 0x3A50,
+    0xA958, 0x4EF0, 0x81A0, 0x6608, 0xF8A8, 0x1F00, 0xD050, 0x37F8,
+    0x0AB8, 0xED10, 0x2240, 0xC5E8, 0x5B48, 0xBCE0, 0x73B0, 0x9418,
+    0x0930, 0xEE98, 0x21C8, 0xC660, 0x58C0, 0xBF68, 0x7038, 0x9790,
+    0xAAD0, 0x4D78, 0x8228, 0x6580, 0xFB20, 0x1C88, 0xD3D8, 0x3470,
+    0x0E20, 0xE988, 0x26D8, 0xC170, 0x5FD0, 0xB878, 0x7728, 0x9080,
+    0xADC0, 0x4A68, 0x8538, 0x6290, 0xFC30, 0x1B98, 0xD4C8, 0x3360,
+    0xAE48, 0x49E0, 0x86B0, 0x6118, 0xFFB8, 0x1810, 0xD740, 0x30E8,
+    0x0DA8, 0xEA00, 0x2550, 0xC2F8, 0x5C58, 0xBBF0, 0x74A0, 0x9308,
+    0xB518, 0x52B0, 0x9DE0, 0x7A48, 0xE4E8, 0x0340, 0xCC10, 0x2BB8,
+    0x16F8, 0xF150, 0x3E00, 0xD9A8, 0x4708, 0xA0A0, 0x6FF0, 0x8858,
+    0x1570, 0xF2D8, 0x3D88, 0xDA20, 0x4480, 0xA328, 0x6C78, 0x8BD0,
+    0xB690, 0x5138, 0x9E68, 0x79C0, 0xE760, 0x00C8, 0xCF98, 0x2830,
+    0x1260, 0xF5C8, 0x3A98, 0xDD30, 0x4390, 0xA438, 0x6B68, 0x8CC0,
+    0xB180, 0x5628, 0x9978, 0x7ED0, 0xE070, 0x07D8, 0xC888, 0x2F20,
+    0xB208, 0x55A0, 0x9AF0, 0x7D58, 0xE3F8, 0x0450, 0xCB00, 0x2CA8,
+    0x11E8, 0xF640, 0x3910, 0xDEB8, 0x4018, 0xA7B0, 0x68E0, 0x8F48,
+    0x1C40, 0xFBE8, 0x34B8, 0xD310, 0x4DB0, 0xAA18, 0x6548, 0x82E0,
+    0xBFA0, 0x5808, 0x9758, 0x70F0, 0xEE50, 0x09F8, 0xC6A8, 0x2100,
+    0xBC28, 0x5B80, 0x94D0, 0x7378, 0xEDD8, 0x0A70, 0xC520, 0x2288,
+    0x1FC8, 0xF860, 0x3730, 0xD098, 0x4E38, 0xA990, 0x66C0, 0x8168,
+    0xBB38, 0x5C90, 0x93C0, 0x7468, 0xEAC8, 0x0D60, 0xC230, 0x2598,
+    0x18D8, 0xFF70, 0x3020, 0xD788, 0x4928, 0xAE80, 0x61D0, 0x8678,
+    0x1B50, 0xFCF8, 0x33A8, 0xD400, 0x4AA0, 0xAD08, 0x6258, 0x85F0,
+    0xB8B0, 0x5F18, 0x9048, 0x77E0, 0xE940, 0x0EE8, 0xC1B8, 0x2610,
+};
+
+// CRC-14/DARC
+static const uint16_t crc_catalog_table_45[256] = {
+    0x0000, 0x16D2, 0x2DA4, 0x3B76, 0x0B41, 0x1D93, 0x26E5, 0x3037,
+    0x1682, 0x0050, 0x3B26, 0x2DF4, 0x1DC3, 0x0B11, 0x3067, 0x26B5,
+    0x2D04, 0x3BD6, 0x00A0, 0x1672, 0x2645, 0x3097, 0x0BE1, 0x1D33,
+    0x3B86, 0x2D54, 0x1622, 0x00F0, 0x30C7, 0x2615, 0x1D63, 0x0BB1,
+    0x0A01, 0x1CD3, 0x27A5, 0x3177, 0x0140, 0x1792, 0x2CE4, 0x3A36,
+    0x1C83, 0x0A51, 0x3127, 0x27F5, 0x17C2, 0x0110, 0x3A66, 0x2CB4,
+    0x2705, 0x31D7, 0x0AA1, 0x1C73, 0x2C44, 0x3A96, 0x01E0, 0x1732,
+    0x3187, 0x2755, 0x1C23, 0x0AF1, 0x3AC6, 0x2C14, 0x1762, 0x01B0,
+    0x1402, 0x02D0, 0x39A6, 0x2F74, 0x1F43, 0x0991, 0x32E7, 0x2435,
+    0x0280, 0x1452, 0x2F24, 0x39F6, 0x09C1, 0x1F13, 0x2465, 0x32B7,
+    0x3906, 0x2FD4, 0x14A2, 0x0270, 0x3247, 0x2495, 0x1FE3, 0x0931,
+    0x2F84, 0x3956, 0x0220, 0x14F2, 0x24C5, 0x3217, 0x0961, 0x1FB3,
+    0x1E03, 0x08D1, 0x33A7, 0x2575, 0x1542, 0x0390, 0x38E6, 0x2E34,
+    0x0881, 0x1E53, 0x2525, 0x33F7, 0x03C0, 0x1512, 0x2E64, 0x38B6,
+    0x3307, 0x25D5, 0x1EA3, 0x0871, 0x3846, 0x2E94, 0x15E2, 0x0330,
+    0x2585, 0x3357, 0x0821, 0x1EF3, 0x2EC4, 0x3816, 0x0360, 0x15B2,
+    0x2804, 0x3ED6, 0x05A0, 0x1372, 0x2345, 0x3597, 0x0EE1, 0x1833,
+    0x3E86, 0x2854, 0x1322, 0x05F0, 0x35C7, 0x2315, 0x1863, 0x0EB1,
+    0x0500, 0x13D2, 0x28A4, 0x3E76, 0x0E41, 0x1893, 0x23E5, 0x3537,
+    0x1382, 0x0550, 0x3E26, 0x28F4, 0x18C3, 0x0E11, 0x3567, 0x23B5,
+    0x2205, 0x34D7, 0x0FA1, 0x1973, 0x2944, 0x3F96, 0x04E0, 0x1232,
+    0x3487, 0x2255, 0x1923, 0x0FF1, 0x3FC6, 0x2914, 0x1262, 0x04B0,
+    0x0F01, 0x19D3, 0x22A5, 0x3477, 0x0440, 0x1292, 0x29E4, 0x3F36,
+    0x1983, 0x0F51, 0x3427, 0x22F5, 0x12C2, 0x0410, 0x3F66, 0x29B4,
+    0x3C06, 0x2AD4, 0x11A2, 0x0770, 0x3747, 0x2195, 0x1AE3, 0x0C31,
+    0x2A84, 0x3C56, 0x0720, 0x11F2, 0x21C5, 0x3717, 0x0C61, 0x1AB3,
+    0x1102, 0x07D0, 0x3CA6, 0x2A74, 0x1A43, 0x0C91, 0x37E7, 0x2135,
+    0x0780, 0x1152, 0x2A24, 0x3CF6, 0x0CC1, 0x1A13, 0x2165, 0x37B7,
+    0x3607, 0x20D5, 0x1BA3, 0x0D71, 0x3D46, 0x2B94, 0x10E2, 0x0630,
+    0x2085, 0x3657, 0x0D21, 0x1BF3, 0x2BC4, 0x3D16, 0x0660, 0x10B2,
+    0x1B03, 0x0DD1, 0x36A7, 0x2075, 0x1042, 0x0690, 0x3DE6, 0x2B34,
+    0x0D81, 0x1B53, 0x2025, 0x36F7, 0x06C0, 0x1012, 0x2B64, 0x3DB6,
+};
+
+// CRC-14/GSM
+static const uint16_t crc_catalog_table_46[256] = {
+    0x0000, 0x80B4, 0x81DC, 0x0168, 0x830C, 0x03B8, 0x02D0, 0x8264,
+    0x86AC, 0x0618, 0x0770, 0x87C4, 0x05A0, 0x8514, 0x847C, 0x04C8,
+    0x8DEC, 0x0D58, 0x0C30, 0x8C84, 0x0EE0, 0x8E54, 0x8F3C, 0x0F88,
+    0x0B40, 0x8BF4, 0x8A9C, 0x0A28, 0x884C, 0x08F8, 0x0990, 0x8924,
+    0x9B6C, 0x1BD8, 0x1AB0, 0x9A04, 0x1860, 0x98D4, 0x99BC, 0x1908,
+    0x1DC0, 0x9D74, 0x9C1C, 0x1CA8, 0x9ECC, 0x1E78, 0x1F10, 0x9FA4,
+    0x1680, 0x9634, 0x975C, 0x17E8, 0x958C, 0x1538, 0x1450, 0x94E4,
+    0x902C, 0x1098, 0x11F0, 0x9144, 0x1320, 0x9394, 0x92FC, 0x1248,
+    0xB66C, 0x36D8, 0x37B0, 0xB704, 0x3560, 0xB5D4, 0xB4BC, 0x3408,
+    0x30C0, 0xB074, 0xB11C, 0x31A8, 0xB3CC, 0x3378, 0x3210, 0xB2A4,
+    0x3B80, 0xBB34, 0xBA5C, 0x3AE8, 0xB88C, 0x3838, 0x3950, 0xB9E4,
+    0xBD2C, 0x3D98, 0x3CF0, 0xBC44, 0x3E20, 0xBE94, 0xBFFC, 0x3F48,
+    0x2D00, 0xADB4, 0xACDC, 0x2C68, 0xAE0C, 0x2EB8, 0x2FD0, 0xAF64,
+    0xABAC, 0x2B18, 0x2A70, 0xAAC4, 0x28A0, 0xA814, 0xA97C, 0x29C8,
+    0xA0EC, 0x2058, 0x2130, 0xA184, 0x23E0, 0xA354, 0xA23C, 0x2288,
+    0x2640, 0xA6F4, 0xA79C, 0x2728, 0xA54C, 0x25F8, 0x2490, 0xA424,
+    0xEC6C, 0x6CD8, 0x6DB0, 0xED04, 0x6F60, 0xEFD4, 0xEEBC, 0x6E08,
+    0x6AC0, 0xEA74, 0xEB1C, 0x6BA8, 0xE9CC, 0x6978, 0x6810, 0xE8A4,
+    0x6180, 0xE134, 0xE05C, 0x60E8, 0xE28C, 0x6238, 0x6350, 0xE3E4,
+    0xE72C, 0x6798, 0x66F0, 0xE644, 0x6420, 0xE494, 0xE5FC, 0x6548,
+    0x7700, 0xF7B4, 0xF6DC, 0x7668, 0xF40C, 0x74B8, 0x75D0, 0xF564,
+    0xF1AC, 0x7118, 0x7070, 0xF0C4, 0x72A0, 0xF214, 0xF37C, 0x73C8,
+    0xFAEC, 0x7A58, 0x7B30, 0xFB84, 0x79E0, 0xF954, 0xF83C, 0x7888,
+    0x7C40, 0xFCF4, 0xFD9C, 0x7D28, 0xFF4C, 0x7FF8, 0x7E90, 0xFE24,
+    0x5A00, 0xDAB4, 0xDBDC, 0x5B68, 0xD90C, 0x59B8, 0x58D0, 0xD864,
+    0xDCAC, 0x5C18, 0x5D70, 0xDDC4, 0x5FA0, 0xDF14, 0xDE7C, 0x5EC8,
+    0xD7EC, 0x5758, 0x5630, 0xD684, 0x54E0, 0xD454, 0xD53C, 0x5588,
+    0x5140, 0xD1F4, 0xD09C, 0x5028, 0xD24C, 0x52F8, 0x5390, 0xD324,
+    0xC16C, 0x41D8, 0x40B0, 0xC004, 0x4260, 0xC2D4, 0xC3BC, 0x4308,
+    0x47C0, 0xC774, 0xC61C, 0x46A8, 0xC4CC, 0x4478, 0x4510, 0xC5A4,
+    0x4C80, 0xCC34, 0xCD5C, 0x4DE8, 0xCF8C, 0x4F38, 0x4E50, 0xCEE4,
+    0xCA2C, 0x4A98, 0x4BF0, 0xCB44, 0x4920, 0xC994, 0xC8FC, 0x4848,
+};
+
+// CRC-15/CAN
+static const uint16_t crc_catalog_table_47[256] = {
+    0x0000, 0x8B32, 0x9D56, 0x1664, 0xB19E, 0x3AAC, 0x2CC8, 0xA7FA,
+    0xE80E, 0x633C, 0x7558, 0xFE6A, 0x5990, 0xD2A2, 0xC4C6, 0x4FF4,
+    0x5B2E, 0xD01C, 0xC678, 0x4D4A, 0xEAB0, 0x6182, 0x77E6, 0xFCD4,
+    0xB320, 0x3812, 0x2E76, 0xA544, 0x02BE, 0x898C, 0x9FE8, 0x14DA,
+    0xB65C, 0x3D6E, 0x2B0A, 0xA038, 0x07C2, 0x8CF0, 0x9A94, 0x11A6,
+    0x5E52, 0xD560, 0xC304, 0x4836, 0xEFCC, 0x64FE, 0x729A, 0xF9A8,
+    0xED72, 0x6640, 0x7024, 0xFB16, 0x5CEC, 0xD7DE, 0xC1BA, 0x4A88,
+    0x057C, 0x8E4E, 0x982A, 0x1318, 0xB4E2, 0x3FD0, 0x29B4, 0xA286,
+    0xE78A, 0x6CB8, 0x7ADC, 0xF1EE, 0x5614, 0xDD26, 0xCB42, 0x4070,
+    0x0F84, 0x84B6, 0x92D2, 0x19E0, 0xBE1A, 0x3528, 0x234C, 0xA87E,
+    0xBCA4, 0x3796, 0x21F2, 0xAAC0, 0x0D3A, 0x8608, 0x906C, 0x1B5E,
+    0x54AA, 0xDF98, 0xC9FC, 0x42CE, 0xE534, 0x6E06, 0x7862, 0xF350,
+    0x51D6, 0xDAE4, 0xCC80, 0x47B2, 0xE048, 0x6B7A, 0x7D1E, 0xF62C,
+    0xB9D8, 0x32EA, 0x248E, 0xAFBC, 0x0846, 0x8374, 0x9510, 0x1E22,
+    0x0AF8, 0x81CA, 0x97AE, 0x1C9C, 0xBB66, 0x3054, 0x2630, 0xAD02,
+    0xE2F6, 0x69C4, 0x7FA0, 0xF492, 0x5368, 0xD85A, 0xCE3E, 0x450C,
+    0x4426, 0xCF14, 0xD970, 0x5242, 0xF5B8, 0x7E8A, 0x68EE, 0xE3DC,
+    0xAC28, 0x271A, 0x317E, 0xBA4C, 0x1DB6, 0x9684, 0x80E0, 0x0BD2,
+    0x1F08, 0x943A, 0x825E, 0x096C, 0xAE96, 0x25A4, 0x33C0, 0xB8F2,
+    0xF706, 0x7C34, 0x6A50, 0xE162, 0x4698, 0xCDAA, 0xDBCE, 0x50FC,
+    0xF27A, 0x7948, 0x6F2C, 0xE41E, 0x43E4, 0xC8D6, 0xDEB2, 0x5580,
+    0x1A74, 0x9146, 0x8722, 0x0C10, 0xABEA, 0x20D8, 0x36BC, 0xBD8E,
+    0xA954, 0x2266, 0x3402, 0xBF30, 0x18CA, 0x93F8, 0x859C, 0x0EAE,
+    0x415A, 0xCA68, 0xDC0C, 0x573E, 0xF0C4, 0x7BF6, 0x6D92, 0xE6A0,
+    0xA3AC, 0x289E, 0x3EFA, 0xB5C8, 0x1232, 0x9900, 0x8F64, 0x0456,
+    0x4BA2, 0xC090, 0xD6F4, 0x5DC6, 0xFA3C, 0x710E, 0x676A, 0xEC58,
+    0xF882, 0x73B0, 0x65D4, 0xEEE6, 0x491C, 0xC22E, 0xD44A, 0x5F78,
+    0x108C, 0x9BBE, 0x8DDA, 0x06E8, 0xA112, 0x2A20, 0x3C44, 0xB776,
+    0x15F0, 0x9EC2, 0x88A6, 0x0394, 0xA46E, 0x2F5C, 0x3938, 0xB20A,
+    0xFDFE, 0x76CC, 0x60A8, 0xEB9A, 0x4C60, 0xC752, 0xD136, 0x5A04,
+    0x4EDE, 0xC5EC, 0xD388, 0x58BA, 0xFF40, 0x7472, 0x6216, 0xE924,
+    0xA6D0, 0x2DE2, 0x3B86, 0xB0B4, 0x174E, 0x9C7C, 0x8A18, 0x012A,
+};
+
+// CRC-15/MPT1327
+static const uint16_t crc_catalog_table_48[256] = {
+    0x0000, 0xD02A, 0x707E, 0xA054, 0xE0FC, 0x30D6, 0x9082, 0x40A8,
+    0x11D2, 0xC1F8, 0x61AC, 0xB186, 0xF12E, 0x2104, 0x8150, 0x517A,
+    0x23A4, 0xF38E, 0x53DA, 0x83F0, 0xC358, 0x1372, 0xB326, 0x630C,
+    0x3276, 0xE25C, 0x4208, 0x9222, 0xD28A, 0x02A0, 0xA2F4, 0x72DE,
+    0x4748, 0x9762, 0x3736, 0xE71C, 0xA7B4, 0x779E, 0xD7CA, 0x07E0,
+    0x569A, 0x86B0, 0x26E4, 0xF6CE, 0xB666, 0x664C, 0xC618, 0x1632,
+    0x64EC, 0xB4C6, 0x1492, 0xC4B8, 0x8410, 0x543A, 0xF46E, 0x2444,
+    0x753E, 0xA514, 0x0540, 0xD56A, 0x95C2, 0x45E8, 0xE5BC, 0x3596,
+    0x8E90, 0x5EBA, 0xFEEE, 0x2EC4, 0x6E6C, 0xBE46, 0x1E12, 0xCE38,
+    0x9F42, 0x4F68, 0xEF3C, 0x3F16, 0x7FBE, 0xAF94, 0x0FC0, 0xDFEA,
+    0xAD34, 0x7D1E, 0xDD4A, 0x0D60, 0x4DC8, 0x9DE2, 0x3DB6, 0xED9C,
+    0xBCE6, 0x6CCC, 0xCC98, 0x1CB2, 0x5C1A, 0x8C30, 0x2C64, 0xFC4E,
+    0xC9D8, 0x19F2, 0xB9A6, 0x698C, 0x2924, 0xF90E, 0x595A, 0x8970,
+    0xD80A, 0x0820, 0xA874, 0x785E, 0x38F6, 0xE8DC, 0x4888, 0x98A2,
+    0xEA7C, 0x3A56, 0x9A02, 0x4A28, 0x0A80, 0xDAAA, 0x7AFE, 0xAAD4,
+    0xFBAE, 0x2B84, 0x8BD0, 0x5BFA, 0x1B52, 0xCB78, 0x6B2C, 0xBB06,
+    0xCD0A, 0x1D20, 0xBD74, 0x6D5E, 0x2DF6, 0xFDDC, 0x5D88, 0x8DA2,
+    0xDCD8, 0x0CF2, 0xACA6, 0x7C8C, 0x3C24, 0xEC0E, 0x4C5A, 0x9C70,
+    0xEEAE, 0x3E84, 0x9ED0, 0x4EFA, 0x0E52, 0xDE78, 0x7E2C, 0xAE06,
+    0xFF7C, 0x2F56, 0x8F02, 0x5F28, 0x1F80, 0xCFAA, 0x6FFE, 0xBFD4,
+    0x8A42, 0x5A68, 0xFA3C, 0x2A16, 0x6ABE, 0xBA94, 0x1AC0, 0xCAEA,
+    0x9B90, 0x4BBA, 0xEBEE, 0x3BC4, 0x7B6C, 0xAB46, 0x0B12, 0xDB38,
+    0xA9E6, 0x79CC, 0xD998, 0x09B2, 0x491A, 0x9930, 0x3964, 0xE94E,
+    0xB834, 0x681E, 0xC84A, 0x1860, 0x58C8, 0x88E2, 0x28B6, 0xF89C,
+    0x439A, 0x93B0, 0x33E4, 0xE3CE, 0xA366, 0x734C, 0xD318, 0x0332,
+    0x5248, 0x8262, 0x2236, 0xF21C, 0xB2B4, 0x629E, 0xC2CA, 0x12E0,
+    0x603E, 0xB014, 0x1040, 0xC06A, 0x80C2, 0x50E8, 0xF0BC, 0x2096,
+    0x71EC, 0xA1C6, 0x0192, 0xD1B8, 0x9110, 0x413A, 0xE16E, 0x3144,
+    0x04D2, 0xD4F8, 0x74AC, 0xA486, 0xE42E, 0x3404, 0x9450, 0x447A,
+    0x1500, 0xC52A, 0x657E, 0xB554, 0xF5FC, 0x25D6, 0x8582, 0x55A8,
+    0x2776, 0xF75C, 0x5708, 0x8722, 0xC78A, 0x17A0, 0xB7F4, 0x67DE,
+    0x36A4, 0xE68E, 0x46DA, 0x96F0, 0xD658, 0x0672, 0xA626, 0x760C,
+};
+
+// CRC-16/ARC
+static const uint16_t crc_catalog_table_49[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
+
+// CRC-16/CDMA2000
+static const uint16_t crc_catalog_table_50[256] = {
+    0x0000, 0xC867, 0x58A9, 0x90CE, 0xB152, 0x7935, 0xE9FB, 0x219C,
+    0xAAC3, 0x62A4, 0xF26A, 0x3A0D, 0x1B91, 0xD3F6, 0x4338, 0x8B5F,
+    0x9DE1, 0x5586, 0xC548, 0x0D2F, 0x2CB3, 0xE4D4, 0x741A, 0xBC7D,
+    0x3722, 0xFF45, 0x6F8B, 0xA7EC, 0x8670, 0x4E17, 0xDED9, 0x16BE,
+    0xF3A5, 0x3BC2, 0xAB0C, 0x636B, 0x42F7, 0x8A90, 0x1A5E, 0xD239,
+    0x5966, 0x9101, 0x01CF, 0xC9A8, 0xE834, 0x2053, 0xB09D, 0x78FA,
+    0x6E44, 0xA623, 0x36ED, 0xFE8A, 0xDF16, 0x1771, 0x87BF, 0x4FD8,
+    0xC487, 0x0CE0, 0x9C2E, 0x5449, 0x75D5, 0xBDB2, 0x2D7C, 0xE51B,
+    0x2F2D, 0xE74A, 0x7784, 0xBFE3, 0x9E7F, 0x5618, 0xC6D6, 0x0EB1,
+    0x85EE, 0x4D89, 0xDD47, 0x1520, 0x34BC, 0xFCDB, 0x6C15, 0xA472,
+    0xB2CC, 0x7AAB, 0xEA65, 0x2202, 0x039E, 0xCBF9, 0x5B37, 0x9350,
+    0x180F, 0xD068, 0x40A6, 0x88C1, 0xA95D, 0x613A, 0xF1F4, 0x3993,
+    0xDC88, 0x14EF, 0x8421, 0x4C46, 0x6DDA, 0xA5BD, 0x3573, 0xFD14,
+    0x764B, 0xBE2C, 0x2EE2, 0xE685, 0xC719, 0x0F7E, 0x9FB0, 0x57D7,
+    0x4169, 0x890E, 0x19C0, 0xD1A7, 0xF03B, 0x385C, 0xA892, 0x60F5,
+    0xEBAA, 0x23CD, 0xB303, 0x7B64, 0x5AF8, 0x929F, 0x0251, 0xCA36,
+    0x5E5A, 0x963D, 0x06F3, 0xCE94, 0xEF08, 0x276F, 0xB7A1, 0x7FC6,
+    0xF499, 0x3CFE, 0xAC30, 0x6457, 0x45CB, 0x8DAC, 0x1D62, 0xD505,
+    0xC3BB, 0x0BDC, 0x9B12, 0x5375, 0x72E9, 0xBA8E, 0x2A40, 0xE227,
+    0x6978, 0xA11F, 0x31D1, 0xF9B6, 0xD82A, 0x104D, 0x8083, 0x48E4,
+    0xADFF, 0x6598, 0xF556, 0x3D31, 0x1CAD, 0xD4CA, 0x4404, 0x8C63,
+    0x073C, 0xCF5B, 0x5F95, 0x97F2, 0xB66E, 0x7E09, 0xEEC7, 0x26A0,
+    0x301E, 0xF879, 0x68B7, 0xA0D0, 0x814C, 0x492B, 0xD9E5, 0x1182,
+    0x9ADD, 0x52BA, 0xC274, 0x0A13, 0x2B8F, 0xE3E8, 0x7326, 0xBB41,
+    0x7177, 0xB910, 0x29DE, 0xE1B9, 0xC025, 0x0842, 0x988C, 0x50EB,
+    0xDBB4, 0x13D3, 0x831D, 0x4B7A, 0x6AE6, 0xA281, 0x324F, 0xFA28,
+    0xEC96, 0x24F1, 0xB43F, 0x7C58, 0x5DC4, 0x95A3, 0x056D, 0xCD0A,
+    0x4655, 0x8E32, 0x1EFC, 0xD69B, 0xF707, 0x3F60, 0xAFAE, 0x67C9,
+    0x82D2, 0x4AB5, 0xDA7B, 0x121C, 0x3380, 0xFBE7, 0x6B29, 0xA34E,
+    0x2811, 0xE076, 0x70B8, 0xB8DF, 0x9943, 0x5124, 0xC1EA, 0x098D,
+    0x1F33, 0xD754, 0x479A, 0x8FFD, 0xAE61, 0x6606, 0xF6C8, 0x3EAF,
+    0xB5F0, 0x7D97, 0xED59, 0x253E, 0x04A2, 0xCCC5, 0x5C0B, 0x946C,
+};
+
+// CRC-16/CMS
+static const uint16_t crc_catalog_table_51[256] = {
+    0x0000, 0x8005, 0x800F, 0x000A, 0x801B, 0x001E, 0x0014, 0x8011,
+    0x8033, 0x0036, 0x003C, 0x8039, 0x0028, 0x802D, 0x8027, 0x0022,
+    0x8063, 0x0066, 0x006C, 0x8069, 0x0078, 0x807D, 0x8077, 0x0072,
+    0x0050, 0x8055, 0x805F, 0x005A, 0x804B, 0x004E, 0x0044, 0x8041,
+    0x80C3, 0x00C6, 0x00CC, 0x80C9, 0x00D8, 0x80DD, 0x80D7, 0x00D2,
+    0x00F0, 0x80F5, 0x80FF, 0x00FA, 0x80EB, 0x00EE, 0x00E4, 0x80E1,
+    0x00A0, 0x80A5, 0x80AF, 0x00AA, 0x80BB, 0x00BE, 0x00B4, 0x80B1,
+    0x8093, 0x0096, 0x009C, 0x8099, 0x0088, 0x808D, 0x8087, 0x0082,
+    0x8183, 0x0186, 0x018C, 0x8189, 0x0198, 0x819D, 0x8197, 0x0192,
+    0x01B0, 0x81B5, 0x81BF, 0x01BA, 0x81AB, 0x01AE, 0x01A4, 0x81A1,
+    0x01E0, 0x81E5, 0x81EF, 0x01EA, 0x81FB, 0x01FE, 0x01F4, 0x81F1,
+    0x81D3, 0x01D6, 0x01DC, 0x81D9, 0x01C8, 0x81CD, 0x81C7, 0x01C2,
+    0x0140, 0x8145, 0x814F, 0x014A, 0x815B, 0x015E, 0x0154, 0x8151,
+    0x8173, 0x0176, 0x017C, 0x8179, 0x0168, 0x816D, 0x8167, 0x0162,
+    0x8123, 0x0126, 0x012C, 0x8129, 0x0138, 0x813D, 0x8137, 0x0132,
+    0x0110, 0x8115, 0x811F, 0x011A, 0x810B, 0x010E, 0x0104, 0x8101,
+    0x8303, 0x0306, 0x030C, 0x8309, 0x0318, 0x831D, 0x8317, 0x0312,
+    0x0330, 0x8335, 0x833F, 0x033A, 0x832B, 0x032E, 0x0324, 0x8321,
+    0x0360, 0x8365, 0x836F, 0x036A, 0x837B, 0x037E, 0x0374, 0x8371,
+    0x8353, 0x0356, 0x035C, 0x8359, 0x0348, 0x834D, 0x8347, 0x0342,
+    0x03C0, 0x83C5, 0x83CF, 0x03CA, 0x83DB, 0x03DE, 0x03D4, 0x83D1,
+    0x83F3, 0x03F6, 0x03FC, 0x83F9, 0x03E8, 0x83ED, 0x83E7, 0x03E2,
+    0x83A3, 0x03A6, 0x03AC, 0x83A9, 0x03B8, 0x83BD, 0x83B7, 0x03B2,
+    0x0390, 0x8395, 0x839F, 0x039A, 0x838B, 0x038E, 0x0384, 0x8381,
+    0x0280, 0x8285, 0x828F, 0x028A, 0x829B, 0x029E, 0x0294, 0x8291,
+    0x82B3, 0x02B6, 0x02BC, 0x82B9, 0x02A8, 0x82AD, 0x82A7, 0x02A2,
+    0x82E3, 0x02E6, 0x02EC, 0x82E9, 0x02F8, 0x82FD, 0x82F7, 0x02F2,
+    0x02D0, 0x82D5, 0x82DF, 0x02DA, 0x82CB, 0x02CE, 0x02C4, 0x82C1,
+    0x8243, 0x0246, 0x024C, 0x8249, 0x0258, 0x825D, 0x8257, 0x0252,
+    0x0270, 0x8275, 0x827F, 0x027A, 0x826B, 0x026E, 0x0264, 0x8261,
+    0x0220, 0x8225, 0x822F, 0x022A, 0x823B, 0x023E, 0x0234, 0x8231,
+    0x8213, 0x0216, 0x021C, 0x8219, 0x0208, 0x820D, 0x8207, 0x0202,
+};
+
+// CRC-16/DECT-R
+static const uint16_t crc_catalog_table_53[256] = {
+    0x0000, 0x0589, 0x0B12, 0x0E9B, 0x1624, 0x13AD, 0x1D36, 0x18BF,
+    0x2C48, 0x29C1, 0x275A, 0x22D3, 0x3A6C, 0x3FE5, 0x317E, 0x34F7,
+    0x5890, 0x5D19, 0x5382, 0x560B, 0x4EB4, 0x4B3D, 0x45A6, 0x402F,
+    0x74D8, 0x7151, 0x7FCA, 0x7A43, 0x62FC, 0x6775, 0x69EE, 0x6C67,
+    0xB120, 0xB4A9, 0xBA32, 0xBFBB, 0xA704, 0xA28D, 0xAC16, 0xA99F,
+    0x9D68, 0x98E1, 0x967A, 0x93F3, 0x8B4C, 0x8EC5, 0x805E, 0x85D7,
+    0xE9B0, 0xEC39, 0xE2A2, 0xE72B, 0xFF94, 0xFA1D, 0xF486, 0xF10F,
+    0xC5F8, 0xC071, 0xCEEA, 0xCB63, 0xD3DC, 0xD655, 0xD8CE, 0xDD47,
+    0x67C9, 0x6240, 0x6CDB, 0x6952, 0x71ED, 0x7464, 0x7AFF, 0x7F76,
+    0x4B81, 0x4E08, 0x4093, 0x451A, 0x5DA5, 0x582C, 0x56B7, 0x533E,
+    0x3F59, 0x3AD0, 0x344B, 0x31C2, 0x297D, 0x2CF4, 0x226F, 0x27E6,
+    0x1311, 0x1698, 0x1803, 0x1D8A, 0x0535, 0x00BC, 0x0E27, 0x0BAE,
+    0xD6E9, 0xD360, 0xDDFB, 0xD872, 0xC0CD, 0xC544, 0xCBDF, 0xCE56,
+    0xFAA1, 0xFF28, 0xF1B3, 0xF43A, 0xEC85, 0xE90C, 0xE797, 0xE21E,
+    0x8E79, 0x8BF0, 0x856B, 0x80E2, 0x985D, 0x9DD4, 0x934F, 0x96C6,
+    0xA231, 0xA7B8, 0xA923, 0xACAA, 0xB415, 0xB19C, 0xBF07, 0xBA8E,
+    0xCF92, 0xCA1B, 0xC480, 0xC109, 0xD9B6, 0xDC3F, 0xD2A4, 0xD72D,
+    0xE3DA, 0xE653, 0xE8C8, 0xED41, 0xF5FE, 0xF077, 0xFEEC, 0xFB65,
+    0x9702, 0x928B, 0x9C10, 0x9999, 0x8126, 0x84AF, 0x8A34, 0x8FBD,
+    0xBB4A, 0xBEC3, 0xB058, 0xB5D1, 0xAD6E, 0xA8E7, 0xA67C, 0xA3F5,
+    0x7EB2, 0x7B3B, 0x75A0, 0x7029, 0x6896, 0x6D1F, 0x6384, 0x660D,
+    0x52FA, 0x5773, 0x59E8, 0x5C61, 0x44DE, 0x4157, 0x4FCC, 0x4A45,
+    0x2622, 0x23AB, 0x2D30, 0x28B9, 0x3006, 0x358F, 0x3B14, 0x3E9D,
+    0x0A6A, 0x0FE3, 0x0178, 0x04F1, 0x1C4E, 0x19C7, 0x175C, 0x12D5,
+    0xA85B, 0xADD2, 0xA349, 0xA6C0, 0xBE7F, 0xBBF6, 0xB56D, 0xB0E4,
+    0x8413, 0x819A, 0x8F01, 0x8A88, 0x9237, 0x97BE, 0x9925, 0x9CAC,
+    0xF0CB, 0xF542, 0xFBD9, 0xFE50, 0xE6EF, 0xE366, 0xEDFD, 0xE874,
+    0xDC83, 0xD90A, 0xD791, 0xD218, 0xCAA7, 0xCF2E, 0xC1B5, 0xC43C,
+    0x197B, 0x1CF2, 0x1269, 0x17E0, 0x0F5F, 0x0AD6, 0x044D, 0x01C4,
+    0x3533, 0x30BA, 0x3E21, 0x3BA8, 0x2317, 0x269E, 0x2805, 0x2D8C,
+    0x41EB, 0x4462, 0x4AF9, 0x4F70, 0x57CF, 0x5246, 0x5CDD, 0x5954,
+    0x6DA3, 0x682A, 0x66B1, 0x6338, 0x7B87, 0x7E0E, 0x7095, 0x751C,
+};
+
+// CRC-16/DNP
+static const uint16_t crc_catalog_table_55[256] = {
+    0x0000, 0x365E, 0x6CBC, 0x5AE2, 0xD978, 0xEF26, 0xB5C4, 0x839A,
+    0xFF89, 0xC9D7, 0x9335, 0xA56B, 0x26F1, 0x10AF, 0x4A4D, 0x7C13,
+    0xB26B, 0x8435, 0xDED7, 0xE889, 0x6B13, 0x5D4D, 0x07AF, 0x31F1,
+    0x4DE2, 0x7BBC, 0x215E, 0x1700, 0x949A, 0xA2C4, 0xF826, 0xCE78,
+    0x29AF, 0x1FF1, 0x4513, 0x734D, 0xF0D7, 0xC689, 0x9C6B, 0xAA35,
+    0xD626, 0xE078, 0xBA9A, 0x8CC4, 0x0F5E, 0x3900, 0x63E2, 0x55BC,
+    0x9BC4, 0xAD9A, 0xF778, 0xC126, 0x42BC, 0x74E2, 0x2E00, 0x185E,
+    0x644D, 0x5213, 0x08F1, 0x3EAF, 0xBD35, 0x8B6B, 0xD189, 0xE7D7,
+    0x535E, 0x6500, 0x3FE2, 0x09BC, 0x8A26, 0xBC78, 0xE69A, 0xD0C4,
+    0xACD7, 0x9A89, 0xC06B, 0xF635, 0x75AF, 0x43F1, 0x1913, 0x2F4D,
+    0xE135, 0xD76B, 0x8D89, 0xBBD7, 0x384D, 0x0E13, 0x54F1, 0x62AF,
+    0x1EBC, 0x28E2, 0x7200, 0x445E, 0xC7C4, 0xF19A, 0xAB78, 0x9D26,
+    0x7AF1, 0x4CAF, 0x164D, 0x2013, 0xA389, 0x95D7, 0xCF35, 0xF96B,
+    0x8578, 0xB326, 0xE9C4, 0xDF9A, 0x5C00, 0x6A5E, 0x30BC, 0x06E2,
+    0xC89A, 0xFEC4, 0xA426, 0x9278, 0x11E2, 0x27BC, 0x7D5E, 0x4B00,
+    0x3713, 0x014D, 0x5BAF, 0x6DF1, 0xEE6B, 0xD835, 0x82D7, 0xB489,
+    0xA6BC, 0x90E2, 0xCA00, 0xFC5E, 0x7FC4, 0x499A, 0x1378, 0x2526,
+    0x5935, 0x6F6B, 0x3589, 0x03D7, 0x804D, 0xB613, 0xECF1, 0xDAAF,
+    0x14D7, 0x2289, 0x786B, 0x4E35, 0xCDAF, 0xFBF1, 0xA113, 0x974D,
+    0xEB5E, 0xDD00, 0x87E2, 0xB1BC, 0x3226, 0x0478, 0x5E9A, 0x68C4,
+    0x8F13, 0xB94D, 0xE3AF, 0xD5F1, 0x566B, 0x6035, 0x3AD7, 0x0C89,
+    0x709A, 0x46C4, 0x1C26, 0x2A78, 0xA9E2, 0x9FBC, 0xC55E, 0xF300,
+    0x3D78, 0x0B26, 0x51C4, 0x679A, 0xE400, 0xD25E, 0x88BC, 0xBEE2,
+    0xC2F1, 0xF4AF, 0xAE4D, 0x9813, 0x1B89, 0x2DD7, 0x7735, 0x416B,
+    0xF5E2, 0xC3BC, 0x995E, 0xAF00, 0x2C9A, 0x1AC4, 0x4026, 0x7678,
+    0x0A6B, 0x3C35, 0x66D7, 0x5089, 0xD313, 0xE54D, 0xBFAF, 0x89F1,
+    0x4789, 0x71D7, 0x2B35, 0x1D6B, 0x9EF1, 0xA8AF, 0xF24D, 0xC413,
+    0xB800, 0x8E5E, 0xD4BC, 0xE2E2, 0x6178, 0x5726, 0x0DC4, 0x3B9A,
+    0xDC4D, 0xEA13, 0xB0F1, 0x86AF, 0x0535, 0x336B, 0x6989, 0x5FD7,
+    0x23C4, 0x159A, 0x4F78, 0x7926, 0xFABC, 0xCCE2, 0x9600, 0xA05E,
+    0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC,
+    0x91AF, 0xA7F1, 0xFD13, 0xCB4D, 0x48D7, 0x7E89, 0x246B, 0x1235,
+};
+
+// CRC-16/EN-13757
+static const uint16_t crc_catalog_table_56[256] = {
+    0x0000, 0x3D65, 0x7ACA, 0x47AF, 0xF594, 0xC8F1, 0x8F5E, 0xB23B,
+    0xD64D, 0xEB28, 0xAC87, 0x91E2, 0x23D9, 0x1EBC, 0x5913, 0x6476,
+    0x91FF, 0xAC9A, 0xEB35, 0xD650, 0x646B, 0x590E, 0x1EA1, 0x23C4,
+    0x47B2, 0x7AD7, 0x3D78, 0x001D, 0xB226, 0x8F43, 0xC8EC, 0xF589,
+    0x1E9B, 0x23FE, 0x6451, 0x5934, 0xEB0F, 0xD66A, 0x91C5, 0xACA0,
+    0xC8D6, 0xF5B3, 0xB21C, 0x8F79, 0x3D42, 0x0027, 0x4788, 0x7AED,
+    0x8F64, 0xB201, 0xF5AE, 0xC8CB, 0x7AF0, 0x4795, 0x003A, 0x3D5F,
+    0x5929, 0x644C, 0x23E3, 0x1E86, 0xACBD, 0x91D8, 0xD677, 0xEB12,
+    0x3D36, 0x0053, 0x47FC, 0x7A99, 0xC8A2, 0xF5C7, 0xB268, 0x8F0D,
+    0xEB7B, 0xD61E, 0x91B1, 0xACD4, 0x1EEF, 0x238A, 0x6425, 0x5940,
+    0xACC9, 0x91AC, 0xD603, 0xEB66, 0x595D, 0x6438, 0x2397, 0x1EF2,
+    0x7A84, 0x47E1, 0x004E, 0x3D2B, 0x8F10, 0xB275, 0xF5DA, 0xC8BF,
+    0x23AD, 0x1EC8, 0x5967, 0x6402, 0xD639, 0xEB5C, 0xACF3, 0x9196,
+    0xF5E0, 0xC885, 0x8F2A, 0xB24F, 0x0074, 0x3D11, 0x7ABE, 0x47DB,
+    0xB252, 0x8F37, 0xC898, 0xF5FD, 0x47C6, 0x7AA3, 0x3D0C, 0x0069,
+    0x641F, 0x597A, 0x1ED5, 0x23B0, 0x918B, 0xACEE, 0xEB41, 0xD624,
+    0x7A6C, 0x4709, 0x00A6, 0x3DC3, 0x8FF8, 0xB29D, 0xF532, 0xC857,
+    0xAC21, 0x9144, 0xD6EB, 0xEB8E, 0x59B5, 0x64D0, 0x237F, 0x1E1A,
+    0xEB93, 0xD6F6, 0x9159, 0xAC3C, 0x1E07, 0x2362, 0x64CD, 0x59A8,
+    0x3DDE, 0x00BB, 0x4714, 0x7A71, 0xC84A, 0xF52F, 0xB280, 0x8FE5,
+    0x64F7, 0x5992, 0x1E3D, 0x2358, 0x9163, 0xAC06, 0xEBA9, 0xD6CC,
+    0xB2BA, 0x8FDF, 0xC870, 0xF515, 0x472E, 0x7A4B, 0x3DE4, 0x0081,
+    0xF508, 0xC86D, 0x8FC2, 0xB2A7, 0x009C, 0x3DF9, 0x7A56, 0x4733,
+    0x2345, 0x1E20, 0x598F, 0x64EA, 0xD6D1, 0xEBB4, 0xAC1B, 0x917E,
+    0x475A, 0x7A3F, 0x3D90, 0x00F5, 0xB2CE, 0x8FAB, 0xC804, 0xF561,
+    0x9117, 0xAC72, 0xEBDD, 0xD6B8, 0x6483, 0x59E6, 0x1E49, 0x232C,
+    0xD6A5, 0xEBC0, 0xAC6F, 0x910A, 0x2331, 0x1E54, 0x59FB, 0x649E,
+    0x00E8, 0x3D8D, 0x7A22, 0x4747, 0xF57C, 0xC819, 0x8FB6, 0xB2D3,
+    0x59C1, 0x64A4, 0x230B, 0x1E6E, 0xAC55, 0x9130, 0xD69F, 0xEBFA,
+    0x8F8C, 0xB2E9, 0xF546, 0xC823, 0x7A18, 0x477D, 0x00D2, 0x3DB7,
+    0xC83E, 0xF55B, 0xB2F4, 0x8F91, 0x3DAA, 0x00CF, 0x4760, 0x7A05,
+    0x1E73, 0x2316, 0x64B9, 0x59DC, 0xEBE7, 0xD682, 0x912D, 0xAC48,
+};
+
+// CRC-16/GENIBUS
+static const uint16_t crc_catalog_table_57[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+// CRC-16/IBM-SDLC
+static const uint16_t crc_catalog_table_60[256] = {
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+    0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+    0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+    0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+    0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+    0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+    0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+    0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+    0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+    0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+// CRC-16/LJ1200
+static const uint16_t crc_catalog_table_63[256] = {
+    0x0000, 0x6F63, 0xDEC6, 0xB1A5, 0xD2EF, 0xBD8C, 0x0C29, 0x634A,
+    0xCABD, 0xA5DE, 0x147B, 0x7B18, 0x1852, 0x7731, 0xC694, 0xA9F7,
+    0xFA19, 0x957A, 0x24DF, 0x4BBC, 0x28F6, 0x4795, 0xF630, 0x9953,
+    0x30A4, 0x5FC7, 0xEE62, 0x8101, 0xE24B, 0x8D28, 0x3C8D, 0x53EE,
+    0x9B51, 0xF432, 0x4597, 0x2AF4, 0x49BE, 0x26DD, 0x9778, 0xF81B,
+    0x51EC, 0x3E8F, 0x8F2A, 0xE049, 0x8303, 0xEC60, 0x5DC5, 0x32A6,
+    0x6148, 0x0E2B, 0xBF8E, 0xD0ED, 0xB3A7, 0xDCC4, 0x6D61, 0x0202,
+    0xABF5, 0xC496, 0x7533, 0x1A50, 0x791A, 0x1679, 0xA7DC, 0xC8BF,
+    0x59C1, 0x36A2, 0x8707, 0xE864, 0x8B2E, 0xE44D, 0x55E8, 0x3A8B,
+    0x937C, 0xFC1F, 0x4DBA, 0x22D9, 0x4193, 0x2EF0, 0x9F55, 0xF036,
+    0xA3D8, 0xCCBB, 0x7D1E, 0x127D, 0x7137, 0x1E54, 0xAFF1, 0xC092,
+    0x6965, 0x0606, 0xB7A3, 0xD8C0, 0xBB8A, 0xD4E9, 0x654C, 0x0A2F,
+    0xC290, 0xADF3, 0x1C56, 0x7335, 0x107F, 0x7F1C, 0xCEB9, 0xA1DA,
+    0x082D, 0x674E, 0xD6EB, 0xB988, 0xDAC2, 0xB5A1, 0x0404, 0x6B67,
+    0x3889, 0x57EA, 0xE64F, 0x892C, 0xEA66, 0x8505, 0x34A0, 0x5BC3,
+    0xF234, 0x9D57, 0x2CF2, 0x4391, 0x20DB, 0x4FB8, 0xFE1D, 0x917E,
+    0xB382, 0xDCE1, 0x6D44, 0x0227, 0x616D, 0x0E0E, 0xBFAB, 0xD0C8,
+    0x793F, 0x165C, 0xA7F9, 0xC89A, 0xABD0, 0xC4B3, 0x7516, 0x1A75,
+    0x499B, 0x26F8, 0x975D, 0xF83E, 0x9B74, 0xF417, 0x45B2, 0x2AD1,
+    0x8326, 0xEC45, 0x5DE0, 0x3283, 0x51C9, 0x3EAA, 0x8F0F, 0xE06C,
+    0x28D3, 0x47B0, 0xF615, 0x9976, 0xFA3C, 0x955F, 0x24FA, 0x4B99,
+    0xE26E, 0x8D0D, 0x3CA8, 0x53CB, 0x3081, 0x5FE2, 0xEE47, 0x8124,
+    0xD2CA, 0xBDA9, 0x0C0C, 0x636F, 0x0025, 0x6F46, 0xDEE3, 0xB180,
+    0x1877, 0x7714, 0xC6B1, 0xA9D2, 0xCA98, 0xA5FB, 0x145E, 0x7B3D,
+    0xEA43, 0x8520, 0x3485, 0x5BE6, 0x38AC, 0x57CF, 0xE66A, 0x8909,
+    0x20FE, 0x4F9D, 0xFE38, 0x915B, 0xF211, 0x9D72, 0x2CD7, 0x43B4,
+    0x105A, 0x7F39, 0xCE9C, 0xA1FF, 0xC2B5, 0xADD6, 0x1C73, 0x7310,
+    0xDAE7, 0xB584, 0x0421, 0x6B42, 0x0808, 0x676B, 0xD6CE, 0xB9AD,
+    0x7112, 0x1E71, 0xAFD4, 0xC0B7, 0xA3FD, 0xCC9E, 0x7D3B, 0x1258,
+    0xBBAF, 0xD4CC, 0x6569, 0x0A0A, 0x6940, 0x0623, 0xB786, 0xD8E5,
+    0x8B0B, 0xE468, 0x55CD, 0x3AAE, 0x59E4, 0x3687, 0x8722, 0xE841,
+    0x41B6, 0x2ED5, 0x9F70, 0xF013, 0x9359, 0xFC3A, 0x4D9F, 0x22FC,
+};
+
+// CRC-16/M17
+static const uint16_t crc_catalog_table_64[256] = {
+    0x0000, 0x5935, 0xB26A, 0xEB5F, 0x3DE1, 0x64D4, 0x8F8B, 0xD6BE,
+    0x7BC2, 0x22F7, 0xC9A8, 0x909D, 0x4623, 0x1F16, 0xF449, 0xAD7C,
+    0xF784, 0xAEB1, 0x45EE, 0x1CDB, 0xCA65, 0x9350, 0x780F, 0x213A,
+    0x8C46, 0xD573, 0x3E2C, 0x6719, 0xB1A7, 0xE892, 0x03CD, 0x5AF8,
+    0xB63D, 0xEF08, 0x0457, 0x5D62, 0x8BDC, 0xD2E9, 0x39B6, 0x6083,
+    0xCDFF, 0x94CA, 0x7F95, 0x26A0, 0xF01E, 0xA92B, 0x4274, 0x1B41,
+    0x41B9, 0x188C, 0xF3D3, 0xAAE6, 0x7C58, 0x256D, 0xCE32, 0x9707,
+    0x3A7B, 0x634E, 0x8811, 0xD124, 0x079A, 0x5EAF, 0xB5F0, 0xECC5,
+    0x354F, 0x6C7A, 0x8725, 0xDE10, 0x08AE, 0x519B, 0xBAC4, 0xE3F1,
+    0x4E8D, 0x17B8, 0xFCE7, 0xA5D2, 0x736C, 0x2A59, 0xC106, 0x9833,
+    0xC2CB, 0x9BFE, 0x70A1, 0x2994, 0xFF2A, 0xA61F, 0x4D40, 0x1475,
+    0xB909, 0xE03C, 0x0B63, 0x5256, 0x84E8, 0xDDDD, 0x3682, 0x6FB7,
+    0x8372, 0xDA47, 0x3118, 0x682D, 0xBE93, 0xE7A6, 0x0CF9, 0x55CC,
+    0xF8B0, 0xA185, 0x4ADA, 0x13EF, 0xC551, 0x9C64, 0x773B, 0x2E0E,
+    0x74F6, 0x2DC3, 0xC69C, 0x9FA9, 0x4917, 0x1022, 0xFB7D, 0xA248,
+    0x0F34, 0x5601, 0xBD5E, 0xE46B, 0x32D5, 0x6BE0, 0x80BF, 0xD98A,
+    0x6A9E, 0x33AB, 0xD8F4, 0x81C1, 0x577F, 0x0E4A, 0xE515, 0xBC20,
+    0x115C, 0x4869, 0xA336, 0xFA03, 0x2CBD, 0x7588, 0x9ED7, 0xC7E2,
+    0x9D1A, 0xC42F, 0x2F70, 0x7645, 0xA0FB, 0xF9CE, 0x1291, 0x4BA4,
+    0xE6D8, 0xBFED, 0x54B2, 0x0D87, 0xDB39, 0x820C, 0x6953, 0x3066,
+    0xDCA3, 0x8596, 0x6EC9, 0x37FC, 0xE142, 0xB877, 0x5328, 0x0A1D,
+    0xA761, 0xFE54, 0x150B, 0x4C3E, 0x9A80, 0xC3B5, 0x28EA, 0x71DF,
+    0x2B27, 0x7212, 0x994D, 0xC078, 0x16C6, 0x4FF3, 0xA4AC, 0xFD99,
+    0x50E5, 0x09D0, 0xE28F, 0xBBBA, 0x6D04, 0x3431, 0xDF6E, 0x865B,
+    0x5FD1, 0x06E4, 0xEDBB, 0xB48E, 0x6230, 0x3B05, 0xD05A, 0x896F,
+    0x2413, 0x7D26, 0x9679, 0xCF4C, 0x19F2, 0x40C7, 0xAB98, 0xF2AD,
+    0xA855, 0xF160, 0x1A3F, 0x430A, 0x95B4, 0xCC81, 0x27DE, 0x7EEB,
+    0xD397, 0x8AA2, 0x61FD, 0x38C8, 0xEE76, 0xB743, 0x5C1C, 0x0529,
+    0xE9EC, 0xB0D9, 0x5B86, 0x02B3, 0xD40D, 0x8D38, 0x6667, 0x3F52,
+    0x922E, 0xCB1B, 0x2044, 0x7971, 0xAFCF, 0xF6FA, 0x1DA5, 0x4490,
+    0x1E68, 0x475D, 0xAC02, 0xF537, 0x2389, 0x7ABC, 0x91E3, 0xC8D6,
+    0x65AA, 0x3C9F, 0xD7C0, 0x8EF5, 0x584B, 0x017E, 0xEA21, 0xB314,
+};
+
+// CRC-16/NRSC-5
+static const uint16_t crc_catalog_table_68[256] = {
+    0x0000, 0x35A4, 0x6B48, 0x5EEC, 0xD690, 0xE334, 0xBDD8, 0x887C,
+    0x0D01, 0x38A5, 0x6649, 0x53ED, 0xDB91, 0xEE35, 0xB0D9, 0x857D,
+    0x1A02, 0x2FA6, 0x714A, 0x44EE, 0xCC92, 0xF936, 0xA7DA, 0x927E,
+    0x1703, 0x22A7, 0x7C4B, 0x49EF, 0xC193, 0xF437, 0xAADB, 0x9F7F,
+    0x3404, 0x01A0, 0x5F4C, 0x6AE8, 0xE294, 0xD730, 0x89DC, 0xBC78,
+    0x3905, 0x0CA1, 0x524D, 0x67E9, 0xEF95, 0xDA31, 0x84DD, 0xB179,
+    0x2E06, 0x1BA2, 0x454E, 0x70EA, 0xF896, 0xCD32, 0x93DE, 0xA67A,
+    0x2307, 0x16A3, 0x484F, 0x7DEB, 0xF597, 0xC033, 0x9EDF, 0xAB7B,
+    0x6808, 0x5DAC, 0x0340, 0x36E4, 0xBE98, 0x8B3C, 0xD5D0, 0xE074,
+    0x6509, 0x50AD, 0x0E41, 0x3BE5, 0xB399, 0x863D, 0xD8D1, 0xED75,
+    0x720A, 0x47AE, 0x1942, 0x2CE6, 0xA49A, 0x913E, 0xCFD2, 0xFA76,
+    0x7F0B, 0x4AAF, 0x1443, 0x21E7, 0xA99B, 0x9C3F, 0xC2D3, 0xF777,
+    0x5C0C, 0x69A8, 0x3744, 0x02E0, 0x8A9C, 0xBF38, 0xE1D4, 0xD470,
+    0x510D, 0x64A9, 0x3A45, 0x0FE1, 0x879D, 0xB239, 0xECD5, 0xD971,
+    0x460E, 0x73AA, 0x2D46, 0x18E2, 0x909E, 0xA53A, 0xFBD6, 0xCE72,
+    0x4B0F, 0x7EAB, 0x2047, 0x15E3, 0x9D9F, 0xA83B, 0xF6D7, 0xC373,
+    0xD010, 0xE5B4, 0xBB58, 0x8EFC, 0x0680, 0x3324, 0x6DC8, 0x586C,
+    0xDD11, 0xE8B5, 0xB659, 0x83FD, 0x0B81, 0x3E25, 0x60C9, 0x556D,
+    0xCA12, 0xFFB6, 0xA15A, 0x94FE, 0x1C82, 0x2926, 0x77CA, 0x426E,
+    0xC713, 0xF2B7, 0xAC5B, 0x99FF, 0x1183, 0x2427, 0x7ACB, 0x4F6F,
+    0xE414, 0xD1B0, 0x8F5C, 0xBAF8, 0x3284, 0x0720, 0x59CC, 0x6C68,
+    0xE915, 0xDCB1, 0x825D, 0xB7F9, 0x3F85, 0x0A21, 0x54CD, 0x6169,
+    0xFE16, 0xCBB2, 0x955E, 0xA0FA, 0x2886, 0x1D22, 0x43CE, 0x766A,
+    0xF317, 0xC6B3, 0x985F, 0xADFB, 0x2587, 0x1023, 0x4ECF, 0x7B6B,
+    0xB818, 0x8DBC, 0xD350, 0xE6F4, 0x6E88, 0x5B2C, 0x05C0, 0x3064,
+    0xB519, 0x80BD, 0xDE51, 0xEBF5, 0x6389, 0x562D, 0x08C1, 0x3D65,
+    0xA21A, 0x97BE, 0xC952, 0xFCF6, 0x748A, 0x412E, 0x1FC2, 0x2A66,
+    0xAF1B, 0x9ABF, 0xC453, 0xF1F7, 0x798B, 0x4C2F, 0x12C3, 0x2767,
+    0x8C1C, 0xB9B8, 0xE754, 0xD2F0, 0x5A8C, 0x6F28, 0x31C4, 0x0460,
+    0x811D, 0xB4B9, 0xEA55, 0xDFF1, 0x578D, 0x6229, 0x3CC5, 0x0961,
+    0x961E, 0xA3BA, 0xFD56, 0xC8F2, 0x408E, 0x752A, 0x2BC6, 0x1E62,
+    0x9B1F, 0xAEBB, 0xF057, 0xC5F3, 0x4D8F, 0x782B, 0x26C7, 0x1363,
+};
+
+// CRC-16/OPENSAFETY-B
+static const uint16_t crc_catalog_table_70[256] = {
+    0x0000, 0x755B, 0xEAB6, 0x9FED, 0xA037, 0xD56C, 0x4A81, 0x3FDA,
+    0x3535, 0x406E, 0xDF83, 0xAAD8, 0x9502, 0xE059, 0x7FB4, 0x0AEF,
+    0x6A6A, 0x1F31, 0x80DC, 0xF587, 0xCA5D, 0xBF06, 0x20EB, 0x55B0,
+    0x5F5F, 0x2A04, 0xB5E9, 0xC0B2, 0xFF68, 0x8A33, 0x15DE, 0x6085,
+    0xD4D4, 0xA18F, 0x3E62, 0x4B39, 0x74E3, 0x01B8, 0x9E55, 0xEB0E,
+    0xE1E1, 0x94BA, 0x0B57, 0x7E0C, 0x41D6, 0x348D, 0xAB60, 0xDE3B,
+    0xBEBE, 0xCBE5, 0x5408, 0x2153, 0x1E89, 0x6BD2, 0xF43F, 0x8164,
+    0x8B8B, 0xFED0, 0x613D, 0x1466, 0x2BBC, 0x5EE7, 0xC10A, 0xB451,
+    0xDCF3, 0xA9A8, 0x3645, 0x431E, 0x7CC4, 0x099F, 0x9672, 0xE329,
+    0xE9C6, 0x9C9D, 0x0370, 0x762B, 0x49F1, 0x3CAA, 0xA347, 0xD61C,
+    0xB699, 0xC3C2, 0x5C2F, 0x2974, 0x16AE, 0x63F5, 0xFC18, 0x8943,
+    0x83AC, 0xF6F7, 0x691A, 0x1C41, 0x239B, 0x56C0, 0xC92D, 0xBC76,
+    0x0827, 0x7D7C, 0xE291, 0x97CA, 0xA810, 0xDD4B, 0x42A6, 0x37FD,
+    0x3D12, 0x4849, 0xD7A4, 0xA2FF, 0x9D25, 0xE87E, 0x7793, 0x02C8,
+    0x624D, 0x1716, 0x88FB, 0xFDA0, 0xC27A, 0xB721, 0x28CC, 0x5D97,
+    0x5778, 0x2223, 0xBDCE, 0xC895, 0xF74F, 0x8214, 0x1DF9, 0x68A2,
+    0xCCBD, 0xB9E6, 0x260B, 0x5350, 0x6C8A, 0x19D1, 0x863C, 0xF367,
+    0xF988, 0x8CD3, 0x133E, 0x6665, 0x59BF, 0x2CE4, 0xB309, 0xC652,
+    0xA6D7, 0xD38C, 0x4C61, 0x393A, 0x06E0, 0x73BB, 0xEC56, 0x990D,
+    0x93E2, 0xE6B9, 0x7954, 0x0C0F, 0x33D5, 0x468E, 0xD963, 0xAC38,
+    0x1869, 0x6D32, 0xF2DF, 0x8784, 0xB85E, 0xCD05, 0x52E8, 0x27B3,
+    0x2D5C, 0x5807, 0xC7EA, 0xB2B1, 0x8D6B, 0xF830, 0x67DD, 0x1286,
+    0x7203, 0x0758, 0x98B5, 0xEDEE, 0xD234, 0xA76F, 0x3882, 0x4DD9,
+    0x4736, 0x326D, 0xAD80, 0xD8DB, 0xE701, 0x925A, 0x0DB7, 0x78EC,
+    0x104E, 0x6515, 0xFAF8, 0x8FA3, 0xB079, 0xC522, 0x5ACF, 0x2F94,
+    0x257B, 0x5020, 0xCFCD, 0xBA96, 0x854C, 0xF017, 0x6FFA, 0x1AA1,
+    0x7A24, 0x0F7F, 0x9092, 0xE5C9, 0xDA13, 0xAF48, 0x30A5, 0x45FE,
+    0x4F11, 0x3A4A, 0xA5A7, 0xD0FC, 0xEF26, 0x9A7D, 0x0590, 0x70CB,
+    0xC49A, 0xB1C1, 0x2E2C, 0x5B77, 0x64AD, 0x11F6, 0x8E1B, 0xFB40,
+    0xF1AF, 0x84F4, 0x1B19, 0x6E42, 0x5198, 0x24C3, 0xBB2E, 0xCE75,
+    0xAEF0, 0xDBAB, 0x4446, 0x311D, 0x0EC7, 0x7B9C, 0xE471, 0x912A,
+    0x9BC5, 0xEE9E, 0x7173, 0x0428, 0x3BF2, 0x4EA9, 0xD144, 0xA41F,
+};
+
+// CRC-16/PROFIBUS
+static const uint16_t crc_catalog_table_71[256] = {
+    0x0000, 0x1DCF, 0x3B9E, 0x2651, 0x773C, 0x6AF3, 0x4CA2, 0x516D,
+    0xEE78, 0xF3B7, 0xD5E6, 0xC829, 0x9944, 0x848B, 0xA2DA, 0xBF15,
+    0xC13F, 0xDCF0, 0xFAA1, 0xE76E, 0xB603, 0xABCC, 0x8D9D, 0x9052,
+    0x2F47, 0x3288, 0x14D9, 0x0916, 0x587B, 0x45B4, 0x63E5, 0x7E2A,
+    0x9FB1, 0x827E, 0xA42F, 0xB9E0, 0xE88D, 0xF542, 0xD313, 0xCEDC,
+    0x71C9, 0x6C06, 0x4A57, 0x5798, 0x06F5, 0x1B3A, 0x3D6B, 0x20A4,
+    0x5E8E, 0x4341, 0x6510, 0x78DF, 0x29B2, 0x347D, 0x122C, 0x0FE3,
+    0xB0F6, 0xAD39, 0x8B68, 0x96A7, 0xC7CA, 0xDA05, 0xFC54, 0xE19B,
+    0x22AD, 0x3F62, 0x1933, 0x04FC, 0x5591, 0x485E, 0x6E0F, 0x73C0,
+    0xCCD5, 0xD11A, 0xF74B, 0xEA84, 0xBBE9, 0xA626, 0x8077, 0x9DB8,
+    0xE392, 0xFE5D, 0xD80C, 0xC5C3, 0x94AE, 0x8961, 0xAF30, 0xB2FF,
+    0x0DEA, 0x1025, 0x3674, 0x2BBB, 0x7AD6, 0x6719, 0x4148, 0x5C87,
+    0xBD1C, 0xA0D3, 0x8682, 0x9B4D, 0xCA20, 0xD7EF, 0xF1BE, 0xEC71,
+    0x5364, 0x4EAB, 0x68FA, 0x7535, 0x2458, 0x3997, 0x1FC6, 0x0209,
+    0x7C23, 0x61EC, 0x47BD, 0x5A72, 0x0B1F, 0x16D0, 0x3081, 0x2D4E,
+    0x925B, 0x8F94, 0xA9C5, 0xB40A, 0xE567, 0xF8A8, 0xDEF9, 0xC336,
+    0x455A, 0x5895, 0x7EC4, 0x630B, 0x3266, 0x2FA9, 0x09F8, 0x1437,
+    0xAB22, 0xB6ED, 0x90BC, 0x8D73, 0xDC1E, 0xC1D1, 0xE780, 0xFA4F,
+    0x8465, 0x99AA, 0xBFFB, 0xA234, 0xF359, 0xEE96, 0xC8C7, 0xD508,
+    0x6A1D, 0x77D2, 0x5183, 0x4C4C, 0x1D21, 0x00EE, 0x26BF, 0x3B70,
+    0xDAEB, 0xC724, 0xE175, 0xFCBA, 0xADD7, 0xB018, 0x9649, 0x8B86,
+    0x3493, 0x295C, 0x0F0D, 0x12C2, 0x43AF, 0x5E60, 0x7831, 0x65FE,
+    0x1BD4, 0x061B, 0x204A, 0x3D85, 0x6CE8, 0x7127, 0x5776, 0x4AB9,
+    0xF5AC, 0xE863, 0xCE32, 0xD3FD, 0x8290, 0x9F5F, 0xB90E, 0xA4C1,
+    0x67F7, 0x7A38, 0x5C69, 0x41A6, 0x10CB, 0x0D04, 0x2B55, 0x369A,
+    0x898F, 0x9440, 0xB211, 0xAFDE, 0xFEB3, 0xE37C, 0xC52D, 0xD8E2,
+    0xA6C8, 0xBB07, 0x9D56, 0x8099, 0xD1F4, 0xCC3B, 0xEA6A, 0xF7A5,
+    0x48B0, 0x557F, 0x732E, 0x6EE1, 0x3F8C, 0x2243, 0x0412, 0x19DD,
+    0xF846, 0xE589, 0xC3D8, 0xDE17, 0x8F7A, 0x92B5, 0xB4E4, 0xA92B,
+    0x163E, 0x0BF1, 0x2DA0, 0x306F, 0x6102, 0x7CCD, 0x5A9C, 0x4753,
+    0x3979, 0x24B6, 0x02E7, 0x1F28, 0x4E45, 0x538A, 0x75DB, 0x6814,
+    0xD701, 0xCACE, 0xEC9F, 0xF150, 0xA03D, 0xBDF2, 0x9BA3, 0x866C,
+};
+
+// CRC-16/T10-DIF
+static const uint16_t crc_catalog_table_74[256] = {
+    0x0000, 0x8BB7, 0x9CD9, 0x176E, 0xB205, 0x39B2, 0x2EDC, 0xA56B,
+    0xEFBD, 0x640A, 0x7364, 0xF8D3, 0x5DB8, 0xD60F, 0xC161, 0x4AD6,
+    0x54CD, 0xDF7A, 0xC814, 0x43A3, 0xE6C8, 0x6D7F, 0x7A11, 0xF1A6,
+    0xBB70, 0x30C7, 0x27A9, 0xAC1E, 0x0975, 0x82C2, 0x95AC, 0x1E1B,
+    0xA99A, 0x222D, 0x3543, 0xBEF4, 0x1B9F, 0x9028, 0x8746, 0x0CF1,
+    0x4627, 0xCD90, 0xDAFE, 0x5149, 0xF422, 0x7F95, 0x68FB, 0xE34C,
+    0xFD57, 0x76E0, 0x618E, 0xEA39, 0x4F52, 0xC4E5, 0xD38B, 0x583C,
+    0x12EA, 0x995D, 0x8E33, 0x0584, 0xA0EF, 0x2B58, 0x3C36, 0xB781,
+    0xD883, 0x5334, 0x445A, 0xCFED, 0x6A86, 0xE131, 0xF65F, 0x7DE8,
+    0x373E, 0xBC89, 0xABE7, 0x2050, 0x853B, 0x0E8C, 0x19E2, 0x9255,
+    0x8C4E, 0x07F9, 0x1097, 0x9B20, 0x3E4B, 0xB5FC, 0xA292, 0x2925,
+    0x63F3, 0xE844, 0xFF2A, 0x749D, 0xD1F6, 0x5A41, 0x4D2F, 0xC698,
+    0x7119, 0xFAAE, 0xEDC0, 0x6677, 0xC31C, 0x48AB, 0x5FC5, 0xD472,
+    0x9EA4, 0x1513, 0x027D, 0x89CA, 0x2CA1, 0xA716, 0xB078, 0x3BCF,
+    0x25D4, 0xAE63, 0xB90D, 0x32BA, 0x97D1, 0x1C66, 0x0B08, 0x80BF,
+    0xCA69, 0x41DE, 0x56B0, 0xDD07, 0x786C, 0xF3DB, 0xE4B5, 0x6F02,
+    0x3AB1, 0xB106, 0xA668, 0x2DDF, 0x88B4, 0x0303, 0x146D, 0x9FDA,
+    0xD50C, 0x5EBB, 0x49D5, 0xC262, 0x6709, 0xECBE, 0xFBD0, 0x7067,
+    0x6E7C, 0xE5CB, 0xF2A5, 0x7912, 0xDC79, 0x57CE, 0x40A0, 0xCB17,
+    0x81C1, 0x0A76, 0x1D18, 0x96AF, 0x33C4, 0xB873, 0xAF1D, 0x24AA,
+    0x932B, 0x189C, 0x0FF2, 0x8445, 0x212E, 0xAA99, 0xBDF7, 0x3640,
+    0x7C96, 0xF721, 0xE04F, 0x6BF8, 0xCE93, 0x4524, 0x524A, 0xD9FD,
+    0xC7E6, 0x4C51, 0x5B3F, 0xD088, 0x75E3, 0xFE54, 0xE93A, 0x628D,
+    0x285B, 0xA3EC, 0xB482, 0x3F35, 0x9A5E, 0x11E9, 0x0687, 0x8D30,
+    0xE232, 0x6985, 0x7EEB, 0xF55C, 0x5037, 0xDB80, 0xCCEE, 0x4759,
+    0x0D8F, 0x8638, 0x9156, 0x1AE1, 0xBF8A, 0x343D, 0x2353, 0xA8E4,
+    0xB6FF, 0x3D48, 0x2A26, 0xA191, 0x04FA, 0x8F4D, 0x9823, 0x1394,
+    0x5942, 0xD2F5, 0xC59B, 0x4E2C, 0xEB47, 0x60F0, 0x779E, 0xFC29,
+    0x4BA8, 0xC01F, 0xD771, 0x5CC6, 0xF9AD, 0x721A, 0x6574, 0xEEC3,
+    0xA415, 0x2FA2, 0x38CC, 0xB37B, 0x1610, 0x9DA7, 0x8AC9, 0x017E,
+    0x1F65, 0x94D2, 0x83BC, 0x080B, 0xAD60, 0x26D7, 0x31B9, 0xBA0E,
+    0xF0D8, 0x7B6F, 0x6C01, 0xE7B6, 0x42DD, 0xC96A, 0xDE04, 0x55B3,
+};
+
+// CRC-16/TELEDISK
+static const uint16_t crc_catalog_table_75[256] = {
+    0x0000, 0xA097, 0xE1B9, 0x412E, 0x63E5, 0xC372, 0x825C, 0x22CB,
+    0xC7CA, 0x675D, 0x2673, 0x86E4, 0xA42F, 0x04B8, 0x4596, 0xE501,
+    0x2F03, 0x8F94, 0xCEBA, 0x6E2D, 0x4CE6, 0xEC71, 0xAD5F, 0x0DC8,
+    0xE8C9, 0x485E, 0x0970, 0xA9E7, 0x8B2C, 0x2BBB, 0x6A95, 0xCA02,
+    0x5E06, 0xFE91, 0xBFBF, 0x1F28, 0x3DE3, 0x9D74, 0xDC5A, 0x7CCD,
+    0x99CC, 0x395B, 0x7875, 0xD8E2, 0xFA29, 0x5ABE, 0x1B90, 0xBB07,
+    0x7105, 0xD192, 0x90BC, 0x302B, 0x12E0, 0xB277, 0xF359, 0x53CE,
+    0xB6CF, 0x1658, 0x5776, 0xF7E1, 0xD52A, 0x75BD, 0x3493, 0x9404,
+    0xBC0C, 0x1C9B, 0x5DB5, 0xFD22, 0xDFE9, 0x7F7E, 0x3E50, 0x9EC7,
+    0x7BC6, 0xDB51, 0x9A7F, 0x3AE8, 0x1823, 0xB8B4, 0xF99A, 0x590D,
+    0x930F, 0x3398, 0x72B6, 0xD221, 0xF0EA, 0x507D, 0x1153, 0xB1C4,
+    0x54C5, 0xF452, 0xB57C, 0x15EB, 0x3720, 0x97B7, 0xD699, 0x760E,
+    0xE20A, 0x429D, 0x03B3, 0xA324, 0x81EF, 0x2178, 0x6056, 0xC0C1,
+    0x25C0, 0x8557, 0xC479, 0x64EE, 0x4625, 0xE6B2, 0xA79C, 0x070B,
+    0xCD09, 0x6D9E, 0x2CB0, 0x8C27, 0xAEEC, 0x0E7B, 0x4F55, 0xEFC2,
+    0x0AC3, 0xAA54, 0xEB7A, 0x4BED, 0x6926, 0xC9B1, 0x889F, 0x2808,
+    0xD88F, 0x7818, 0x3936, 0x99A1, 0xBB6A, 0x1BFD, 0x5AD3, 0xFA44,
+    0x1F45, 0xBFD2, 0xFEFC, 0x5E6B, 0x7CA0, 0xDC37, 0x9D19, 0x3D8E,
+    0xF78C, 0x571B, 0x1635, 0xB6A2, 0x9469, 0x34FE, 0x75D0, 0xD547,
+    0x3046, 0x90D1, 0xD1FF, 0x7168, 0x53A3, 0xF334, 0xB21A, 0x128D,
+    0x8689, 0x261E, 0x6730, 0xC7A7, 0xE56C, 0x45FB, 0x04D5, 0xA442,
+    0x4143, 0xE1D4, 0xA0FA, 0x006D, 0x22A6, 0x8231, 0xC31F, 0x6388,
+    0xA98A, 0x091D, 0x4833, 0xE8A4, 0xCA6F, 0x6AF8, 0x2BD6, 0x8B41,
+    0x6E40, 0xCED7, 0x8FF9, 0x2F6E, 0x0DA5, 0xAD32, 0xEC1C, 0x4C8B,
+    0x6483, 0xC414, 0x853A, 0x25AD, 0x0766, 0xA7F1, 0xE6DF, 0x4648,
+    0xA349, 0x03DE, 0x42F0, 0xE267, 0xC0AC, 0x603B, 0x2115, 0x8182,
+    0x4B80, 0xEB17, 0xAA39, 0x0AAE, 0x2865, 0x88F2, 0xC9DC, 0x694B,
+    0x8C4A, 0x2CDD, 0x6DF3, 0xCD64, 0xEFAF, 0x4F38, 0x0E16, 0xAE81,
+    0x3A85, 0x9A12, 0xDB3C, 0x7BAB, 0x5960, 0xF9F7, 0xB8D9, 0x184E,
+    0xFD4F, 0x5DD8, 0x1CF6, 0xBC61, 0x9EAA, 0x3E3D, 0x7F13, 0xDF84,
+    0x1586, 0xB511, 0xF43F, 0x54A8, 0x7663, 0xD6F4, 0x97DA, 0x374D,
+    0xD24C, 0x72DB, 0x33F5, 0x9362, 0xB1A9, 0x113E, 0x5010, 0xF087,
+};
+
+// CRC-17/CAN-FD
+static const uint32_t crc_catalog_table_80[256] = {
+    0x00000000, 0x00B42D80, 0x00DC7680, 0x00685B00, 0x000CC080, 0x00B8ED00, 0x00D0B600, 0x00649B80,
+    0x00198100, 0x00ADAC80, 0x00C5F780, 0x0071DA00, 0x00154180, 0x00A16C00, 0x00C93700, 0x007D1A80,
+    0x00330200, 0x00872F80, 0x00EF7480, 0x005B5900, 0x003FC280, 0x008BEF00, 0x00E3B400, 0x00579980,
+    0x002A8300, 0x009EAE80, 0x00F6F580, 0x0042D800, 0x00264380, 0x00926E00, 0x00FA3500, 0x004E1880,
+    0x00660400, 0x00D22980, 0x00BA7280, 0x000E5F00, 0x006AC480, 0x00DEE900, 0x00B6B200, 0x00029F80,
+    0x007F8500, 0x00CBA880, 0x00A3F380, 0x0017DE00, 0x00734580, 0x00C76800, 0x00AF3300, 0x001B1E80,
+    0x00550600, 0x00E12B80, 0x00897080, 0x003D5D00, 0x0059C680, 0x00EDEB00, 0x0085B000, 0x00319D80,
+    0x004C8700, 0x00F8AA80, 0x0090F180, 0x0024DC00, 0x00404780, 0x00F46A00, 0x009C3100, 0x00281C80,
+    0x00CC0800, 0x00782580, 0x00107E80, 0x00A45300, 0x00C0C880, 0x0074E500, 0x001CBE00, 0x00A89380,
+    0x00D58900, 0x0061A480, 0x0009FF80, 0x00BDD200, 0x00D94980, 0x006D6400, 0x00053F00, 0x00B11280,
+    0x00FF0A00, 0x004B2780, 0x00237C80, 0x00975100, 0x00F3CA80, 0x0047E700, 0x002FBC00, 0x009B9180,
+    0x00E68B00, 0x0052A680, 0x003AFD80, 0x008ED000, 0x00EA4B80, 0x005E6600, 0x00363D00, 0x00821080,
+    0x00AA0C00, 0x001E2180, 0x00767A80, 0x00C25700, 0x00A6CC80, 0x0012E100, 0x007ABA00, 0x00CE9780,
+    0x00B38D00, 0x0007A080, 0x006FFB80, 0x00DBD600, 0x00BF4D80, 0x000B6000, 0x00633B00, 0x00D71680,
+    0x00990E00, 0x002D2380, 0x00457880, 0x00F15500, 0x0095CE80, 0x0021E300, 0x0049B800, 0x00FD9580,
+    0x00808F00, 0x0034A280, 0x005CF980, 0x00E8D400, 0x008C4F80, 0x00386200, 0x00503900, 0x00E41480,
+    0x002C3D80, 0x00981000, 0x00F04B00, 0x00446680, 0x0020FD00, 0x0094D080, 0x00FC8B80, 0x0048A600,
+    0x0035BC80, 0x00819100, 0x00E9CA00, 0x005DE780, 0x00397C00, 0x008D5180, 0x00E50A80, 0x00512700,
+    0x001F3F80, 0x00AB1200, 0x00C34900, 0x00776480, 0x0013FF00, 0x00A7D280, 0x00CF8980, 0x007BA400,
+    0x0006BE80, 0x00B29300, 0x00DAC800, 0x006EE580, 0x000A7E00, 0x00BE5380, 0x00D60880, 0x00622500,
+    0x004A3980, 0x00FE1400, 0x00964F00, 0x00226280, 0x0046F900, 0x00F2D480, 0x009A8F80, 0x002EA200,
+    0x0053B880, 0x00E79500, 0x008FCE00, 0x003BE380, 0x005F7800, 0x00EB5580, 0x00830E80, 0x00372300,
+    0x00793B80, 0x00CD1600, 0x00A54D00, 0x00116080, 0x0075FB00, 0x00C1D680, 0x00A98D80, 0x001DA000,
+    0x0060BA80, 0x00D49700, 0x00BCCC00, 0x0008E180, 0x006C7A00, 0x00D85780, 0x00B00C80, 0x00042100,
+    0x00E03580, 0x00541800, 0x003C4300, 0x00886E80, 0x00ECF500, 0x0058D880, 0x00308380, 0x0084AE00,
+    0x00F9B480, 0x004D9900, 0x0025C200, 0x0091EF80, 0x00F57400, 0x00415980, 0x00290280, 0x009D2F00,
+    0x00D33780, 0x00671A00, 0x000F4100, 0x00BB6C80, 0x00DFF700, 0x006BDA80, 0x00038180, 0x00B7AC00,
+    0x00CAB680, 0x007E9B00, 0x0016C000, 0x00A2ED80, 0x00C67600, 0x00725B80, 0x001A0080, 0x00AE2D00,
+    0x00863180, 0x00321C00, 0x005A4700, 0x00EE6A80, 0x008AF100, 0x003EDC80, 0x00568780, 0x00E2AA00,
+    0x009FB080, 0x002B9D00, 0x0043C600, 0x00F7EB80, 0x00937000, 0x00275D80, 0x004F0680, 0x00FB2B00,
+    0x00B53380, 0x00011E00, 0x00694500, 0x00DD6880, 0x00B9F300, 0x000DDE80, 0x00658580, 0x00D1A800,
+    0x00ACB280, 0x00189F00, 0x0070C400, 0x00C4E980, 0x00A07200, 0x00145F80, 0x007C0480, 0x00C82900,
+};
+
+// CRC-21/CAN-FD
+static const uint32_t crc_catalog_table_81[256] = {
+    0x00000000, 0x008144C8, 0x0083CD58, 0x00028990, 0x0086DE78, 0x00079AB0, 0x00051320, 0x008457E8,
+    0x008CF838, 0x000DBCF0, 0x000F3560, 0x008E71A8, 0x000A2640, 0x008B6288, 0x0089EB18, 0x0008AFD0,
+    0x0098B4B8, 0x0019F070, 0x001B79E0, 0x009A3D28, 0x001E6AC0, 0x009F2E08, 0x009DA798, 0x001CE350,
+    0x00144C80, 0x00950848, 0x009781D8, 0x0016C510, 0x009292F8, 0x0013D630, 0x00115FA0, 0x00901B68,
+    0x00B02DB8, 0x00316970, 0x0033E0E0, 0x00B2A428, 0x0036F3C0, 0x00B7B708, 0x00B53E98, 0x00347A50,
+    0x003CD580, 0x00BD9148, 0x00BF18D8, 0x003E5C10, 0x00BA0BF8, 0x003B4F30, 0x0039C6A0, 0x00B88268,
+    0x00289900, 0x00A9DDC8, 0x00AB5458, 0x002A1090, 0x00AE4778, 0x002F03B0, 0x002D8A20, 0x00ACCEE8,
+    0x00A46138, 0x002525F0, 0x0027AC60, 0x00A6E8A8, 0x0022BF40, 0x00A3FB88, 0x00A17218, 0x002036D0,
+    0x00E11FB8, 0x00605B70, 0x0062D2E0, 0x00E39628, 0x0067C1C0, 0x00E68508, 0x00E40C98, 0x00654850,
+    0x006DE780, 0x00ECA348, 0x00EE2AD8, 0x006F6E10, 0x00EB39F8, 0x006A7D30, 0x0068F4A0, 0x00E9B068,
+    0x0079AB00, 0x00F8EFC8, 0x00FA6658, 0x007B2290, 0x00FF7578, 0x007E31B0, 0x007CB820, 0x00FDFCE8,
+    0x00F55338, 0x007417F0, 0x00769E60, 0x00F7DAA8, 0x00738D40, 0x00F2C988, 0x00F04018, 0x007104D0,
+    0x00513200, 0x00D076C8, 0x00D2FF58, 0x0053BB90, 0x00D7EC78, 0x0056A8B0, 0x00542120, 0x00D565E8,
+    0x00DDCA38, 0x005C8EF0, 0x005E0760, 0x00DF43A8, 0x005B1440, 0x00DA5088, 0x00D8D918, 0x00599DD0,
+    0x00C986B8, 0x0048C270, 0x004A4BE0, 0x00CB0F28, 0x004F58C0, 0x00CE1C08, 0x00CC9598, 0x004DD150,
+    0x00457E80, 0x00C43A48, 0x00C6B3D8, 0x0047F710, 0x00C3A0F8, 0x0042E430, 0x00406DA0, 0x00C12968,
+    0x00437BB8, 0x00C23F70, 0x00C0B6E0, 0x0041F228, 0x00C5A5C0, 0x0044E108, 0x00466898, 0x00C72C50,
+    0x00CF8380, 0x004EC748, 0x004C4ED8, 0x00CD0A10, 0x00495DF8, 0x00C81930, 0x00CA90A0, 0x004BD468,
+    0x00DBCF00, 0x005A8BC8, 0x00580258, 0x00D94690, 0x005D1178, 0x00DC55B0, 0x00DEDC20, 0x005F98E8,
+    0x00573738, 0x00D673F0, 0x00D4FA60, 0x0055BEA8, 0x00D1E940, 0x0050AD88, 0x00522418, 0x00D360D0,
+    0x00F35600, 0x007212C8, 0x00709B58, 0x00F1DF90, 0x00758878, 0x00F4CCB0, 0x00F64520, 0x007701E8,
+    0x007FAE38, 0x00FEEAF0, 0x00FC6360, 0x007D27A8, 0x00F97040, 0x00783488, 0x007ABD18, 0x00FBF9D0,
+    0x006BE2B8, 0x00EAA670, 0x00E82FE0, 0x00696B28, 0x00ED3CC0, 0x006C7808, 0x006EF198, 0x00EFB550,
+    0x00E71A80, 0x00665E48, 0x0064D7D8, 0x00E59310, 0x0061C4F8, 0x00E08030, 0x00E209A0, 0x00634D68,
+    0x00A26400, 0x002320C8, 0x0021A958, 0x00A0ED90, 0x0024BA78, 0x00A5FEB0, 0x00A77720, 0x002633E8,
+    0x002E9C38, 0x00AFD8F0, 0x00AD5160, 0x002C15A8, 0x00A84240, 0x00290688, 0x002B8F18, 0x00AACBD0,
+    0x003AD0B8, 0x00BB9470, 0x00B91DE0, 0x00385928, 0x00BC0EC0, 0x003D4A08, 0x003FC398, 0x00BE8750,
+    0x00B62880, 0x00376C48, 0x0035E5D8, 0x00B4A110, 0x0030F6F8, 0x00B1B230, 0x00B33BA0, 0x00327F68,
+    0x001249B8, 0x00930D70, 0x009184E0, 0x0010C028, 0x009497C0, 0x0015D308, 0x00175A98, 0x00961E50,
+    0x009EB180, 0x001FF548, 0x001D7CD8, 0x009C3810, 0x00186FF8, 0x00992B30, 0x009BA2A0, 0x001AE668,
+    0x008AFD00, 0x000BB9C8, 0x00093058, 0x00887490, 0x000C2378, 0x008D67B0, 0x008FEE20, 0x000EAAE8,
+    0x00060538, 0x008741F0, 0x0085C860, 0x00048CA8, 0x0080DB40, 0x00019F88, 0x00031618, 0x008252D0,
+};
+
+// CRC-24/BLE
+static const uint32_t crc_catalog_table_82[256] = {
+    0x00000000, 0x0001B4C0, 0x00036980, 0x0002DD40, 0x0006D300, 0x000767C0, 0x0005BA80, 0x00040E40,
+    0x000DA600, 0x000C12C0, 0x000ECF80, 0x000F7B40, 0x000B7500, 0x000AC1C0, 0x00081C80, 0x0009A840,
+    0x001B4C00, 0x001AF8C0, 0x00182580, 0x00199140, 0x001D9F00, 0x001C2BC0, 0x001EF680, 0x001F4240,
+    0x0016EA00, 0x00175EC0, 0x00158380, 0x00143740, 0x00103900, 0x00118DC0, 0x00135080, 0x0012E440,
+    0x00369800, 0x00372CC0, 0x0035F180, 0x00344540, 0x00304B00, 0x0031FFC0, 0x00332280, 0x00329640,
+    0x003B3E00, 0x003A8AC0, 0x00385780, 0x0039E340, 0x003DED00, 0x003C59C0, 0x003E8480, 0x003F3040,
+    0x002DD400, 0x002C60C0, 0x002EBD80, 0x002F0940, 0x002B0700, 0x002AB3C0, 0x00286E80, 0x0029DA40,
+    0x00207200, 0x0021C6C0, 0x00231B80, 0x0022AF40, 0x0026A100, 0x002715C0, 0x0025C880, 0x00247C40,
+    0x006D3000, 0x006C84C0, 0x006E5980, 0x006FED40, 0x006BE300, 0x006A57C0, 0x00688A80, 0x00693E40,
+    0x00609600, 0x006122C0, 0x0063FF80, 0x00624B40, 0x00664500, 0x0067F1C0, 0x00652C80, 0x00649840,
+    0x00767C00, 0x0077C8C0, 0x00751580, 0x0074A140, 0x0070AF00, 0x00711BC0, 0x0073C680, 0x00727240,
+    0x007BDA00, 0x007A6EC0, 0x0078B380, 0x00790740, 0x007D0900, 0x007CBDC0, 0x007E6080, 0x007FD440,
+    0x005BA800, 0x005A1CC0, 0x0058C180, 0x00597540, 0x005D7B00, 0x005CCFC0, 0x005E1280, 0x005FA640,
+    0x00560E00, 0x0057BAC0, 0x00556780, 0x0054D340, 0x0050DD00, 0x005169C0, 0x0053B480, 0x00520040,
+    0x0040E400, 0x004150C0, 0x00438D80, 0x00423940, 0x00463700, 0x004783C0, 0x00455E80, 0x0044EA40,
+    0x004D4200, 0x004CF6C0, 0x004E2B80, 0x004F9F40, 0x004B9100, 0x004A25C0, 0x0048F880, 0x00494C40,
+    0x00DA6000, 0x00DBD4C0, 0x00D90980, 0x00D8BD40, 0x00DCB300, 0x00DD07C0, 0x00DFDA80, 0x00DE6E40,
+    0x00D7C600, 0x00D672C0, 0x00D4AF80, 0x00D51B40, 0x00D11500, 0x00D0A1C0, 0x00D27C80, 0x00D3C840,
+    0x00C12C00, 0x00C098C0, 0x00C24580, 0x00C3F140, 0x00C7FF00, 0x00C64BC0, 0x00C49680, 0x00C52240,
+    0x00CC8A00, 0x00CD3EC0, 0x00CFE380, 0x00CE5740, 0x00CA5900, 0x00CBEDC0, 0x00C93080, 0x00C88440,
+    0x00ECF800, 0x00ED4CC0, 0x00EF9180, 0x00EE2540, 0x00EA2B00, 0x00EB9FC0, 0x00E94280, 0x00E8F640,
+    0x00E15E00, 0x00E0EAC0, 0x00E23780, 0x00E38340, 0x00E78D00, 0x00E639C0, 0x00E4E480, 0x00E55040,
+    0x00F7B400, 0x00F600C0, 0x00F4DD80, 0x00F56940, 0x00F16700, 0x00F0D3C0, 0x00F20E80, 0x00F3BA40,
+    0x00FA1200, 0x00FBA6C0, 0x00F97B80, 0x00F8CF40, 0x00FCC100, 0x00FD75C0, 0x00FFA880, 0x00FE1C40,
+    0x00B75000, 0x00B6E4C0, 0x00B43980, 0x00B58D40, 0x00B18300, 0x00B037C0, 0x00B2EA80, 0x00B35E40,
+    0x00BAF600, 0x00BB42C0, 0x00B99F80, 0x00B82B40, 0x00BC2500, 0x00BD91C0, 0x00BF4C80, 0x00BEF840,
+    0x00AC1C00, 0x00ADA8C0, 0x00AF7580, 0x00AEC140, 0x00AACF00, 0x00AB7BC0, 0x00A9A680, 0x00A81240,
+    0x00A1BA00, 0x00A00EC0, 0x00A2D380, 0x00A36740, 0x00A76900, 0x00A6DDC0, 0x00A40080, 0x00A5B440,
+    0x0081C800, 0x00807CC0, 0x0082A180, 0x00831540, 0x00871B00, 0x0086AFC0, 0x00847280, 0x0085C640,
+    0x008C6E00, 0x008DDAC0, 0x008F0780, 0x008EB340, 0x008ABD00, 0x008B09C0, 0x0089D480, 0x00886040,
+    0x009A8400, 0x009B30C0, 0x0099ED80, 0x00985940, 0x009C5700, 0x009DE3C0, 0x009F3E80, 0x009E8A40,
+    0x00972200, 0x009696C0, 0x00944B80, 0x0095FF40, 0x0091F100, 0x009045C0, 0x00929880, 0x00932C40,
+};
+
+// CRC-24/FLEXRAY-A
+static const uint32_t crc_catalog_table_83[256] = {
+    0x00000000, 0x005D6DCB, 0x00BADB96, 0x00E7B65D, 0x0028DAE7, 0x0075B72C, 0x00920171, 0x00CF6CBA,
+    0x0051B5CE, 0x000CD805, 0x00EB6E58, 0x00B60393, 0x00796F29, 0x002402E2, 0x00C3B4BF, 0x009ED974,
+    0x00A36B9C, 0x00FE0657, 0x0019B00A, 0x0044DDC1, 0x008BB17B, 0x00D6DCB0, 0x00316AED, 0x006C0726,
+    0x00F2DE52, 0x00AFB399, 0x004805C4, 0x0015680F, 0x00DA04B5, 0x0087697E, 0x0060DF23, 0x003DB2E8,
+    0x001BBAF3, 0x0046D738, 0x00A16165, 0x00FC0CAE, 0x00336014, 0x006E0DDF, 0x0089BB82, 0x00D4D649,
+    0x004A0F3D, 0x001762F6, 0x00F0D4AB, 0x00ADB960, 0x0062D5DA, 0x003FB811, 0x00D80E4C, 0x00856387,
+    0x00B8D16F, 0x00E5BCA4, 0x00020AF9, 0x005F6732, 0x00900B88, 0x00CD6643, 0x002AD01E, 0x0077BDD5,
+    0x00E964A1, 0x00B4096A, 0x0053BF37, 0x000ED2FC, 0x00C1BE46, 0x009CD38D, 0x007B65D0, 0x0026081B,
+    0x003775E6, 0x006A182D, 0x008DAE70, 0x00D0C3BB, 0x001FAF01, 0x0042C2CA, 0x00A57497, 0x00F8195C,
+    0x0066C028, 0x003BADE3, 0x00DC1BBE, 0x00817675, 0x004E1ACF, 0x00137704, 0x00F4C159, 0x00A9AC92,
+    0x00941E7A, 0x00C973B1, 0x002EC5EC, 0x0073A827, 0x00BCC49D, 0x00E1A956, 0x00061F0B, 0x005B72C0,
+    0x00C5ABB4, 0x0098C67F, 0x007F7022, 0x00221DE9, 0x00ED7153, 0x00B01C98, 0x0057AAC5, 0x000AC70E,
+    0x002CCF15, 0x0071A2DE, 0x00961483, 0x00CB7948, 0x000415F2, 0x00597839, 0x00BECE64, 0x00E3A3AF,
+    0x007D7ADB, 0x00201710, 0x00C7A14D, 0x009ACC86, 0x0055A03C, 0x0008CDF7, 0x00EF7BAA, 0x00B21661,
+    0x008FA489, 0x00D2C942, 0x00357F1F, 0x006812D4, 0x00A77E6E, 0x00FA13A5, 0x001DA5F8, 0x0040C833,
+    0x00DE1147, 0x00837C8C, 0x0064CAD1, 0x0039A71A, 0x00F6CBA0, 0x00ABA66B, 0x004C1036, 0x00117DFD,
+    0x006EEBCC, 0x00338607, 0x00D4305A, 0x00895D91, 0x0046312B, 0x001B5CE0, 0x00FCEABD, 0x00A18776,
+    0x003F5E02, 0x006233C9, 0x00858594, 0x00D8E85F, 0x001784E5, 0x004AE92E, 0x00AD5F73, 0x00F032B8,
+    0x00CD8050, 0x0090ED9B, 0x00775BC6, 0x002A360D, 0x00E55AB7, 0x00B8377C, 0x005F8121, 0x0002ECEA,
+    0x009C359E, 0x00C15855, 0x0026EE08, 0x007B83C3, 0x00B4EF79, 0x00E982B2, 0x000E34EF, 0x00535924,
+    0x0075513F, 0x00283CF4, 0x00CF8AA9, 0x0092E762, 0x005D8BD8, 0x0000E613, 0x00E7504E, 0x00BA3D85,
+    0x0024E4F1, 0x0079893A, 0x009E3F67, 0x00C352AC, 0x000C3E16, 0x005153DD, 0x00B6E580, 0x00EB884B,
+    0x00D63AA3, 0x008B5768, 0x006CE135, 0x00318CFE, 0x00FEE044, 0x00A38D8F, 0x00443BD2, 0x00195619,
+    0x00878F6D, 0x00DAE2A6, 0x003D54FB, 0x00603930, 0x00AF558A, 0x00F23841, 0x00158E1C, 0x0048E3D7,
+    0x00599E2A, 0x0004F3E1, 0x00E345BC, 0x00BE2877, 0x007144CD, 0x002C2906, 0x00CB9F5B, 0x0096F290,
+    0x00082BE4, 0x0055462F, 0x00B2F072, 0x00EF9DB9, 0x0020F103, 0x007D9CC8, 0x009A2A95, 0x00C7475E,
+    0x00FAF5B6, 0x00A7987D, 0x00402E20, 0x001D43EB, 0x00D22F51, 0x008F429A, 0x0068F4C7, 0x0035990C,
+    0x00AB4078, 0x00F62DB3, 0x00119BEE, 0x004CF625, 0x00839A9F, 0x00DEF754, 0x00394109, 0x00642CC2,
+    0x004224D9, 0x001F4912, 0x00F8FF4F, 0x00A59284, 0x006AFE3E, 0x003793F5, 0x00D025A8, 0x008D4863,
+    0x00139117, 0x004EFCDC, 0x00A94A81, 0x00F4274A, 0x003B4BF0, 0x0066263B, 0x00819066, 0x00DCFDAD,
+    0x00E14F45, 0x00BC228E, 0x005B94D3, 0x0006F918, 0x00C995A2, 0x0094F869, 0x00734E34, 0x002E23FF,
+    0x00B0FA8B, 0x00ED9740, 0x000A211D, 0x00574CD6, 0x0098206C, 0x00C54DA7, 0x0022FBFA, 0x007F9631,
+};
+
+// CRC-24/INTERLAKEN
+static const uint32_t crc_catalog_table_85[256] = {
+    0x00000000, 0x00328B63, 0x006516C6, 0x00579DA5, 0x00CA2D8C, 0x00F8A6EF, 0x00AF3B4A, 0x009DB029,
+    0x00A6D07B, 0x00945B18, 0x00C3C6BD, 0x00F14DDE, 0x006CFDF7, 0x005E7694, 0x0009EB31, 0x003B6052,
+    0x007F2B95, 0x004DA0F6, 0x001A3D53, 0x0028B630, 0x00B50619, 0x00878D7A, 0x00D010DF, 0x00E29BBC,
+    0x00D9FBEE, 0x00EB708D, 0x00BCED28, 0x008E664B, 0x0013D662, 0x00215D01, 0x0076C0A4, 0x00444BC7,
+    0x00FE572A, 0x00CCDC49, 0x009B41EC, 0x00A9CA8F, 0x00347AA6, 0x0006F1C5, 0x00516C60, 0x0063E703,
+    0x00588751, 0x006A0C32, 0x003D9197, 0x000F1AF4, 0x0092AADD, 0x00A021BE, 0x00F7BC1B, 0x00C53778,
+    0x00817CBF, 0x00B3F7DC, 0x00E46A79, 0x00D6E11A, 0x004B5133, 0x0079DA50, 0x002E47F5, 0x001CCC96,
+    0x0027ACC4, 0x001527A7, 0x0042BA02, 0x00703161, 0x00ED8148, 0x00DF0A2B, 0x0088978E, 0x00BA1CED,
+    0x00CE2537, 0x00FCAE54, 0x00AB33F1, 0x0099B892, 0x000408BB, 0x003683D8, 0x00611E7D, 0x0053951E,
+    0x0068F54C, 0x005A7E2F, 0x000DE38A, 0x003F68E9, 0x00A2D8C0, 0x009053A3, 0x00C7CE06, 0x00F54565,
+    0x00B10EA2, 0x008385C1, 0x00D41864, 0x00E69307, 0x007B232E, 0x0049A84D, 0x001E35E8, 0x002CBE8B,
+    0x0017DED9, 0x002555BA, 0x0072C81F, 0x0040437C, 0x00DDF355, 0x00EF7836, 0x00B8E593, 0x008A6EF0,
+    0x0030721D, 0x0002F97E, 0x005564DB, 0x0067EFB8, 0x00FA5F91, 0x00C8D4F2, 0x009F4957, 0x00ADC234,
+    0x0096A266, 0x00A42905, 0x00F3B4A0, 0x00C13FC3, 0x005C8FEA, 0x006E0489, 0x0039992C, 0x000B124F,
+    0x004F5988, 0x007DD2EB, 0x002A4F4E, 0x0018C42D, 0x00857404, 0x00B7FF67, 0x00E062C2, 0x00D2E9A1,
+    0x00E989F3, 0x00DB0290, 0x008C9F35, 0x00BE1456, 0x0023A47F, 0x00112F1C, 0x0046B2B9, 0x007439DA,
+    0x00AEC10D, 0x009C4A6E, 0x00CBD7CB, 0x00F95CA8, 0x0064EC81, 0x005667E2, 0x0001FA47, 0x00337124,
+    0x00081176, 0x003A9A15, 0x006D07B0, 0x005F8CD3, 0x00C23CFA, 0x00F0B799, 0x00A72A3C, 0x0095A15F,
+    0x00D1EA98, 0x00E361FB, 0x00B4FC5E, 0x0086773D, 0x001BC714, 0x00294C77, 0x007ED1D2, 0x004C5AB1,
+    0x00773AE3, 0x0045B180, 0x00122C25, 0x0020A746, 0x00BD176F, 0x008F9C0C, 0x00D801A9, 0x00EA8ACA,
+    0x00509627, 0x00621D44, 0x003580E1, 0x00070B82, 0x009ABBAB, 0x00A830C8, 0x00FFAD6D, 0x00CD260E,
+    0x00F6465C, 0x00C4CD3F, 0x0093509A, 0x00A1DBF9, 0x003C6BD0, 0x000EE0B3, 0x00597D16, 0x006BF675,
+    0x002FBDB2, 0x001D36D1, 0x004AAB74, 0x00782017, 0x00E5903E, 0x00D71B5D, 0x008086F8, 0x00B20D9B,
+    0x00896DC9, 0x00BBE6AA, 0x00EC7B0F, 0x00DEF06C, 0x00434045, 0x0071CB26, 0x00265683, 0x0014DDE0,
+    0x0060E43A, 0x00526F59, 0x0005F2FC, 0x0037799F, 0x00AAC9B6, 0x009842D5, 0x00CFDF70, 0x00FD5413,
+    0x00C63441, 0x00F4BF22, 0x00A32287, 0x0091A9E4, 0x000C19CD, 0x003E92AE, 0x00690F0B, 0x005B8468,
+    0x001FCFAF, 0x002D44CC, 0x007AD969, 0x0048520A, 0x00D5E223, 0x00E76940, 0x00B0F4E5, 0x00827F86,
+    0x00B91FD4, 0x008B94B7, 0x00DC0912, 0x00EE8271, 0x00733258, 0x0041B93B, 0x0016249E, 0x0024AFFD,
+    0x009EB310, 0x00AC3873, 0x00FBA5D6, 0x00C92EB5, 0x00549E9C, 0x006615FF, 0x0031885A, 0x00030339,
+    0x0038636B, 0x000AE808, 0x005D75AD, 0x006FFECE, 0x00F24EE7, 0x00C0C584, 0x00975821, 0x00A5D342,
+    0x00E19885, 0x00D313E6, 0x00848E43, 0x00B60520, 0x002BB509, 0x00193E6A, 0x004EA3CF, 0x007C28AC,
+    0x004748FE, 0x0075C39D, 0x00225E38, 0x0010D55B, 0x008D6572, 0x00BFEE11, 0x00E873B4, 0x00DAF8D7,
+};
+
+// CRC-24/LTE-A
+static const uint32_t crc_catalog_table_86[256] = {
+    0x00000000, 0x00864CFB, 0x008AD50D, 0x000C99F6, 0x0093E6E1, 0x0015AA1A, 0x001933EC, 0x009F7F17,
+    0x00A18139, 0x0027CDC2, 0x002B5434, 0x00AD18CF, 0x003267D8, 0x00B42B23, 0x00B8B2D5, 0x003EFE2E,
+    0x00C54E89, 0x00430272, 0x004F9B84, 0x00C9D77F, 0x0056A868, 0x00D0E493, 0x00DC7D65, 0x005A319E,
+    0x0064CFB0, 0x00E2834B, 0x00EE1ABD, 0x00685646, 0x00F72951, 0x007165AA, 0x007DFC5C, 0x00FBB0A7,
+    0x000CD1E9, 0x008A9D12, 0x008604E4, 0x0000481F, 0x009F3708, 0x00197BF3, 0x0015E205, 0x0093AEFE,
+    0x00AD50D0, 0x002B1C2B, 0x002785DD, 0x00A1C926, 0x003EB631, 0x00B8FACA, 0x00B4633C, 0x00322FC7,
+    0x00C99F60, 0x004FD39B, 0x00434A6D, 0x00C50696, 0x005A7981, 0x00DC357A, 0x00D0AC8C, 0x0056E077,
+    0x00681E59, 0x00EE52A2, 0x00E2CB54, 0x006487AF, 0x00FBF8B8, 0x007DB443, 0x00712DB5, 0x00F7614E,
+    0x0019A3D2, 0x009FEF29, 0x009376DF, 0x00153A24, 0x008A4533, 0x000C09C8, 0x0000903E, 0x0086DCC5,
+    0x00B822EB, 0x003E6E10, 0x0032F7E6, 0x00B4BB1D, 0x002BC40A, 0x00AD88F1, 0x00A11107, 0x00275DFC,
+    0x00DCED5B, 0x005AA1A0, 0x00563856, 0x00D074AD, 0x004F0BBA, 0x00C94741, 0x00C5DEB7, 0x0043924C,
+    0x007D6C62, 0x00FB2099, 0x00F7B96F, 0x0071F594, 0x00EE8A83, 0x0068C678, 0x00645F8E, 0x00E21375,
+    0x0015723B, 0x00933EC0, 0x009FA736, 0x0019EBCD, 0x008694DA, 0x0000D821, 0x000C41D7, 0x008A0D2C,
+    0x00B4F302, 0x0032BFF9, 0x003E260F, 0x00B86AF4, 0x002715E3, 0x00A15918, 0x00ADC0EE, 0x002B8C15,
+    0x00D03CB2, 0x00567049, 0x005AE9BF, 0x00DCA544, 0x0043DA53, 0x00C596A8, 0x00C90F5E, 0x004F43A5,
+    0x0071BD8B, 0x00F7F170, 0x00FB6886, 0x007D247D, 0x00E25B6A, 0x00641791, 0x00688E67, 0x00EEC29C,
+    0x003347A4, 0x00B50B5F, 0x00B992A9, 0x003FDE52, 0x00A0A145, 0x0026EDBE, 0x002A7448, 0x00AC38B3,
+    0x0092C69D, 0x00148A66, 0x00181390, 0x009E5F6B, 0x0001207C, 0x00876C87, 0x008BF571, 0x000DB98A,
+    0x00F6092D, 0x007045D6, 0x007CDC20, 0x00FA90DB, 0x0065EFCC, 0x00E3A337, 0x00EF3AC1, 0x0069763A,
+    0x00578814, 0x00D1C4EF, 0x00DD5D19, 0x005B11E2, 0x00C46EF5, 0x0042220E, 0x004EBBF8, 0x00C8F703,
+    0x003F964D, 0x00B9DAB6, 0x00B54340, 0x00330FBB, 0x00AC70AC, 0x002A3C57, 0x0026A5A1, 0x00A0E95A,
+    0x009E1774, 0x00185B8F, 0x0014C279, 0x00928E82, 0x000DF195, 0x008BBD6E, 0x00872498, 0x00016863,
+    0x00FAD8C4, 0x007C943F, 0x00700DC9, 0x00F64132, 0x00693E25, 0x00EF72DE, 0x00E3EB28, 0x0065A7D3,
+    0x005B59FD, 0x00DD1506, 0x00D18CF0, 0x0057C00B, 0x00C8BF1C, 0x004EF3E7, 0x00426A11, 0x00C426EA,
+    0x002AE476, 0x00ACA88D, 0x00A0317B, 0x00267D80, 0x00B90297, 0x003F4E6C, 0x0033D79A, 0x00B59B61,
+    0x008B654F, 0x000D29B4, 0x0001B042, 0x0087FCB9, 0x001883AE, 0x009ECF55, 0x009256A3, 0x00141A58,
+    0x00EFAAFF, 0x0069E604, 0x00657FF2, 0x00E33309, 0x007C4C1E, 0x00FA00E5, 0x00F69913, 0x0070D5E8,
+    0x004E2BC6, 0x00C8673D, 0x00C4FECB, 0x0042B230, 0x00DDCD27, 0x005B81DC, 0x0057182A, 0x00D154D1,
+    0x0026359F, 0x00A07964, 0x00ACE092, 0x002AAC69, 0x00B5D37E, 0x00339F85, 0x003F0673, 0x00B94A88,
+    0x0087B4A6, 0x0001F85D, 0x000D61AB, 0x008B2D50, 0x00145247, 0x00921EBC, 0x009E874A, 0x0018CBB1,
+    0x00E37B16, 0x006537ED, 0x0069AE1B, 0x00EFE2E0, 0x00709DF7, 0x00F6D10C, 0x00FA48FA, 0x007C0401,
+    0x0042FA2F, 0x00C4B6D4, 0x00C82F22, 0x004E63D9, 0x00D11CCE, 0x00575035, 0x005BC9C3, 0x00DD8538,
+};
+
+// CRC-24/LTE-B
+static const uint32_t crc_catalog_table_87[256] = {
+    0x00000000, 0x00800063, 0x008000A5, 0x000000C6, 0x00800129, 0x0000014A, 0x0000018C, 0x008001EF,
+    0x00800231, 0x00000252, 0x00000294, 0x008002F7, 0x00000318, 0x0080037B, 0x008003BD, 0x000003DE,
+    0x00800401, 0x00000462, 0x000004A4, 0x008004C7, 0x00000528, 0x0080054B, 0x0080058D, 0x000005EE,
+    0x00000630, 0x00800653, 0x00800695, 0x000006F6, 0x00800719, 0x0000077A, 0x000007BC, 0x008007DF,
+    0x00800861, 0x00000802, 0x000008C4, 0x008008A7, 0x00000948, 0x0080092B, 0x008009ED, 0x0000098E,
+    0x00000A50, 0x00800A33, 0x00800AF5, 0x00000A96, 0x00800B79, 0x00000B1A, 0x00000BDC, 0x00800BBF,
+    0x00000C60, 0x00800C03, 0x00800CC5, 0x00000CA6, 0x00800D49, 0x00000D2A, 0x00000DEC, 0x00800D8F,
+    0x00800E51, 0x00000E32, 0x00000EF4, 0x00800E97, 0x00000F78, 0x00800F1B, 0x00800FDD, 0x00000FBE,
+    0x008010A1, 0x000010C2, 0x00001004, 0x00801067, 0x00001188, 0x008011EB, 0x0080112D, 0x0000114E,
+    0x00001290, 0x008012F3, 0x00801235, 0x00001256, 0x008013B9, 0x000013DA, 0x0000131C, 0x0080137F,
+    0x000014A0, 0x008014C3, 0x00801405, 0x00001466, 0x00801589, 0x000015EA, 0x0000152C, 0x0080154F,
+    0x00801691, 0x000016F2, 0x00001634, 0x00801657, 0x000017B8, 0x008017DB, 0x0080171D, 0x0000177E,
+    0x000018C0, 0x008018A3, 0x00801865, 0x00001806, 0x008019E9, 0x0000198A, 0x0000194C, 0x0080192F,
+    0x00801AF1, 0x00001A92, 0x00001A54, 0x00801A37, 0x00001BD8, 0x00801BBB, 0x00801B7D, 0x00001B1E,
+    0x00801CC1, 0x00001CA2, 0x00001C64, 0x00801C07, 0x00001DE8, 0x00801D8B, 0x00801D4D, 0x00001D2E,
+    0x00001EF0, 0x00801E93, 0x00801E55, 0x00001E36, 0x00801FD9, 0x00001FBA, 0x00001F7C, 0x00801F1F,
+    0x00802121, 0x00002142, 0x00002184, 0x008021E7, 0x00002008, 0x0080206B, 0x008020AD, 0x000020CE,
+    0x00002310, 0x00802373, 0x008023B5, 0x000023D6, 0x00802239, 0x0000225A, 0x0000229C, 0x008022FF,
+    0x00002520, 0x00802543, 0x00802585, 0x000025E6, 0x00802409, 0x0000246A, 0x000024AC, 0x008024CF,
+    0x00802711, 0x00002772, 0x000027B4, 0x008027D7, 0x00002638, 0x0080265B, 0x0080269D, 0x000026FE,
+    0x00002940, 0x00802923, 0x008029E5, 0x00002986, 0x00802869, 0x0000280A, 0x000028CC, 0x008028AF,
+    0x00802B71, 0x00002B12, 0x00002BD4, 0x00802BB7, 0x00002A58, 0x00802A3B, 0x00802AFD, 0x00002A9E,
+    0x00802D41, 0x00002D22, 0x00002DE4, 0x00802D87, 0x00002C68, 0x00802C0B, 0x00802CCD, 0x00002CAE,
+    0x00002F70, 0x00802F13, 0x00802FD5, 0x00002FB6, 0x00802E59, 0x00002E3A, 0x00002EFC, 0x00802E9F,
+    0x00003180, 0x008031E3, 0x00803125, 0x00003146, 0x008030A9, 0x000030CA, 0x0000300C, 0x0080306F,
+    0x008033B1, 0x000033D2, 0x00003314, 0x00803377, 0x00003298, 0x008032FB, 0x0080323D, 0x0000325E,
+    0x00803581, 0x000035E2, 0x00003524, 0x00803547, 0x000034A8, 0x008034CB, 0x0080340D, 0x0000346E,
+    0x000037B0, 0x008037D3, 0x00803715, 0x00003776, 0x00803699, 0x000036FA, 0x0000363C, 0x0080365F,
+    0x008039E1, 0x00003982, 0x00003944, 0x00803927, 0x000038C8, 0x008038AB, 0x0080386D, 0x0000380E,
+    0x00003BD0, 0x00803BB3, 0x00803B75, 0x00003B16, 0x00803AF9, 0x00003A9A, 0x00003A5C, 0x00803A3F,
+    0x00003DE0, 0x00803D83, 0x00803D45, 0x00003D26, 0x00803CC9, 0x00003CAA, 0x00003C6C, 0x00803C0F,
+    0x00803FD1, 0x00003FB2, 0x00003F74, 0x00803F17, 0x00003EF8, 0x00803E9B, 0x00803E5D, 0x00003E3E,
+};
+
+// CRC-30/CDMA
+static const uint32_t crc_catalog_table_90[256] = {
+    0x00000000, 0x80C2E71C, 0x81472924, 0x0185CE38, 0x824CB554, 0x028E5248, 0x030B9C70, 0x83C97B6C,
+    0x845B8DB4, 0x04996AA8, 0x051CA490, 0x85DE438C, 0x061738E0, 0x86D5DFFC, 0x875011C4, 0x0792F6D8,
+    0x8875FC74, 0x08B71B68, 0x0932D550, 0x89F0324C, 0x0A394920, 0x8AFBAE3C, 0x8B7E6004, 0x0BBC8718,
+    0x0C2E71C0, 0x8CEC96DC, 0x8D6958E4, 0x0DABBFF8, 0x8E62C494, 0x0EA02388, 0x0F25EDB0, 0x8FE70AAC,
+    0x90291FF4, 0x10EBF8E8, 0x116E36D0, 0x91ACD1CC, 0x1265AAA0, 0x92A74DBC, 0x93228384, 0x13E06498,
+    0x14729240, 0x94B0755C, 0x9535BB64, 0x15F75C78, 0x963E2714, 0x16FCC008, 0x17790E30, 0x97BBE92C,
+    0x185CE380, 0x989E049C, 0x991BCAA4, 0x19D92DB8, 0x9A1056D4, 0x1AD2B1C8, 0x1B577FF0, 0x9B9598EC,
+    0x9C076E34, 0x1CC58928, 0x1D404710, 0x9D82A00C, 0x1E4BDB60, 0x9E893C7C, 0x9F0CF244, 0x1FCE1558,
+    0xA090D8F4, 0x20523FE8, 0x21D7F1D0, 0xA11516CC, 0x22DC6DA0, 0xA21E8ABC, 0xA39B4484, 0x2359A398,
+    0x24CB5540, 0xA409B25C, 0xA58C7C64, 0x254E9B78, 0xA687E014, 0x26450708, 0x27C0C930, 0xA7022E2C,
+    0x28E52480, 0xA827C39C, 0xA9A20DA4, 0x2960EAB8, 0xAAA991D4, 0x2A6B76C8, 0x2BEEB8F0, 0xAB2C5FEC,
+    0xACBEA934, 0x2C7C4E28, 0x2DF98010, 0xAD3B670C, 0x2EF21C60, 0xAE30FB7C, 0xAFB53544, 0x2F77D258,
+    0x30B9C700, 0xB07B201C, 0xB1FEEE24, 0x313C0938, 0xB2F57254, 0x32379548, 0x33B25B70, 0xB370BC6C,
+    0xB4E24AB4, 0x3420ADA8, 0x35A56390, 0xB567848C, 0x36AEFFE0, 0xB66C18FC, 0xB7E9D6C4, 0x372B31D8,
+    0xB8CC3B74, 0x380EDC68, 0x398B1250, 0xB949F54C, 0x3A808E20, 0xBA42693C, 0xBBC7A704, 0x3B054018,
+    0x3C97B6C0, 0xBC5551DC, 0xBDD09FE4, 0x3D1278F8, 0xBEDB0394, 0x3E19E488, 0x3F9C2AB0, 0xBF5ECDAC,
+    0xC1E356F4, 0x4121B1E8, 0x40A47FD0, 0xC06698CC, 0x43AFE3A0, 0xC36D04BC, 0xC2E8CA84, 0x422A2D98,
+    0x45B8DB40, 0xC57A3C5C, 0xC4FFF264, 0x443D1578, 0xC7F46E14, 0x47368908, 0x46B34730, 0xC671A02C,
+    0x4996AA80, 0xC9544D9C, 0xC8D183A4, 0x481364B8, 0xCBDA1FD4, 0x4B18F8C8, 0x4A9D36F0, 0xCA5FD1EC,
+    0xCDCD2734, 0x4D0FC028, 0x4C8A0E10, 0xCC48E90C, 0x4F819260, 0xCF43757C, 0xCEC6BB44, 0x4E045C58,
+    0x51CA4900, 0xD108AE1C, 0xD08D6024, 0x504F8738, 0xD386FC54, 0x53441B48, 0x52C1D570, 0xD203326C,
+    0xD591C4B4, 0x555323A8, 0x54D6ED90, 0xD4140A8C, 0x57DD71E0, 0xD71F96FC, 0xD69A58C4, 0x5658BFD8,
+    0xD9BFB574, 0x597D5268, 0x58F89C50, 0xD83A7B4C, 0x5BF30020, 0xDB31E73C, 0xDAB42904, 0x5A76CE18,
+    0x5DE438C0, 0xDD26DFDC, 0xDCA311E4, 0x5C61F6F8, 0xDFA88D94, 0x5F6A6A88, 0x5EEFA4B0, 0xDE2D43AC,
+    0x61738E00, 0xE1B1691C, 0xE034A724, 0x60F64038, 0xE33F3B54, 0x63FDDC48, 0x62781270, 0xE2BAF56C,
+    0xE52803B4, 0x65EAE4A8, 0x646F2A90, 0xE4ADCD8C, 0x6764B6E0, 0xE7A651FC, 0xE6239FC4, 0x66E178D8,
+    0xE9067274, 0x69C49568, 0x68415B50, 0xE883BC4C, 0x6B4AC720, 0xEB88203C, 0xEA0DEE04, 0x6ACF0918,
+    0x6D5DFFC0, 0xED9F18DC, 0xEC1AD6E4, 0x6CD831F8, 0xEF114A94, 0x6FD3AD88, 0x6E5663B0, 0xEE9484AC,
+    0xF15A91F4, 0x719876E8, 0x701DB8D0, 0xF0DF5FCC, 0x731624A0, 0xF3D4C3BC, 0xF2510D84, 0x7293EA98,
+    0x75011C40, 0xF5C3FB5C, 0xF4463564, 0x7484D278, 0xF74DA914, 0x778F4E08, 0x760A8030, 0xF6C8672C,
+    0x792F6D80, 0xF9ED8A9C, 0xF86844A4, 0x78AAA3B8, 0xFB63D8D4, 0x7BA13FC8, 0x7A24F1F0, 0xFAE616EC,
+    0xFD74E034, 0x7DB60728, 0x7C33C910, 0xFCF12E0C, 0x7F385560, 0xFFFAB27C, 0xFE7F7C44, 0x7EBD9B58,
+};
+
+// CRC-31/PHILIPS
+static const uint32_t crc_catalog_table_91[256] = {
+    0x00000000, 0x09823B6E, 0x130476DC, 0x1A864DB2, 0x2608EDB8, 0x2F8AD6D6, 0x350C9B64, 0x3C8EA00A,
+    0x4C11DB70, 0x4593E01E, 0x5F15ADAC, 0x569796C2, 0x6A1936C8, 0x639B0DA6, 0x791D4014, 0x709F7B7A,
+    0x9823B6E0, 0x91A18D8E, 0x8B27C03C, 0x82A5FB52, 0xBE2B5B58, 0xB7A96036, 0xAD2F2D84, 0xA4AD16EA,
+    0xD4326D90, 0xDDB056FE, 0xC7361B4C, 0xCEB42022, 0xF23A8028, 0xFBB8BB46, 0xE13EF6F4, 0xE8BCCD9A,
+    0x39C556AE, 0x30476DC0, 0x2AC12072, 0x23431B1C, 0x1FCDBB16, 0x164F8078, 0x0CC9CDCA, 0x054BF6A4,
+    0x75D48DDE, 0x7C56B6B0, 0x66D0FB02, 0x6F52C06C, 0x53DC6066, 0x5A5E5B08, 0x40D816BA, 0x495A2DD4,
+    0xA1E6E04E, 0xA864DB20, 0xB2E29692, 0xBB60ADFC, 0x87EE0DF6, 0x8E6C3698, 0x94EA7B2A, 0x9D684044,
+    0xEDF73B3E, 0xE4750050, 0xFEF34DE2, 0xF771768C, 0xCBFFD686, 0xC27DEDE8, 0xD8FBA05A, 0xD1799B34,
+    0x738AAD5C, 0x7A089632, 0x608EDB80, 0x690CE0EE, 0x558240E4, 0x5C007B8A, 0x46863638, 0x4F040D56,
+    0x3F9B762C, 0x36194D42, 0x2C9F00F0, 0x251D3B9E, 0x19939B94, 0x1011A0FA, 0x0A97ED48, 0x0315D626,
+    0xEBA91BBC, 0xE22B20D2, 0xF8AD6D60, 0xF12F560E, 0xCDA1F604, 0xC423CD6A, 0xDEA580D8, 0xD727BBB6,
+    0xA7B8C0CC, 0xAE3AFBA2, 0xB4BCB610, 0xBD3E8D7E, 0x81B02D74, 0x8832161A, 0x92B45BA8, 0x9B3660C6,
+    0x4A4FFBF2, 0x43CDC09C, 0x594B8D2E, 0x50C9B640, 0x6C47164A, 0x65C52D24, 0x7F436096, 0x76C15BF8,
+    0x065E2082, 0x0FDC1BEC, 0x155A565E, 0x1CD86D30, 0x2056CD3A, 0x29D4F654, 0x3352BBE6, 0x3AD08088,
+    0xD26C4D12, 0xDBEE767C, 0xC1683BCE, 0xC8EA00A0, 0xF464A0AA, 0xFDE69BC4, 0xE760D676, 0xEEE2ED18,
+    0x9E7D9662, 0x97FFAD0C, 0x8D79E0BE, 0x84FBDBD0, 0xB8757BDA, 0xB1F740B4, 0xAB710D06, 0xA2F33668,
+    0xE7155AB8, 0xEE9761D6, 0xF4112C64, 0xFD93170A, 0xC11DB700, 0xC89F8C6E, 0xD219C1DC, 0xDB9BFAB2,
+    0xAB0481C8, 0xA286BAA6, 0xB800F714, 0xB182CC7A, 0x8D0C6C70, 0x848E571E, 0x9E081AAC, 0x978A21C2,
+    0x7F36EC58, 0x76B4D736, 0x6C329A84, 0x65B0A1EA, 0x593E01E0, 0x50BC3A8E, 0x4A3A773C, 0x43B84C52,
+    0x33273728, 0x3AA50C46, 0x202341F4, 0x29A17A9A, 0x152FDA90, 0x1CADE1FE, 0x062BAC4C, 0x0FA99722,
+    0xDED00C16, 0xD7523778, 0xCDD47ACA, 0xC45641A4, 0xF8D8E1AE, 0xF15ADAC0, 0xEBDC9772, 0xE25EAC1C,
+    0x92C1D766, 0x9B43EC08, 0x81C5A1BA, 0x88479AD4, 0xB4C93ADE, 0xBD4B01B0, 0xA7CD4C02, 0xAE4F776C,
+    0x46F3BAF6, 0x4F718198, 0x55F7CC2A, 0x5C75F744, 0x60FB574E, 0x69796C20, 0x73FF2192, 0x7A7D1AFC,
+    0x0AE26186, 0x03605AE8, 0x19E6175A, 0x10642C34, 0x2CEA8C3E, 0x2568B750, 0x3FEEFAE2, 0x366CC18C,
+    0x949FF7E4, 0x9D1DCC8A, 0x879B8138, 0x8E19BA56, 0xB2971A5C, 0xBB152132, 0xA1936C80, 0xA81157EE,
+    0xD88E2C94, 0xD10C17FA, 0xCB8A5A48, 0xC2086126, 0xFE86C12C, 0xF704FA42, 0xED82B7F0, 0xE4008C9E,
+    0x0CBC4104, 0x053E7A6A, 0x1FB837D8, 0x163A0CB6, 0x2AB4ACBC, 0x233697D2, 0x39B0DA60, 0x3032E10E,
+    0x40AD9A74, 0x492FA11A, 0x53A9ECA8, 0x5A2BD7C6, 0x66A577CC, 0x6F274CA2, 0x75A10110, 0x7C233A7E,
+    0xAD5AA14A, 0xA4D89A24, 0xBE5ED796, 0xB7DCECF8, 0x8B524CF2, 0x82D0779C, 0x98563A2E, 0x91D40140,
+    0xE14B7A3A, 0xE8C94154, 0xF24F0CE6, 0xFBCD3788, 0xC7439782, 0xCEC1ACEC, 0xD447E15E, 0xDDC5DA30,
+    0x357917AA, 0x3CFB2CC4, 0x267D6176, 0x2FFF5A18, 0x1371FA12, 0x1AF3C17C, 0x00758CCE, 0x09F7B7A0,
+    0x7968CCDA, 0x70EAF7B4, 0x6A6CBA06, 0x63EE8168, 0x5F602162, 0x56E21A0C, 0x4C6457BE, 0x45E66CD0,
+};
+
+// CRC-32/AIXM
+static const uint32_t crc_catalog_table_92[256] = {
+    0x00000000, 0x814141AB, 0x83C3C2FD, 0x02828356, 0x86C6C451, 0x078785FA, 0x050506AC, 0x84444707,
+    0x8CCCC909, 0x0D8D88A2, 0x0F0F0BF4, 0x8E4E4A5F, 0x0A0A0D58, 0x8B4B4CF3, 0x89C9CFA5, 0x08888E0E,
+    0x98D8D3B9, 0x19999212, 0x1B1B1144, 0x9A5A50EF, 0x1E1E17E8, 0x9F5F5643, 0x9DDDD515, 0x1C9C94BE,
+    0x14141AB0, 0x95555B1B, 0x97D7D84D, 0x169699E6, 0x92D2DEE1, 0x13939F4A, 0x11111C1C, 0x90505DB7,
+    0xB0F0E6D9, 0x31B1A772, 0x33332424, 0xB272658F, 0x36362288, 0xB7776323, 0xB5F5E075, 0x34B4A1DE,
+    0x3C3C2FD0, 0xBD7D6E7B, 0xBFFFED2D, 0x3EBEAC86, 0xBAFAEB81, 0x3BBBAA2A, 0x3939297C, 0xB87868D7,
+    0x28283560, 0xA96974CB, 0xABEBF79D, 0x2AAAB636, 0xAEEEF131, 0x2FAFB09A, 0x2D2D33CC, 0xAC6C7267,
+    0xA4E4FC69, 0x25A5BDC2, 0x27273E94, 0xA6667F3F, 0x22223838, 0xA3637993, 0xA1E1FAC5, 0x20A0BB6E,
+    0xE0A08C19, 0x61E1CDB2, 0x63634EE4, 0xE2220F4F, 0x66664848, 0xE72709E3, 0xE5A58AB5, 0x64E4CB1E,
+    0x6C6C4510, 0xED2D04BB, 0xEFAF87ED, 0x6EEEC646, 0xEAAA8141, 0x6BEBC0EA, 0x696943BC, 0xE8280217,
+    0x78785FA0, 0xF9391E0B, 0xFBBB9D5D, 0x7AFADCF6, 0xFEBE9BF1, 0x7FFFDA5A, 0x7D7D590C, 0xFC3C18A7,
+    0xF4B496A9, 0x75F5D702, 0x77775454, 0xF63615FF, 0x727252F8, 0xF3331353, 0xF1B19005, 0x70F0D1AE,
+    0x50506AC0, 0xD1112B6B, 0xD393A83D, 0x52D2E996, 0xD696AE91, 0x57D7EF3A, 0x55556C6C, 0xD4142DC7,
+    0xDC9CA3C9, 0x5DDDE262, 0x5F5F6134, 0xDE1E209F, 0x5A5A6798, 0xDB1B2633, 0xD999A565, 0x58D8E4CE,
+    0xC888B979, 0x49C9F8D2, 0x4B4B7B84, 0xCA0A3A2F, 0x4E4E7D28, 0xCF0F3C83, 0xCD8DBFD5, 0x4CCCFE7E,
+    0x44447070, 0xC50531DB, 0xC787B28D, 0x46C6F326, 0xC282B421, 0x43C3F58A, 0x414176DC, 0xC0003777,
+    0x40005999, 0xC1411832, 0xC3C39B64, 0x4282DACF, 0xC6C69DC8, 0x4787DC63, 0x45055F35, 0xC4441E9E,
+    0xCCCC9090, 0x4D8DD13B, 0x4F0F526D, 0xCE4E13C6, 0x4A0A54C1, 0xCB4B156A, 0xC9C9963C, 0x4888D797,
+    0xD8D88A20, 0x5999CB8B, 0x5B1B48DD, 0xDA5A0976, 0x5E1E4E71, 0xDF5F0FDA, 0xDDDD8C8C, 0x5C9CCD27,
+    0x54144329, 0xD5550282, 0xD7D781D4, 0x5696C07F, 0xD2D28778, 0x5393C6D3, 0x51114585, 0xD050042E,
+    0xF0F0BF40, 0x71B1FEEB, 0x73337DBD, 0xF2723C16, 0x76367B11, 0xF7773ABA, 0xF5F5B9EC, 0x74B4F847,
+    0x7C3C7649, 0xFD7D37E2, 0xFFFFB4B4, 0x7EBEF51F, 0xFAFAB218, 0x7BBBF3B3, 0x793970E5, 0xF878314E,
+    0x68286CF9, 0xE9692D52, 0xEBEBAE04, 0x6AAAEFAF, 0xEEEEA8A8, 0x6FAFE903, 0x6D2D6A55, 0xEC6C2BFE,
+    0xE4E4A5F0, 0x65A5E45B, 0x6727670D, 0xE66626A6, 0x622261A1, 0xE363200A, 0xE1E1A35C, 0x60A0E2F7,
+    0xA0A0D580, 0x21E1942B, 0x2363177D, 0xA22256D6, 0x266611D1, 0xA727507A, 0xA5A5D32C, 0x24E49287,
+    0x2C6C1C89, 0xAD2D5D22, 0xAFAFDE74, 0x2EEE9FDF, 0xAAAAD8D8, 0x2BEB9973, 0x29691A25, 0xA8285B8E,
+    0x38780639, 0xB9394792, 0xBBBBC4C4, 0x3AFA856F, 0xBEBEC268, 0x3FFF83C3, 0x3D7D0095, 0xBC3C413E,
+    0xB4B4CF30, 0x35F58E9B, 0x37770DCD, 0xB6364C66, 0x32720B61, 0xB3334ACA, 0xB1B1C99C, 0x30F08837,
+    0x10503359, 0x911172F2, 0x9393F1A4, 0x12D2B00F, 0x9696F708, 0x17D7B6A3, 0x155535F5, 0x9414745E,
+    0x9C9CFA50, 0x1DDDBBFB, 0x1F5F38AD, 0x9E1E7906, 0x1A5A3E01, 0x9B1B7FAA, 0x9999FCFC, 0x18D8BD57,
+    0x8888E0E0, 0x09C9A14B, 0x0B4B221D, 0x8A0A63B6, 0x0E4E24B1, 0x8F0F651A, 0x8D8DE64C, 0x0CCCA7E7,
+    0x044429E9, 0x85056842, 0x8787EB14, 0x06C6AABF, 0x8282EDB8, 0x03C3AC13, 0x01412F45, 0x80006EEE,
+};
+
+// CRC-32/AUTOSAR
+static const uint32_t crc_catalog_table_93[256] = {
+    0x00000000, 0x30850FF5, 0x610A1FEA, 0x518F101F, 0xC2143FD4, 0xF2913021, 0xA31E203E, 0x939B2FCB,
+    0x159615F7, 0x25131A02, 0x749C0A1D, 0x441905E8, 0xD7822A23, 0xE70725D6, 0xB68835C9, 0x860D3A3C,
+    0x2B2C2BEE, 0x1BA9241B, 0x4A263404, 0x7AA33BF1, 0xE938143A, 0xD9BD1BCF, 0x88320BD0, 0xB8B70425,
+    0x3EBA3E19, 0x0E3F31EC, 0x5FB021F3, 0x6F352E06, 0xFCAE01CD, 0xCC2B0E38, 0x9DA41E27, 0xAD2111D2,
+    0x565857DC, 0x66DD5829, 0x37524836, 0x07D747C3, 0x944C6808, 0xA4C967FD, 0xF54677E2, 0xC5C37817,
+    0x43CE422B, 0x734B4DDE, 0x22C45DC1, 0x12415234, 0x81DA7DFF, 0xB15F720A, 0xE0D06215, 0xD0556DE0,
+    0x7D747C32, 0x4DF173C7, 0x1C7E63D8, 0x2CFB6C2D, 0xBF6043E6, 0x8FE54C13, 0xDE6A5C0C, 0xEEEF53F9,
+    0x68E269C5, 0x58676630, 0x09E8762F, 0x396D79DA, 0xAAF65611, 0x9A7359E4, 0xCBFC49FB, 0xFB79460E,
+    0xACB0AFB8, 0x9C35A04D, 0xCDBAB052, 0xFD3FBFA7, 0x6EA4906C, 0x5E219F99, 0x0FAE8F86, 0x3F2B8073,
+    0xB926BA4F, 0x89A3B5BA, 0xD82CA5A5, 0xE8A9AA50, 0x7B32859B, 0x4BB78A6E, 0x1A389A71, 0x2ABD9584,
+    0x879C8456, 0xB7198BA3, 0xE6969BBC, 0xD6139449, 0x4588BB82, 0x750DB477, 0x2482A468, 0x1407AB9D,
+    0x920A91A1, 0xA28F9E54, 0xF3008E4B, 0xC38581BE, 0x501EAE75, 0x609BA180, 0x3114B19F, 0x0191BE6A,
+    0xFAE8F864, 0xCA6DF791, 0x9BE2E78E, 0xAB67E87B, 0x38FCC7B0, 0x0879C845, 0x59F6D85A, 0x6973D7AF,
+    0xEF7EED93, 0xDFFBE266, 0x8E74F279, 0xBEF1FD8C, 0x2D6AD247, 0x1DEFDDB2, 0x4C60CDAD, 0x7CE5C258,
+    0xD1C4D38A, 0xE141DC7F, 0xB0CECC60, 0x804BC395, 0x13D0EC5E, 0x2355E3AB, 0x72DAF3B4, 0x425FFC41,
+    0xC452C67D, 0xF4D7C988, 0xA558D997, 0x95DDD662, 0x0646F9A9, 0x36C3F65C, 0x674CE643, 0x57C9E9B6,
+    0xC8DF352F, 0xF85A3ADA, 0xA9D52AC5, 0x99502530, 0x0ACB0AFB, 0x3A4E050E, 0x6BC11511, 0x5B441AE4,
+    0xDD4920D8, 0xEDCC2F2D, 0xBC433F32, 0x8CC630C7, 0x1F5D1F0C, 0x2FD810F9, 0x7E5700E6, 0x4ED20F13,
+    0xE3F31EC1, 0xD3761134, 0x82F9012B, 0xB27C0EDE, 0x21E72115, 0x11622EE0, 0x40ED3EFF, 0x7068310A,
+    0xF6650B36, 0xC6E004C3, 0x976F14DC, 0xA7EA1B29, 0x347134E2, 0x04F43B17, 0x557B2B08, 0x65FE24FD,
+    0x9E8762F3, 0xAE026D06, 0xFF8D7D19, 0xCF0872EC, 0x5C935D27, 0x6C1652D2, 0x3D9942CD, 0x0D1C4D38,
+    0x8B117704, 0xBB9478F1, 0xEA1B68EE, 0xDA9E671B, 0x490548D0, 0x79804725, 0x280F573A, 0x188A58CF,
+    0xB5AB491D, 0x852E46E8, 0xD4A156F7, 0xE4245902, 0x77BF76C9, 0x473A793C, 0x16B56923, 0x263066D6,
+    0xA03D5CEA, 0x90B8531F, 0xC1374300, 0xF1B24CF5, 0x6229633E, 0x52AC6CCB, 0x03237CD4, 0x33A67321,
+    0x646F9A97, 0x54EA9562, 0x0565857D, 0x35E08A88, 0xA67BA543, 0x96FEAAB6, 0xC771BAA9, 0xF7F4B55C,
+    0x71F98F60, 0x417C8095, 0x10F3908A, 0x20769F7F, 0xB3EDB0B4, 0x8368BF41, 0xD2E7AF5E, 0xE262A0AB,
+    0x4F43B179, 0x7FC6BE8C, 0x2E49AE93, 0x1ECCA166, 0x8D578EAD, 0xBDD28158, 0xEC5D9147, 0xDCD89EB2,
+    0x5AD5A48E, 0x6A50AB7B, 0x3BDFBB64, 0x0B5AB491, 0x98C19B5A, 0xA84494AF, 0xF9CB84B0, 0xC94E8B45,
+    0x3237CD4B, 0x02B2C2BE, 0x533DD2A1, 0x63B8DD54, 0xF023F29F, 0xC0A6FD6A, 0x9129ED75, 0xA1ACE280,
+    0x27A1D8BC, 0x1724D749, 0x46ABC756, 0x762EC8A3, 0xE5B5E768, 0xD530E89D, 0x84BFF882, 0xB43AF777,
+    0x191BE6A5, 0x299EE950, 0x7811F94F, 0x4894F6BA, 0xDB0FD971, 0xEB8AD684, 0xBA05C69B, 0x8A80C96E,
+    0x0C8DF352, 0x3C08FCA7, 0x6D87ECB8, 0x5D02E34D, 0xCE99CC86, 0xFE1CC373, 0xAF93D36C, 0x9F16DC99,
+};
+
+// CRC-32/BASE91-D
+static const uint32_t crc_catalog_table_94[256] = {
+    0x00000000, 0x2BDDD04F, 0x57BBA09E, 0x7C6670D1, 0xAF77413C, 0x84AA9173, 0xF8CCE1A2, 0xD31131ED,
+    0xF6DD1A53, 0xDD00CA1C, 0xA166BACD, 0x8ABB6A82, 0x59AA5B6F, 0x72778B20, 0x0E11FBF1, 0x25CC2BBE,
+    0x4589AC8D, 0x6E547CC2, 0x12320C13, 0x39EFDC5C, 0xEAFEEDB1, 0xC1233DFE, 0xBD454D2F, 0x96989D60,
+    0xB354B6DE, 0x98896691, 0xE4EF1640, 0xCF32C60F, 0x1C23F7E2, 0x37FE27AD, 0x4B98577C, 0x60458733,
+    0x8B13591A, 0xA0CE8955, 0xDCA8F984, 0xF77529CB, 0x24641826, 0x0FB9C869, 0x73DFB8B8, 0x580268F7,
+    0x7DCE4349, 0x56139306, 0x2A75E3D7, 0x01A83398, 0xD2B90275, 0xF964D23A, 0x8502A2EB, 0xAEDF72A4,
+    0xCE9AF597, 0xE54725D8, 0x99215509, 0xB2FC8546, 0x61EDB4AB, 0x4A3064E4, 0x36561435, 0x1D8BC47A,
+    0x3847EFC4, 0x139A3F8B, 0x6FFC4F5A, 0x44219F15, 0x9730AEF8, 0xBCED7EB7, 0xC08B0E66, 0xEB56DE29,
+    0xBE152A1F, 0x95C8FA50, 0xE9AE8A81, 0xC2735ACE, 0x11626B23, 0x3ABFBB6C, 0x46D9CBBD, 0x6D041BF2,
+    0x48C8304C, 0x6315E003, 0x1F7390D2, 0x34AE409D, 0xE7BF7170, 0xCC62A13F, 0xB004D1EE, 0x9BD901A1,
+    0xFB9C8692, 0xD04156DD, 0xAC27260C, 0x87FAF643, 0x54EBC7AE, 0x7F3617E1, 0x03506730, 0x288DB77F,
+    0x0D419CC1, 0x269C4C8E, 0x5AFA3C5F, 0x7127EC10, 0xA236DDFD, 0x89EB0DB2, 0xF58D7D63, 0xDE50AD2C,
+    0x35067305, 0x1EDBA34A, 0x62BDD39B, 0x496003D4, 0x9A713239, 0xB1ACE276, 0xCDCA92A7, 0xE61742E8,
+    0xC3DB6956, 0xE806B919, 0x9460C9C8, 0xBFBD1987, 0x6CAC286A, 0x4771F825, 0x3B1788F4, 0x10CA58BB,
+    0x708FDF88, 0x5B520FC7, 0x27347F16, 0x0CE9AF59, 0xDFF89EB4, 0xF4254EFB, 0x88433E2A, 0xA39EEE65,
+    0x8652C5DB, 0xAD8F1594, 0xD1E96545, 0xFA34B50A, 0x292584E7, 0x02F854A8, 0x7E9E2479, 0x5543F436,
+    0xD419CC15, 0xFFC41C5A, 0x83A26C8B, 0xA87FBCC4, 0x7B6E8D29, 0x50B35D66, 0x2CD52DB7, 0x0708FDF8,
+    0x22C4D646, 0x09190609, 0x757F76D8, 0x5EA2A697, 0x8DB3977A, 0xA66E4735, 0xDA0837E4, 0xF1D5E7AB,
+    0x91906098, 0xBA4DB0D7, 0xC62BC006, 0xEDF61049, 0x3EE721A4, 0x153AF1EB, 0x695C813A, 0x42815175,
+    0x674D7ACB, 0x4C90AA84, 0x30F6DA55, 0x1B2B0A1A, 0xC83A3BF7, 0xE3E7EBB8, 0x9F819B69, 0xB45C4B26,
+    0x5F0A950F, 0x74D74540, 0x08B13591, 0x236CE5DE, 0xF07DD433, 0xDBA0047C, 0xA7C674AD, 0x8C1BA4E2,
+    0xA9D78F5C, 0x820A5F13, 0xFE6C2FC2, 0xD5B1FF8D, 0x06A0CE60, 0x2D7D1E2F, 0x511B6EFE, 0x7AC6BEB1,
+    0x1A833982, 0x315EE9CD, 0x4D38991C, 0x66E54953, 0xB5F478BE, 0x9E29A8F1, 0xE24FD820, 0xC992086F,
+    0xEC5E23D1, 0xC783F39E, 0xBBE5834F, 0x90385300, 0x432962ED, 0x68F4B2A2, 0x1492C273, 0x3F4F123C,
+    0x6A0CE60A, 0x41D13645, 0x3DB74694, 0x166A96DB, 0xC57BA736, 0xEEA67779, 0x92C007A8, 0xB91DD7E7,
+    0x9CD1FC59, 0xB70C2C16, 0xCB6A5CC7, 0xE0B78C88, 0x33A6BD65, 0x187B6D2A, 0x641D1DFB, 0x4FC0CDB4,
+    0x2F854A87, 0x04589AC8, 0x783EEA19, 0x53E33A56, 0x80F20BBB, 0xAB2FDBF4, 0xD749AB25, 0xFC947B6A,
+    0xD95850D4, 0xF285809B, 0x8EE3F04A, 0xA53E2005, 0x762F11E8, 0x5DF2C1A7, 0x2194B176, 0x0A496139,
+    0xE11FBF10, 0xCAC26F5F, 0xB6A41F8E, 0x9D79CFC1, 0x4E68FE2C, 0x65B52E63, 0x19D35EB2, 0x320E8EFD,
+    0x17C2A543, 0x3C1F750C, 0x407905DD, 0x6BA4D592, 0xB8B5E47F, 0x93683430, 0xEF0E44E1, 0xC4D394AE,
+    0xA496139D, 0x8F4BC3D2, 0xF32DB303, 0xD8F0634C, 0x0BE152A1, 0x203C82EE, 0x5C5AF23F, 0x77872270,
+    0x524B09CE, 0x7996D981, 0x05F0A950, 0x2E2D791F, 0xFD3C48F2, 0xD6E198BD, 0xAA87E86C, 0x815A3823,
+};
+
+// CRC-32/BZIP2
+static const uint32_t crc_catalog_table_95[256] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+    0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+    0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+    0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+    0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+    0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+    0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+    0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+    0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+    0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+    0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+    0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+    0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+    0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+    0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+    0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+    0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+    0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+    0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+    0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+    0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+    0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+    0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+    0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+    0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+    0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+    0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+    0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+    0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+    0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+    0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+};
+
+// CRC-32/CD-ROM-EDC
+static const uint32_t crc_catalog_table_96[256] = {
+    0x00000000, 0x90910101, 0x91210201, 0x01B00300, 0x92410401, 0x02D00500, 0x03600600, 0x93F10701,
+    0x94810801, 0x04100900, 0x05A00A00, 0x95310B01, 0x06C00C00, 0x96510D01, 0x97E10E01, 0x07700F00,
+    0x99011001, 0x09901100, 0x08201200, 0x98B11301, 0x0B401400, 0x9BD11501, 0x9A611601, 0x0AF01700,
+    0x0D801800, 0x9D111901, 0x9CA11A01, 0x0C301B00, 0x9FC11C01, 0x0F501D00, 0x0EE01E00, 0x9E711F01,
+    0x82012001, 0x12902100, 0x13202200, 0x83B12301, 0x10402400, 0x80D12501, 0x81612601, 0x11F02700,
+    0x16802800, 0x86112901, 0x87A12A01, 0x17302B00, 0x84C12C01, 0x14502D00, 0x15E02E00, 0x85712F01,
+    0x1B003000, 0x8B913101, 0x8A213201, 0x1AB03300, 0x89413401, 0x19D03500, 0x18603600, 0x88F13701,
+    0x8F813801, 0x1F103900, 0x1EA03A00, 0x8E313B01, 0x1DC03C00, 0x8D513D01, 0x8CE13E01, 0x1C703F00,
+    0xB4014001, 0x24904100, 0x25204200, 0xB5B14301, 0x26404400, 0xB6D14501, 0xB7614601, 0x27F04700,
+    0x20804800, 0xB0114901, 0xB1A14A01, 0x21304B00, 0xB2C14C01, 0x22504D00, 0x23E04E00, 0xB3714F01,
+    0x2D005000, 0xBD915101, 0xBC215201, 0x2CB05300, 0xBF415401, 0x2FD05500, 0x2E605600, 0xBEF15701,
+    0xB9815801, 0x29105900, 0x28A05A00, 0xB8315B01, 0x2BC05C00, 0xBB515D01, 0xBAE15E01, 0x2A705F00,
+    0x36006000, 0xA6916101, 0xA7216201, 0x37B06300, 0xA4416401, 0x34D06500, 0x35606600, 0xA5F16701,
+    0xA2816801, 0x32106900, 0x33A06A00, 0xA3316B01, 0x30C06C00, 0xA0516D01, 0xA1E16E01, 0x31706F00,
+    0xAF017001, 0x3F907100, 0x3E207200, 0xAEB17301, 0x3D407400, 0xADD17501, 0xAC617601, 0x3CF07700,
+    0x3B807800, 0xAB117901, 0xAAA17A01, 0x3A307B00, 0xA9C17C01, 0x39507D00, 0x38E07E00, 0xA8717F01,
+    0xD8018001, 0x48908100, 0x49208200, 0xD9B18301, 0x4A408400, 0xDAD18501, 0xDB618601, 0x4BF08700,
+    0x4C808800, 0xDC118901, 0xDDA18A01, 0x4D308B00, 0xDEC18C01, 0x4E508D00, 0x4FE08E00, 0xDF718F01,
+    0x41009000, 0xD1919101, 0xD0219201, 0x40B09300, 0xD3419401, 0x43D09500, 0x42609600, 0xD2F19701,
+    0xD5819801, 0x45109900, 0x44A09A00, 0xD4319B01, 0x47C09C00, 0xD7519D01, 0xD6E19E01, 0x46709F00,
+    0x5A00A000, 0xCA91A101, 0xCB21A201, 0x5BB0A300, 0xC841A401, 0x58D0A500, 0x5960A600, 0xC9F1A701,
+    0xCE81A801, 0x5E10A900, 0x5FA0AA00, 0xCF31AB01, 0x5CC0AC00, 0xCC51AD01, 0xCDE1AE01, 0x5D70AF00,
+    0xC301B001, 0x5390B100, 0x5220B200, 0xC2B1B301, 0x5140B400, 0xC1D1B501, 0xC061B601, 0x50F0B700,
+    0x5780B800, 0xC711B901, 0xC6A1BA01, 0x5630BB00, 0xC5C1BC01, 0x5550BD00, 0x54E0BE00, 0xC471BF01,
+    0x6C00C000, 0xFC91C101, 0xFD21C201, 0x6DB0C300, 0xFE41C401, 0x6ED0C500, 0x6F60C600, 0xFFF1C701,
+    0xF881C801, 0x6810C900, 0x69A0CA00, 0xF931CB01, 0x6AC0CC00, 0xFA51CD01, 0xFBE1CE01, 0x6B70CF00,
+    0xF501D001, 0x6590D100, 0x6420D200, 0xF4B1D301, 0x6740D400, 0xF7D1D501, 0xF661D601, 0x66F0D700,
+    0x6180D800, 0xF111D901, 0xF0A1DA01, 0x6030DB00, 0xF3C1DC01, 0x6350DD00, 0x62E0DE00, 0xF271DF01,
+    0xEE01E001, 0x7E90E100, 0x7F20E200, 0xEFB1E301, 0x7C40E400, 0xECD1E501, 0xED61E601, 0x7DF0E700,
+    0x7A80E800, 0xEA11E901, 0xEBA1EA01, 0x7B30EB00, 0xE8C1EC01, 0x7850ED00, 0x79E0EE00, 0xE971EF01,
+    0x7700F000, 0xE791F101, 0xE621F201, 0x76B0F300, 0xE541F401, 0x75D0F500, 0x7460F600, 0xE4F1F701,
+    0xE381F801, 0x7310F900, 0x72A0FA00, 0xE231FB01, 0x71C0FC00, 0xE151FD01, 0xE0E1FE01, 0x7070FF00,
+};
+
+// CRC-32/ISCSI
+static const uint32_t crc_catalog_table_98[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+};
+
+// CRC-32/ISO-HDLC
+static const uint32_t crc_catalog_table_99[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+};
+
+// CRC-32/MEF
+static const uint32_t crc_catalog_table_101[256] = {
+    0x00000000, 0x9695C4CA, 0xFB4839C9, 0x6DDDFD03, 0x20F3C3CF, 0xB6660705, 0xDBBBFA06, 0x4D2E3ECC,
+    0x41E7879E, 0xD7724354, 0xBAAFBE57, 0x2C3A7A9D, 0x61144451, 0xF781809B, 0x9A5C7D98, 0x0CC9B952,
+    0x83CF0F3C, 0x155ACBF6, 0x788736F5, 0xEE12F23F, 0xA33CCCF3, 0x35A90839, 0x5874F53A, 0xCEE131F0,
+    0xC22888A2, 0x54BD4C68, 0x3960B16B, 0xAFF575A1, 0xE2DB4B6D, 0x744E8FA7, 0x199372A4, 0x8F06B66E,
+    0xD1FDAE25, 0x47686AEF, 0x2AB597EC, 0xBC205326, 0xF10E6DEA, 0x679BA920, 0x0A465423, 0x9CD390E9,
+    0x901A29BB, 0x068FED71, 0x6B521072, 0xFDC7D4B8, 0xB0E9EA74, 0x267C2EBE, 0x4BA1D3BD, 0xDD341777,
+    0x5232A119, 0xC4A765D3, 0xA97A98D0, 0x3FEF5C1A, 0x72C162D6, 0xE454A61C, 0x89895B1F, 0x1F1C9FD5,
+    0x13D52687, 0x8540E24D, 0xE89D1F4E, 0x7E08DB84, 0x3326E548, 0xA5B32182, 0xC86EDC81, 0x5EFB184B,
+    0x7598EC17, 0xE30D28DD, 0x8ED0D5DE, 0x18451114, 0x556B2FD8, 0xC3FEEB12, 0xAE231611, 0x38B6D2DB,
+    0x347F6B89, 0xA2EAAF43, 0xCF375240, 0x59A2968A, 0x148CA846, 0x82196C8C, 0xEFC4918F, 0x79515545,
+    0xF657E32B, 0x60C227E1, 0x0D1FDAE2, 0x9B8A1E28, 0xD6A420E4, 0x4031E42E, 0x2DEC192D, 0xBB79DDE7,
+    0xB7B064B5, 0x2125A07F, 0x4CF85D7C, 0xDA6D99B6, 0x9743A77A, 0x01D663B0, 0x6C0B9EB3, 0xFA9E5A79,
+    0xA4654232, 0x32F086F8, 0x5F2D7BFB, 0xC9B8BF31, 0x849681FD, 0x12034537, 0x7FDEB834, 0xE94B7CFE,
+    0xE582C5AC, 0x73170166, 0x1ECAFC65, 0x885F38AF, 0xC5710663, 0x53E4C2A9, 0x3E393FAA, 0xA8ACFB60,
+    0x27AA4D0E, 0xB13F89C4, 0xDCE274C7, 0x4A77B00D, 0x07598EC1, 0x91CC4A0B, 0xFC11B708, 0x6A8473C2,
+    0x664DCA90, 0xF0D80E5A, 0x9D05F359, 0x0B903793, 0x46BE095F, 0xD02BCD95, 0xBDF63096, 0x2B63F45C,
+    0xEB31D82E, 0x7DA41CE4, 0x1079E1E7, 0x86EC252D, 0xCBC21BE1, 0x5D57DF2B, 0x308A2228, 0xA61FE6E2,
+    0xAAD65FB0, 0x3C439B7A, 0x519E6679, 0xC70BA2B3, 0x8A259C7F, 0x1CB058B5, 0x716DA5B6, 0xE7F8617C,
+    0x68FED712, 0xFE6B13D8, 0x93B6EEDB, 0x05232A11, 0x480D14DD, 0xDE98D017, 0xB3452D14, 0x25D0E9DE,
+    0x2919508C, 0xBF8C9446, 0xD2516945, 0x44C4AD8F, 0x09EA9343, 0x9F7F5789, 0xF2A2AA8A, 0x64376E40,
+    0x3ACC760B, 0xAC59B2C1, 0xC1844FC2, 0x57118B08, 0x1A3FB5C4, 0x8CAA710E, 0xE1778C0D, 0x77E248C7,
+    0x7B2BF195, 0xEDBE355F, 0x8063C85C, 0x16F60C96, 0x5BD8325A, 0xCD4DF690, 0xA0900B93, 0x3605CF59,
+    0xB9037937, 0x2F96BDFD, 0x424B40FE, 0xD4DE8434, 0x99F0BAF8, 0x0F657E32, 0x62B88331, 0xF42D47FB,
+    0xF8E4FEA9, 0x6E713A63, 0x03ACC760, 0x953903AA, 0xD8173D66, 0x4E82F9AC, 0x235F04AF, 0xB5CAC065,
+    0x9EA93439, 0x083CF0F3, 0x65E10DF0, 0xF374C93A, 0xBE5AF7F6, 0x28CF333C, 0x4512CE3F, 0xD3870AF5,
+    0xDF4EB3A7, 0x49DB776D, 0x24068A6E, 0xB2934EA4, 0xFFBD7068, 0x6928B4A2, 0x04F549A1, 0x92608D6B,
+    0x1D663B05, 0x8BF3FFCF, 0xE62E02CC, 0x70BBC606, 0x3D95F8CA, 0xAB003C00, 0xC6DDC103, 0x504805C9,
+    0x5C81BC9B, 0xCA147851, 0xA7C98552, 0x315C4198, 0x7C727F54, 0xEAE7BB9E, 0x873A469D, 0x11AF8257,
+    0x4F549A1C, 0xD9C15ED6, 0xB41CA3D5, 0x2289671F, 0x6FA759D3, 0xF9329D19, 0x94EF601A, 0x027AA4D0,
+    0x0EB31D82, 0x9826D948, 0xF5FB244B, 0x636EE081, 0x2E40DE4D, 0xB8D51A87, 0xD508E784, 0x439D234E,
+    0xCC9B9520, 0x5A0E51EA, 0x37D3ACE9, 0xA1466823, 0xEC6856EF, 0x7AFD9225, 0x17206F26, 0x81B5ABEC,
+    0x8D7C12BE, 0x1BE9D674, 0x76342B77, 0xE0A1EFBD, 0xAD8FD171, 0x3B1A15BB, 0x56C7E8B8, 0xC0522C72,
+};
+
+// CRC-32/XFER
+static const uint32_t crc_catalog_table_103[256] = {
+    0x00000000, 0x000000AF, 0x0000015E, 0x000001F1, 0x000002BC, 0x00000213, 0x000003E2, 0x0000034D,
+    0x00000578, 0x000005D7, 0x00000426, 0x00000489, 0x000007C4, 0x0000076B, 0x0000069A, 0x00000635,
+    0x00000AF0, 0x00000A5F, 0x00000BAE, 0x00000B01, 0x0000084C, 0x000008E3, 0x00000912, 0x000009BD,
+    0x00000F88, 0x00000F27, 0x00000ED6, 0x00000E79, 0x00000D34, 0x00000D9B, 0x00000C6A, 0x00000CC5,
+    0x000015E0, 0x0000154F, 0x000014BE, 0x00001411, 0x0000175C, 0x000017F3, 0x00001602, 0x000016AD,
+    0x00001098, 0x00001037, 0x000011C6, 0x00001169, 0x00001224, 0x0000128B, 0x0000137A, 0x000013D5,
+    0x00001F10, 0x00001FBF, 0x00001E4E, 0x00001EE1, 0x00001DAC, 0x00001D03, 0x00001CF2, 0x00001C5D,
+    0x00001A68, 0x00001AC7, 0x00001B36, 0x00001B99, 0x000018D4, 0x0000187B, 0x0000198A, 0x00001925,
+    0x00002BC0, 0x00002B6F, 0x00002A9E, 0x00002A31, 0x0000297C, 0x000029D3, 0x00002822, 0x0000288D,
+    0x00002EB8, 0x00002E17, 0x00002FE6, 0x00002F49, 0x00002C04, 0x00002CAB, 0x00002D5A, 0x00002DF5,
+    0x00002130, 0x0000219F, 0x0000206E, 0x000020C1, 0x0000238C, 0x00002323, 0x000022D2, 0x0000227D,
+    0x00002448, 0x000024E7, 0x00002516, 0x000025B9, 0x000026F4, 0x0000265B, 0x000027AA, 0x00002705,
+    0x00003E20, 0x00003E8F, 0x00003F7E, 0x00003FD1, 0x00003C9C, 0x00003C33, 0x00003DC2, 0x00003D6D,
+    0x00003B58, 0x00003BF7, 0x00003A06, 0x00003AA9, 0x000039E4, 0x0000394B, 0x000038BA, 0x00003815,
+    0x000034D0, 0x0000347F, 0x0000358E, 0x00003521, 0x0000366C, 0x000036C3, 0x00003732, 0x0000379D,
+    0x000031A8, 0x00003107, 0x000030F6, 0x00003059, 0x00003314, 0x000033BB, 0x0000324A, 0x000032E5,
+    0x00005780, 0x0000572F, 0x000056DE, 0x00005671, 0x0000553C, 0x00005593, 0x00005462, 0x000054CD,
+    0x000052F8, 0x00005257, 0x000053A6, 0x00005309, 0x00005044, 0x000050EB, 0x0000511A, 0x000051B5,
+    0x00005D70, 0x00005DDF, 0x00005C2E, 0x00005C81, 0x00005FCC, 0x00005F63, 0x00005E92, 0x00005E3D,
+    0x00005808, 0x000058A7, 0x00005956, 0x000059F9, 0x00005AB4, 0x00005A1B, 0x00005BEA, 0x00005B45,
+    0x00004260, 0x000042CF, 0x0000433E, 0x00004391, 0x000040DC, 0x00004073, 0x00004182, 0x0000412D,
+    0x00004718, 0x000047B7, 0x00004646, 0x000046E9, 0x000045A4, 0x0000450B, 0x000044FA, 0x00004455,
+    0x00004890, 0x0000483F, 0x000049CE, 0x00004961, 0x00004A2C, 0x00004A83, 0x00004B72, 0x00004BDD,
+    0x00004DE8, 0x00004D47, 0x00004CB6, 0x00004C19, 0x00004F54, 0x00004FFB, 0x00004E0A, 0x00004EA5,
+    0x00007C40, 0x00007CEF, 0x00007D1E, 0x00007DB1, 0x00007EFC, 0x00007E53, 0x00007FA2, 0x00007F0D,
+    0x00007938, 0x00007997, 0x00007866, 0x000078C9, 0x00007B84, 0x00007B2B, 0x00007ADA, 0x00007A75,
+    0x000076B0, 0x0000761F, 0x000077EE, 0x00007741, 0x0000740C, 0x000074A3, 0x00007552, 0x000075FD,
+    0x000073C8, 0x00007367, 0x00007296, 0x00007239, 0x00007174, 0x000071DB, 0x0000702A, 0x00007085,
+    0x000069A0, 0x0000690F, 0x000068FE, 0x00006851, 0x00006B1C, 0x00006BB3, 0x00006A42, 0x00006AED,
+    0x00006CD8, 0x00006C77, 0x00006D86, 0x00006D29, 0x00006E64, 0x00006ECB, 0x00006F3A, 0x00006F95,
+    0x00006350, 0x000063FF, 0x0000620E, 0x000062A1, 0x000061EC, 0x00006143, 0x000060B2, 0x0000601D,
+    0x00006628, 0x00006687, 0x00006776, 0x000067D9, 0x00006494, 0x0000643B, 0x000065CA, 0x00006565,
+};
+
+// CRC-40/GSM
+static const uint64_t crc_catalog_table_104[256] = {
+    0x0000000000000000ULL, 0x0000000004820009ULL, 0x0000000009040012ULL, 0x000000000D86001BULL,
+    0x0000000012080024ULL, 0x00000000168A002DULL, 0x000000001B0C0036ULL, 0x000000001F8E003FULL,
+    0x0000000024100048ULL, 0x0000000020920041ULL, 0x000000002D14005AULL, 0x0000000029960053ULL,
+    0x000000003618006CULL, 0x00000000329A0065ULL, 0x000000003F1C007EULL, 0x000000003B9E0077ULL,
+    0x0000000048200090ULL, 0x000000004CA20099ULL, 0x0000000041240082ULL, 0x0000000045A6008BULL,
+    0x000000005A2800B4ULL, 0x000000005EAA00BDULL, 0x00000000532C00A6ULL, 0x0000000057AE00AFULL,
+    0x000000006C3000D8ULL, 0x0000000068B200D1ULL, 0x00000000653400CAULL, 0x0000000061B600C3ULL,
+    0x000000007E3800FCULL, 0x000000007ABA00F5ULL, 0x00000000773C00EEULL, 0x0000000073BE00E7ULL,
+    0x0000000090400120ULL, 0x0000000094C20129ULL, 0x0000000099440132ULL, 0x000000009DC6013BULL,
+    0x0000000082480104ULL, 0x0000000086CA010DULL, 0x000000008B4C0116ULL, 0x000000008FCE011FULL,
+    0x00000000B4500168ULL, 0x00000000B0D20161ULL, 0x00000000BD54017AULL, 0x00000000B9D60173ULL,
+    0x00000000A658014CULL, 0x00000000A2DA0145ULL, 0x00000000AF5C015EULL, 0x00000000ABDE0157ULL,
+    0x00000000D86001B0ULL, 0x00000000DCE201B9ULL, 0x00000000D16401A2ULL, 0x00000000D5E601ABULL,
+    0x00000000CA680194ULL, 0x00000000CEEA019DULL, 0x00000000C36C0186ULL, 0x00000000C7EE018FULL,
+    0x00000000FC7001F8ULL, 0x00000000F8F201F1ULL, 0x00000000F57401EAULL, 0x00000000F1F601E3ULL,
+    0x00000000EE7801DCULL, 0x00000000EAFA01D5ULL, 0x00000000E77C01CEULL, 0x00000000E3FE01C7ULL,
+    0x0000000120800240ULL, 0x0000000124020249ULL, 0x0000000129840252ULL, 0x000000012D06025BULL,
+    0x0000000132880264ULL, 0x00000001360A026DULL, 0x000000013B8C0276ULL, 0x000000013F0E027FULL,
+    0x0000000104900208ULL, 0x0000000100120201ULL, 0x000000010D94021AULL, 0x0000000109160213ULL,
+    0x000000011698022CULL, 0x00000001121A0225ULL, 0x000000011F9C023EULL, 0x000000011B1E0237ULL,
+    0x0000000168A002D0ULL, 0x000000016C2202D9ULL, 0x0000000161A402C2ULL, 0x00000001652602CBULL,
+    0x000000017AA802F4ULL, 0x000000017E2A02FDULL, 0x0000000173AC02E6ULL, 0x00000001772E02EFULL,
+    0x000000014CB00298ULL, 0x0000000148320291ULL, 0x0000000145B4028AULL, 0x0000000141360283ULL,
+    0x000000015EB802BCULL, 0x000000015A3A02B5ULL, 0x0000000157BC02AEULL, 0x00000001533E02A7ULL,
+    0x00000001B0C00360ULL, 0x00000001B4420369ULL, 0x00000001B9C40372ULL, 0x00000001BD46037BULL,
+    0x00000001A2C80344ULL, 0x00000001A64A034DULL, 0x00000001ABCC0356ULL, 0x00000001AF4E035FULL,
+    0x0000000194D00328ULL, 0x0000000190520321ULL, 0x000000019DD4033AULL, 0x0000000199560333ULL,
+    0x0000000186D8030CULL, 0x00000001825A0305ULL, 0x000000018FDC031EULL, 0x000000018B5E0317ULL,
+    0x00000001F8E003F0ULL, 0x00000001FC6203F9ULL, 0x00000001F1E403E2ULL, 0x00000001F56603EBULL,
+    0x00000001EAE803D4ULL, 0x00000001EE6A03DDULL, 0x00000001E3EC03C6ULL, 0x00000001E76E03CFULL,
+    0x00000001DCF003B8ULL, 0x00000001D87203B1ULL, 0x00000001D5F403AAULL, 0x00000001D17603A3ULL,
+    0x00000001CEF8039CULL, 0x00000001CA7A0395ULL, 0x00000001C7FC038EULL, 0x00000001C37E0387ULL,
+    0x0000000241000480ULL, 0x0000000245820489ULL, 0x0000000248040492ULL, 0x000000024C86049BULL,
+    0x00000002530804A4ULL, 0x00000002578A04ADULL, 0x000000025A0C04B6ULL, 0x000000025E8E04BFULL,
+    0x00000002651004C8ULL, 0x00000002619204C1ULL, 0x000000026C1404DAULL, 0x00000002689604D3ULL,
+    0x00000002771804ECULL, 0x00000002739A04E5ULL, 0x000000027E1C04FEULL, 0x000000027A9E04F7ULL,
+    0x0000000209200410ULL, 0x000000020DA20419ULL, 0x0000000200240402ULL, 0x0000000204A6040BULL,
+    0x000000021B280434ULL, 0x000000021FAA043DULL, 0x00000002122C0426ULL, 0x0000000216AE042FULL,
+    0x000000022D300458ULL, 0x0000000229B20451ULL, 0x000000022434044AULL, 0x0000000220B60443ULL,
+    0x000000023F38047CULL, 0x000000023BBA0475ULL, 0x00000002363C046EULL, 0x0000000232BE0467ULL,
+    0x00000002D14005A0ULL, 0x00000002D5C205A9ULL, 0x00000002D84405B2ULL, 0x00000002DCC605BBULL,
+    0x00000002C3480584ULL, 0x00000002C7CA058DULL, 0x00000002CA4C0596ULL, 0x00000002CECE059FULL,
+    0x00000002F55005E8ULL, 0x00000002F1D205E1ULL, 0x00000002FC5405FAULL, 0x00000002F8D605F3ULL,
+    0x00000002E75805CCULL, 0x00000002E3DA05C5ULL, 0x00000002EE5C05DEULL, 0x00000002EADE05D7ULL,
+    0x0000000299600530ULL, 0x000000029DE20539ULL, 0x0000000290640522ULL, 0x0000000294E6052BULL,
+    0x000000028B680514ULL, 0x000000028FEA051DULL, 0x00000002826C0506ULL, 0x0000000286EE050FULL,
+    0x00000002BD700578ULL, 0x00000002B9F20571ULL, 0x00000002B474056AULL, 0x00000002B0F60563ULL,
+    0x00000002AF78055CULL, 0x00000002ABFA0555ULL, 0x00000002A67C054EULL, 0x00000002A2FE0547ULL,
+    0x00000003618006C0ULL, 0x00000003650206C9ULL, 0x00000003688406D2ULL, 0x000000036C0606DBULL,
+    0x00000003738806E4ULL, 0x00000003770A06EDULL, 0x000000037A8C06F6ULL, 0x000000037E0E06FFULL,
+    0x0000000345900688ULL, 0x0000000341120681ULL, 0x000000034C94069AULL, 0x0000000348160693ULL,
+    0x00000003579806ACULL, 0x00000003531A06A5ULL, 0x000000035E9C06BEULL, 0x000000035A1E06B7ULL,
+    0x0000000329A00650ULL, 0x000000032D220659ULL, 0x0000000320A40642ULL, 0x000000032426064BULL,
+    0x000000033BA80674ULL, 0x000000033F2A067DULL, 0x0000000332AC0666ULL, 0x00000003362E066FULL,
+    0x000000030DB00618ULL, 0x0000000309320611ULL, 0x0000000304B4060AULL, 0x0000000300360603ULL,
+    0x000000031FB8063CULL, 0x000000031B3A0635ULL, 0x0000000316BC062EULL, 0x00000003123E0627ULL,
+    0x00000003F1C007E0ULL, 0x00000003F54207E9ULL, 0x00000003F8C407F2ULL, 0x00000003FC4607FBULL,
+    0x00000003E3C807C4ULL, 0x00000003E74A07CDULL, 0x00000003EACC07D6ULL, 0x00000003EE4E07DFULL,
+    0x00000003D5D007A8ULL, 0x00000003D15207A1ULL, 0x00000003DCD407BAULL, 0x00000003D85607B3ULL,
+    0x00000003C7D8078CULL, 0x00000003C35A0785ULL, 0x00000003CEDC079EULL, 0x00000003CA5E0797ULL,
+    0x00000003B9E00770ULL, 0x00000003BD620779ULL, 0x00000003B0E40762ULL, 0x00000003B466076BULL,
+    0x00000003ABE80754ULL, 0x00000003AF6A075DULL, 0x00000003A2EC0746ULL, 0x00000003A66E074FULL,
+    0x000000039DF00738ULL, 0x0000000399720731ULL, 0x0000000394F4072AULL, 0x0000000390760723ULL,
+    0x000000038FF8071CULL, 0x000000038B7A0715ULL, 0x0000000386FC070EULL, 0x00000003827E0707ULL,
+};
+
+// CRC-64/ECMA-182
+static const uint64_t crc_catalog_table_105[256] = {
+    0x0000000000000000ULL, 0x42F0E1EBA9EA3693ULL, 0x85E1C3D753D46D26ULL, 0xC711223CFA3E5BB5ULL,
+    0x493366450E42ECDFULL, 0x0BC387AEA7A8DA4CULL, 0xCCD2A5925D9681F9ULL, 0x8E224479F47CB76AULL,
+    0x9266CC8A1C85D9BEULL, 0xD0962D61B56FEF2DULL, 0x17870F5D4F51B498ULL, 0x5577EEB6E6BB820BULL,
+    0xDB55AACF12C73561ULL, 0x99A54B24BB2D03F2ULL, 0x5EB4691841135847ULL, 0x1C4488F3E8F96ED4ULL,
+    0x663D78FF90E185EFULL, 0x24CD9914390BB37CULL, 0xE3DCBB28C335E8C9ULL, 0xA12C5AC36ADFDE5AULL,
+    0x2F0E1EBA9EA36930ULL, 0x6DFEFF5137495FA3ULL, 0xAAEFDD6DCD770416ULL, 0xE81F3C86649D3285ULL,
+    0xF45BB4758C645C51ULL, 0xB6AB559E258E6AC2ULL, 0x71BA77A2DFB03177ULL, 0x334A9649765A07E4ULL,
+    0xBD68D2308226B08EULL, 0xFF9833DB2BCC861DULL, 0x388911E7D1F2DDA8ULL, 0x7A79F00C7818EB3BULL,
+    0xCC7AF1FF21C30BDEULL, 0x8E8A101488293D4DULL, 0x499B3228721766F8ULL, 0x0B6BD3C3DBFD506BULL,
+    0x854997BA2F81E701ULL, 0xC7B97651866BD192ULL, 0x00A8546D7C558A27ULL, 0x4258B586D5BFBCB4ULL,
+    0x5E1C3D753D46D260ULL, 0x1CECDC9E94ACE4F3ULL, 0xDBFDFEA26E92BF46ULL, 0x990D1F49C77889D5ULL,
+    0x172F5B3033043EBFULL, 0x55DFBADB9AEE082CULL, 0x92CE98E760D05399ULL, 0xD03E790CC93A650AULL,
+    0xAA478900B1228E31ULL, 0xE8B768EB18C8B8A2ULL, 0x2FA64AD7E2F6E317ULL, 0x6D56AB3C4B1CD584ULL,
+    0xE374EF45BF6062EEULL, 0xA1840EAE168A547DULL, 0x66952C92ECB40FC8ULL, 0x2465CD79455E395BULL,
+    0x3821458AADA7578FULL, 0x7AD1A461044D611CULL, 0xBDC0865DFE733AA9ULL, 0xFF3067B657990C3AULL,
+    0x711223CFA3E5BB50ULL, 0x33E2C2240A0F8DC3ULL, 0xF4F3E018F031D676ULL, 0xB60301F359DBE0E5ULL,
+    0xDA050215EA6C212FULL, 0x98F5E3FE438617BCULL, 0x5FE4C1C2B9B84C09ULL, 0x1D14202910527A9AULL,
+    0x93366450E42ECDF0ULL, 0xD1C685BB4DC4FB63ULL, 0x16D7A787B7FAA0D6ULL, 0x5427466C1E109645ULL,
+    0x4863CE9FF6E9F891ULL, 0x0A932F745F03CE02ULL, 0xCD820D48A53D95B7ULL, 0x8F72ECA30CD7A324ULL,
+    0x0150A8DAF8AB144EULL, 0x43A04931514122DDULL, 0x84B16B0DAB7F7968ULL, 0xC6418AE602954FFBULL,
+    0xBC387AEA7A8DA4C0ULL, 0xFEC89B01D3679253ULL, 0x39D9B93D2959C9E6ULL, 0x7B2958D680B3FF75ULL,
+    0xF50B1CAF74CF481FULL, 0xB7FBFD44DD257E8CULL, 0x70EADF78271B2539ULL, 0x321A3E938EF113AAULL,
+    0x2E5EB66066087D7EULL, 0x6CAE578BCFE24BEDULL, 0xABBF75B735DC1058ULL, 0xE94F945C9C3626CBULL,
+    0x676DD025684A91A1ULL, 0x259D31CEC1A0A732ULL, 0xE28C13F23B9EFC87ULL, 0xA07CF2199274CA14ULL,
+    0x167FF3EACBAF2AF1ULL, 0x548F120162451C62ULL, 0x939E303D987B47D7ULL, 0xD16ED1D631917144ULL,
+    0x5F4C95AFC5EDC62EULL, 0x1DBC74446C07F0BDULL, 0xDAAD56789639AB08ULL, 0x985DB7933FD39D9BULL,
+    0x84193F60D72AF34FULL, 0xC6E9DE8B7EC0C5DCULL, 0x01F8FCB784FE9E69ULL, 0x43081D5C2D14A8FAULL,
+    0xCD2A5925D9681F90ULL, 0x8FDAB8CE70822903ULL, 0x48CB9AF28ABC72B6ULL, 0x0A3B7B1923564425ULL,
+    0x70428B155B4EAF1EULL, 0x32B26AFEF2A4998DULL, 0xF5A348C2089AC238ULL, 0xB753A929A170F4ABULL,
+    0x3971ED50550C43C1ULL, 0x7B810CBBFCE67552ULL, 0xBC902E8706D82EE7ULL, 0xFE60CF6CAF321874ULL,
+    0xE224479F47CB76A0ULL, 0xA0D4A674EE214033ULL, 0x67C58448141F1B86ULL, 0x253565A3BDF52D15ULL,
+    0xAB1721DA49899A7FULL, 0xE9E7C031E063ACECULL, 0x2EF6E20D1A5DF759ULL, 0x6C0603E6B3B7C1CAULL,
+    0xF6FAE5C07D3274CDULL, 0xB40A042BD4D8425EULL, 0x731B26172EE619EBULL, 0x31EBC7FC870C2F78ULL,
+    0xBFC9838573709812ULL, 0xFD39626EDA9AAE81ULL, 0x3A28405220A4F534ULL, 0x78D8A1B9894EC3A7ULL,
+    0x649C294A61B7AD73ULL, 0x266CC8A1C85D9BE0ULL, 0xE17DEA9D3263C055ULL, 0xA38D0B769B89F6C6ULL,
+    0x2DAF4F0F6FF541ACULL, 0x6F5FAEE4C61F773FULL, 0xA84E8CD83C212C8AULL, 0xEABE6D3395CB1A19ULL,
+    0x90C79D3FEDD3F122ULL, 0xD2377CD44439C7B1ULL, 0x15265EE8BE079C04ULL, 0x57D6BF0317EDAA97ULL,
+    0xD9F4FB7AE3911DFDULL, 0x9B041A914A7B2B6EULL, 0x5C1538ADB04570DBULL, 0x1EE5D94619AF4648ULL,
+    0x02A151B5F156289CULL, 0x4051B05E58BC1E0FULL, 0x87409262A28245BAULL, 0xC5B073890B687329ULL,
+    0x4B9237F0FF14C443ULL, 0x0962D61B56FEF2D0ULL, 0xCE73F427ACC0A965ULL, 0x8C8315CC052A9FF6ULL,
+    0x3A80143F5CF17F13ULL, 0x7870F5D4F51B4980ULL, 0xBF61D7E80F251235ULL, 0xFD913603A6CF24A6ULL,
+    0x73B3727A52B393CCULL, 0x31439391FB59A55FULL, 0xF652B1AD0167FEEAULL, 0xB4A25046A88DC879ULL,
+    0xA8E6D8B54074A6ADULL, 0xEA16395EE99E903EULL, 0x2D071B6213A0CB8BULL, 0x6FF7FA89BA4AFD18ULL,
+    0xE1D5BEF04E364A72ULL, 0xA3255F1BE7DC7CE1ULL, 0x64347D271DE22754ULL, 0x26C49CCCB40811C7ULL,
+    0x5CBD6CC0CC10FAFCULL, 0x1E4D8D2B65FACC6FULL, 0xD95CAF179FC497DAULL, 0x9BAC4EFC362EA149ULL,
+    0x158E0A85C2521623ULL, 0x577EEB6E6BB820B0ULL, 0x906FC95291867B05ULL, 0xD29F28B9386C4D96ULL,
+    0xCEDBA04AD0952342ULL, 0x8C2B41A1797F15D1ULL, 0x4B3A639D83414E64ULL, 0x09CA82762AAB78F7ULL,
+    0x87E8C60FDED7CF9DULL, 0xC51827E4773DF90EULL, 0x020905D88D03A2BBULL, 0x40F9E43324E99428ULL,
+    0x2CFFE7D5975E55E2ULL, 0x6E0F063E3EB46371ULL, 0xA91E2402C48A38C4ULL, 0xEBEEC5E96D600E57ULL,
+    0x65CC8190991CB93DULL, 0x273C607B30F68FAEULL, 0xE02D4247CAC8D41BULL, 0xA2DDA3AC6322E288ULL,
+    0xBE992B5F8BDB8C5CULL, 0xFC69CAB42231BACFULL, 0x3B78E888D80FE17AULL, 0x7988096371E5D7E9ULL,
+    0xF7AA4D1A85996083ULL, 0xB55AACF12C735610ULL, 0x724B8ECDD64D0DA5ULL, 0x30BB6F267FA73B36ULL,
+    0x4AC29F2A07BFD00DULL, 0x08327EC1AE55E69EULL, 0xCF235CFD546BBD2BULL, 0x8DD3BD16FD818BB8ULL,
+    0x03F1F96F09FD3CD2ULL, 0x41011884A0170A41ULL, 0x86103AB85A2951F4ULL, 0xC4E0DB53F3C36767ULL,
+    0xD8A453A01B3A09B3ULL, 0x9A54B24BB2D03F20ULL, 0x5D45907748EE6495ULL, 0x1FB5719CE1045206ULL,
+    0x919735E51578E56CULL, 0xD367D40EBC92D3FFULL, 0x1476F63246AC884AULL, 0x568617D9EF46BED9ULL,
+    0xE085162AB69D5E3CULL, 0xA275F7C11F7768AFULL, 0x6564D5FDE549331AULL, 0x279434164CA30589ULL,
+    0xA9B6706FB8DFB2E3ULL, 0xEB46918411358470ULL, 0x2C57B3B8EB0BDFC5ULL, 0x6EA7525342E1E956ULL,
+    0x72E3DAA0AA188782ULL, 0x30133B4B03F2B111ULL, 0xF7021977F9CCEAA4ULL, 0xB5F2F89C5026DC37ULL,
+    0x3BD0BCE5A45A6B5DULL, 0x79205D0E0DB05DCEULL, 0xBE317F32F78E067BULL, 0xFCC19ED95E6430E8ULL,
+    0x86B86ED5267CDBD3ULL, 0xC4488F3E8F96ED40ULL, 0x0359AD0275A8B6F5ULL, 0x41A94CE9DC428066ULL,
+    0xCF8B0890283E370CULL, 0x8D7BE97B81D4019FULL, 0x4A6ACB477BEA5A2AULL, 0x089A2AACD2006CB9ULL,
+    0x14DEA25F3AF9026DULL, 0x562E43B4931334FEULL, 0x913F6188692D6F4BULL, 0xD3CF8063C0C759D8ULL,
+    0x5DEDC41A34BBEEB2ULL, 0x1F1D25F19D51D821ULL, 0xD80C07CD676F8394ULL, 0x9AFCE626CE85B507ULL,
+};
+
+// CRC-64/GO-ISO
+static const uint64_t crc_catalog_table_106[256] = {
+    0x0000000000000000ULL, 0x01B0000000000000ULL, 0x0360000000000000ULL, 0x02D0000000000000ULL,
+    0x06C0000000000000ULL, 0x0770000000000000ULL, 0x05A0000000000000ULL, 0x0410000000000000ULL,
+    0x0D80000000000000ULL, 0x0C30000000000000ULL, 0x0EE0000000000000ULL, 0x0F50000000000000ULL,
+    0x0B40000000000000ULL, 0x0AF0000000000000ULL, 0x0820000000000000ULL, 0x0990000000000000ULL,
+    0x1B00000000000000ULL, 0x1AB0000000000000ULL, 0x1860000000000000ULL, 0x19D0000000000000ULL,
+    0x1DC0000000000000ULL, 0x1C70000000000000ULL, 0x1EA0000000000000ULL, 0x1F10000000000000ULL,
+    0x1680000000000000ULL, 0x1730000000000000ULL, 0x15E0000000000000ULL, 0x1450000000000000ULL,
+    0x1040000000000000ULL, 0x11F0000000000000ULL, 0x1320000000000000ULL, 0x1290000000000000ULL,
+    0x3600000000000000ULL, 0x37B0000000000000ULL, 0x3560000000000000ULL, 0x34D0000000000000ULL,
+    0x30C0000000000000ULL, 0x3170000000000000ULL, 0x33A0000000000000ULL, 0x3210000000000000ULL,
+    0x3B80000000000000ULL, 0x3A30000000000000ULL, 0x38E0000000000000ULL, 0x3950000000000000ULL,
+    0x3D40000000000000ULL, 0x3CF0000000000000ULL, 0x3E20000000000000ULL, 0x3F90000000000000ULL,
+    0x2D00000000000000ULL, 0x2CB0000000000000ULL, 0x2E60000000000000ULL, 0x2FD0000000000000ULL,
+    0x2BC0000000000000ULL, 0x2A70000000000000ULL, 0x28A0000000000000ULL, 0x2910000000000000ULL,
+    0x2080000000000000ULL, 0x2130000000000000ULL, 0x23E0000000000000ULL, 0x2250000000000000ULL,
+    0x2640000000000000ULL, 0x27F0000000000000ULL, 0x2520000000000000ULL, 0x2490000000000000ULL,
+    0x6C00000000000000ULL, 0x6DB0000000000000ULL, 0x6F60000000000000ULL, 0x6ED0000000000000ULL,
+    0x6AC0000000000000ULL, 0x6B70000000000000ULL, 0x69A0000000000000ULL, 0x6810000000000000ULL,
+    0x6180000000000000ULL, 0x6030000000000000ULL, 0x62E0000000000000ULL, 0x6350000000000000ULL,
+    0x6740000000000000ULL, 0x66F0000000000000ULL, 0x6420000000000000ULL, 0x6590000000000000ULL,
+    0x7700000000000000ULL, 0x76B0000000000000ULL, 0x7460000000000000ULL, 0x75D0000000000000ULL,
+    0x71C0000000000000ULL, 0x7070000000000000ULL, 0x72A0000000000000ULL, 0x7310000000000000ULL,
+    0x7A80000000000000ULL, 0x7B30000000000000ULL, 0x79E0000000000000ULL, 0x7850000000000000ULL,
+    0x7C40000000000000ULL, 0x7DF0000000000000ULL, 0x7F20000000000000ULL, 0x7E90000000000000ULL,
+    0x5A00000000000000ULL, 0x5BB0000000000000ULL, 0x5960000000000000ULL, 0x58D0000000000000ULL,
+    0x5CC0000000000000ULL, 0x5D70000000000000ULL, 0x5FA0000000000000ULL, 0x5E10000000000000ULL,
+    0x5780000000000000ULL, 0x5630000000000000ULL, 0x54E0000000000000ULL, 0x5550000000000000ULL,
+    0x5140000000000000ULL, 0x50F0000000000000ULL, 0x5220000000000000ULL, 0x5390000000000000ULL,
+    0x4100000000000000ULL, 0x40B0000000000000ULL, 0x4260000000000000ULL, 0x43D0000000000000ULL,
+    0x47C0000000000000ULL, 0x4670000000000000ULL, 0x44A0000000000000ULL, 0x4510000000000000ULL,
+    0x4C80000000000000ULL, 0x4D30000000000000ULL, 0x4FE0000000000000ULL, 0x4E50000000000000ULL,
+    0x4A40000000000000ULL, 0x4BF0000000000000ULL, 0x4920000000000000ULL, 0x4890000000000000ULL,
+    0xD800000000000000ULL, 0xD9B0000000000000ULL, 0xDB60000000000000ULL, 0xDAD0000000000000ULL,
+    0xDEC0000000000000ULL, 0xDF70000000000000ULL, 0xDDA0000000000000ULL, 0xDC10000000000000ULL,
+    0xD580000000000000ULL, 0xD430000000000000ULL, 0xD6E0000000000000ULL, 0xD750000000000000ULL,
+    0xD340000000000000ULL, 0xD2F0000000000000ULL, 0xD020000000000000ULL, 0xD190000000000000ULL,
+    0xC300000000000000ULL, 0xC2B0000000000000ULL, 0xC060000000000000ULL, 0xC1D0000000000000ULL,
+    0xC5C0000000000000ULL, 0xC470000000000000ULL, 0xC6A0000000000000ULL, 0xC710000000000000ULL,
+    0xCE80000000000000ULL, 0xCF30000000000000ULL, 0xCDE0000000000000ULL, 0xCC50000000000000ULL,
+    0xC840000000000000ULL, 0xC9F0000000000000ULL, 0xCB20000000000000ULL, 0xCA90000000000000ULL,
+    0xEE00000000000000ULL, 0xEFB0000000000000ULL, 0xED60000000000000ULL, 0xECD0000000000000ULL,
+    0xE8C0000000000000ULL, 0xE970000000000000ULL, 0xEBA0000000000000ULL, 0xEA10000000000000ULL,
+    0xE380000000000000ULL, 0xE230000000000000ULL, 0xE0E0000000000000ULL, 0xE150000000000000ULL,
+    0xE540000000000000ULL, 0xE4F0000000000000ULL, 0xE620000000000000ULL, 0xE790000000000000ULL,
+    0xF500000000000000ULL, 0xF4B0000000000000ULL, 0xF660000000000000ULL, 0xF7D0000000000000ULL,
+    0xF3C0000000000000ULL, 0xF270000000000000ULL, 0xF0A0000000000000ULL, 0xF110000000000000ULL,
+    0xF880000000000000ULL, 0xF930000000000000ULL, 0xFBE0000000000000ULL, 0xFA50000000000000ULL,
+    0xFE40000000000000ULL, 0xFFF0000000000000ULL, 0xFD20000000000000ULL, 0xFC90000000000000ULL,
+    0xB400000000000000ULL, 0xB5B0000000000000ULL, 0xB760000000000000ULL, 0xB6D0000000000000ULL,
+    0xB2C0000000000000ULL, 0xB370000000000000ULL, 0xB1A0000000000000ULL, 0xB010000000000000ULL,
+    0xB980000000000000ULL, 0xB830000000000000ULL, 0xBAE0000000000000ULL, 0xBB50000000000000ULL,
+    0xBF40000000000000ULL, 0xBEF0000000000000ULL, 0xBC20000000000000ULL, 0xBD90000000000000ULL,
+    0xAF00000000000000ULL, 0xAEB0000000000000ULL, 0xAC60000000000000ULL, 0xADD0000000000000ULL,
+    0xA9C0000000000000ULL, 0xA870000000000000ULL, 0xAAA0000000000000ULL, 0xAB10000000000000ULL,
+    0xA280000000000000ULL, 0xA330000000000000ULL, 0xA1E0000000000000ULL, 0xA050000000000000ULL,
+    0xA440000000000000ULL, 0xA5F0000000000000ULL, 0xA720000000000000ULL, 0xA690000000000000ULL,
+    0x8200000000000000ULL, 0x83B0000000000000ULL, 0x8160000000000000ULL, 0x80D0000000000000ULL,
+    0x84C0000000000000ULL, 0x8570000000000000ULL, 0x87A0000000000000ULL, 0x8610000000000000ULL,
+    0x8F80000000000000ULL, 0x8E30000000000000ULL, 0x8CE0000000000000ULL, 0x8D50000000000000ULL,
+    0x8940000000000000ULL, 0x88F0000000000000ULL, 0x8A20000000000000ULL, 0x8B90000000000000ULL,
+    0x9900000000000000ULL, 0x98B0000000000000ULL, 0x9A60000000000000ULL, 0x9BD0000000000000ULL,
+    0x9FC0000000000000ULL, 0x9E70000000000000ULL, 0x9CA0000000000000ULL, 0x9D10000000000000ULL,
+    0x9480000000000000ULL, 0x9530000000000000ULL, 0x97E0000000000000ULL, 0x9650000000000000ULL,
+    0x9240000000000000ULL, 0x93F0000000000000ULL, 0x9120000000000000ULL, 0x9090000000000000ULL,
+};
+
+// CRC-64/MS
+static const uint64_t crc_catalog_table_107[256] = {
+    0x0000000000000000ULL, 0x0809E8A2969451E9ULL, 0x1013D1452D28A3D2ULL, 0x181A39E7BBBCF23BULL,
+    0x2027A28A5A5147A4ULL, 0x282E4A28CCC5164DULL, 0x303473CF7779E476ULL, 0x383D9B6DE1EDB59FULL,
+    0x404F4514B4A28F48ULL, 0x4846ADB62236DEA1ULL, 0x505C9451998A2C9AULL, 0x58557CF30F1E7D73ULL,
+    0x6068E79EEEF3C8ECULL, 0x68610F3C78679905ULL, 0x707B36DBC3DB6B3EULL, 0x7872DE79554F3AD7ULL,
+    0x809E8A2969451E90ULL, 0x8897628BFFD14F79ULL, 0x908D5B6C446DBD42ULL, 0x9884B3CED2F9ECABULL,
+    0xA0B928A333145934ULL, 0xA8B0C001A58008DDULL, 0xB0AAF9E61E3CFAE6ULL, 0xB8A3114488A8AB0FULL,
+    0xC0D1CF3DDDE791D8ULL, 0xC8D8279F4B73C031ULL, 0xD0C21E78F0CF320AULL, 0xD8CBF6DA665B63E3ULL,
+    0xE0F66DB787B6D67CULL, 0xE8FF851511228795ULL, 0xF0E5BCF2AA9E75AEULL, 0xF8EC54503C0A2447ULL,
+    0x24B1909974C84E69ULL, 0x2CB8783BE25C1F80ULL, 0x34A241DC59E0EDBBULL, 0x3CABA97ECF74BC52ULL,
+    0x049632132E9909CDULL, 0x0C9FDAB1B80D5824ULL, 0x1485E35603B1AA1FULL, 0x1C8C0BF49525FBF6ULL,
+    0x64FED58DC06AC121ULL, 0x6CF73D2F56FE90C8ULL, 0x74ED04C8ED4262F3ULL, 0x7CE4EC6A7BD6331AULL,
+    0x44D977079A3B8685ULL, 0x4CD09FA50CAFD76CULL, 0x54CAA642B7132557ULL, 0x5CC34EE0218774BEULL,
+    0xA42F1AB01D8D50F9ULL, 0xAC26F2128B190110ULL, 0xB43CCBF530A5F32BULL, 0xBC352357A631A2C2ULL,
+    0x8408B83A47DC175DULL, 0x8C015098D14846B4ULL, 0x941B697F6AF4B48FULL, 0x9C1281DDFC60E566ULL,
+    0xE4605FA4A92FDFB1ULL, 0xEC69B7063FBB8E58ULL, 0xF4738EE184077C63ULL, 0xFC7A664312932D8AULL,
+    0xC447FD2EF37E9815ULL, 0xCC4E158C65EAC9FCULL, 0xD4542C6BDE563BC7ULL, 0xDC5DC4C948C26A2EULL,
+    0x49632132E9909CD2ULL, 0x416AC9907F04CD3BULL, 0x5970F077C4B83F00ULL, 0x517918D5522C6EE9ULL,
+    0x694483B8B3C1DB76ULL, 0x614D6B1A25558A9FULL, 0x795752FD9EE978A4ULL, 0x715EBA5F087D294DULL,
+    0x092C64265D32139AULL, 0x01258C84CBA64273ULL, 0x193FB563701AB048ULL, 0x11365DC1E68EE1A1ULL,
+    0x290BC6AC0763543EULL, 0x21022E0E91F705D7ULL, 0x391817E92A4BF7ECULL, 0x3111FF4BBCDFA605ULL,
+    0xC9FDAB1B80D58242ULL, 0xC1F443B91641D3ABULL, 0xD9EE7A5EADFD2190ULL, 0xD1E792FC3B697079ULL,
+    0xE9DA0991DA84C5E6ULL, 0xE1D3E1334C10940FULL, 0xF9C9D8D4F7AC6634ULL, 0xF1C03076613837DDULL,
+    0x89B2EE0F34770D0AULL, 0x81BB06ADA2E35CE3ULL, 0x99A13F4A195FAED8ULL, 0x91A8D7E88FCBFF31ULL,
+    0xA9954C856E264AAEULL, 0xA19CA427F8B21B47ULL, 0xB9869DC0430EE97CULL, 0xB18F7562D59AB895ULL,
+    0x6DD2B1AB9D58D2BBULL, 0x65DB59090BCC8352ULL, 0x7DC160EEB0707169ULL, 0x75C8884C26E42080ULL,
+    0x4DF51321C709951FULL, 0x45FCFB83519DC4F6ULL, 0x5DE6C264EA2136CDULL, 0x55EF2AC67CB56724ULL,
+    0x2D9DF4BF29FA5DF3ULL, 0x25941C1DBF6E0C1AULL, 0x3D8E25FA04D2FE21ULL, 0x3587CD589246AFC8ULL,
+    0x0DBA563573AB1A57ULL, 0x05B3BE97E53F4BBEULL, 0x1DA987705E83B985ULL, 0x15A06FD2C817E86CULL,
+    0xED4C3B82F41DCC2BULL, 0xE545D32062899DC2ULL, 0xFD5FEAC7D9356FF9ULL, 0xF55602654FA13E10ULL,
+    0xCD6B9908AE4C8B8FULL, 0xC56271AA38D8DA66ULL, 0xDD78484D8364285DULL, 0xD571A0EF15F079B4ULL,
+    0xAD037E9640BF4363ULL, 0xA50A9634D62B128AULL, 0xBD10AFD36D97E0B1ULL, 0xB5194771FB03B158ULL,
+    0x8D24DC1C1AEE04C7ULL, 0x852D34BE8C7A552EULL, 0x9D370D5937C6A715ULL, 0x953EE5FBA152F6FCULL,
+    0x92C64265D32139A4ULL, 0x9ACFAAC745B5684DULL, 0x82D59320FE099A76ULL, 0x8ADC7B82689DCB9FULL,
+    0xB2E1E0EF89707E00ULL, 0xBAE8084D1FE42FE9ULL, 0xA2F231AAA458DDD2ULL, 0xAAFBD90832CC8C3BULL,
+    0xD28907716783B6ECULL, 0xDA80EFD3F117E705ULL, 0xC29AD6344AAB153EULL, 0xCA933E96DC3F44D7ULL,
+    0xF2AEA5FB3DD2F148ULL, 0xFAA74D59AB46A0A1ULL, 0xE2BD74BE10FA529AULL, 0xEAB49C1C866E0373ULL,
+    0x1258C84CBA642734ULL, 0x1A5120EE2CF076DDULL, 0x024B1909974C84E6ULL, 0x0A42F1AB01D8D50FULL,
+    0x327F6AC6E0356090ULL, 0x3A76826476A13179ULL, 0x226CBB83CD1DC342ULL, 0x2A6553215B8992ABULL,
+    0x52178D580EC6A87CULL, 0x5A1E65FA9852F995ULL, 0x42045C1D23EE0BAEULL, 0x4A0DB4BFB57A5A47ULL,
+    0x72302FD25497EFD8ULL, 0x7A39C770C203BE31ULL, 0x6223FE9779BF4C0AULL, 0x6A2A1635EF2B1DE3ULL,
+    0xB677D2FCA7E977CDULL, 0xBE7E3A5E317D2624ULL, 0xA66403B98AC1D41FULL, 0xAE6DEB1B1C5585F6ULL,
+    0x96507076FDB83069ULL, 0x9E5998D46B2C6180ULL, 0x8643A133D09093BBULL, 0x8E4A49914604C252ULL,
+    0xF63897E8134BF885ULL, 0xFE317F4A85DFA96CULL, 0xE62B46AD3E635B57ULL, 0xEE22AE0FA8F70ABEULL,
+    0xD61F3562491ABF21ULL, 0xDE16DDC0DF8EEEC8ULL, 0xC60CE42764321CF3ULL, 0xCE050C85F2A64D1AULL,
+    0x36E958D5CEAC695DULL, 0x3EE0B077583838B4ULL, 0x26FA8990E384CA8FULL, 0x2EF3613275109B66ULL,
+    0x16CEFA5F94FD2EF9ULL, 0x1EC712FD02697F10ULL, 0x06DD2B1AB9D58D2BULL, 0x0ED4C3B82F41DCC2ULL,
+    0x76A61DC17A0EE615ULL, 0x7EAFF563EC9AB7FCULL, 0x66B5CC84572645C7ULL, 0x6EBC2426C1B2142EULL,
+    0x5681BF4B205FA1B1ULL, 0x5E8857E9B6CBF058ULL, 0x46926E0E0D770263ULL, 0x4E9B86AC9BE3538AULL,
+    0xDBA563573AB1A576ULL, 0xD3AC8BF5AC25F49FULL, 0xCBB6B212179906A4ULL, 0xC3BF5AB0810D574DULL,
+    0xFB82C1DD60E0E2D2ULL, 0xF38B297FF674B33BULL, 0xEB9110984DC84100ULL, 0xE398F83ADB5C10E9ULL,
+    0x9BEA26438E132A3EULL, 0x93E3CEE118877BD7ULL, 0x8BF9F706A33B89ECULL, 0x83F01FA435AFD805ULL,
+    0xBBCD84C9D4426D9AULL, 0xB3C46C6B42D63C73ULL, 0xABDE558CF96ACE48ULL, 0xA3D7BD2E6FFE9FA1ULL,
+    0x5B3BE97E53F4BBE6ULL, 0x533201DCC560EA0FULL, 0x4B28383B7EDC1834ULL, 0x4321D099E84849DDULL,
+    0x7B1C4BF409A5FC42ULL, 0x7315A3569F31ADABULL, 0x6B0F9AB1248D5F90ULL, 0x63067213B2190E79ULL,
+    0x1B74AC6AE75634AEULL, 0x137D44C871C26547ULL, 0x0B677D2FCA7E977CULL, 0x036E958D5CEAC695ULL,
+    0x3B530EE0BD07730AULL, 0x335AE6422B9322E3ULL, 0x2B40DFA5902FD0D8ULL, 0x2349370706BB8131ULL,
+    0xFF14F3CE4E79EB1FULL, 0xF71D1B6CD8EDBAF6ULL, 0xEF07228B635148CDULL, 0xE70ECA29F5C51924ULL,
+    0xDF3351441428ACBBULL, 0xD73AB9E682BCFD52ULL, 0xCF20800139000F69ULL, 0xC72968A3AF945E80ULL,
+    0xBF5BB6DAFADB6457ULL, 0xB7525E786C4F35BEULL, 0xAF48679FD7F3C785ULL, 0xA7418F3D4167966CULL,
+    0x9F7C1450A08A23F3ULL, 0x9775FCF2361E721AULL, 0x8F6FC5158DA28021ULL, 0x87662DB71B36D1C8ULL,
+    0x7F8A79E7273CF58FULL, 0x77839145B1A8A466ULL, 0x6F99A8A20A14565DULL, 0x679040009C8007B4ULL,
+    0x5FADDB6D7D6DB22BULL, 0x57A433CFEBF9E3C2ULL, 0x4FBE0A28504511F9ULL, 0x47B7E28AC6D14010ULL,
+    0x3FC53CF3939E7AC7ULL, 0x37CCD451050A2B2EULL, 0x2FD6EDB6BEB6D915ULL, 0x27DF0514282288FCULL,
+    0x1FE29E79C9CF3D63ULL, 0x17EB76DB5F5B6C8AULL, 0x0FF14F3CE4E79EB1ULL, 0x07F8A79E7273CF58ULL,
+};
+
+// CRC-64/REDIS
+static const uint64_t crc_catalog_table_108[256] = {
+    0x0000000000000000ULL, 0x7AD870C830358979ULL, 0xF5B0E190606B12F2ULL, 0x8F689158505E9B8BULL,
+    0xC038E5739841B68FULL, 0xBAE095BBA8743FF6ULL, 0x358804E3F82AA47DULL, 0x4F50742BC81F2D04ULL,
+    0xAB28ECB46814FE75ULL, 0xD1F09C7C5821770CULL, 0x5E980D24087FEC87ULL, 0x24407DEC384A65FEULL,
+    0x6B1009C7F05548FAULL, 0x11C8790FC060C183ULL, 0x9EA0E857903E5A08ULL, 0xE478989FA00BD371ULL,
+    0x7D08FF3B88BE6F81ULL, 0x07D08FF3B88BE6F8ULL, 0x88B81EABE8D57D73ULL, 0xF2606E63D8E0F40AULL,
+    0xBD301A4810FFD90EULL, 0xC7E86A8020CA5077ULL, 0x4880FBD87094CBFCULL, 0x32588B1040A14285ULL,
+    0xD620138FE0AA91F4ULL, 0xACF86347D09F188DULL, 0x2390F21F80C18306ULL, 0x594882D7B0F40A7FULL,
+    0x1618F6FC78EB277BULL, 0x6CC0863448DEAE02ULL, 0xE3A8176C18803589ULL, 0x997067A428B5BCF0ULL,
+    0xFA11FE77117CDF02ULL, 0x80C98EBF2149567BULL, 0x0FA11FE77117CDF0ULL, 0x75796F2F41224489ULL,
+    0x3A291B04893D698DULL, 0x40F16BCCB908E0F4ULL, 0xCF99FA94E9567B7FULL, 0xB5418A5CD963F206ULL,
+    0x513912C379682177ULL, 0x2BE1620B495DA80EULL, 0xA489F35319033385ULL, 0xDE51839B2936BAFCULL,
+    0x9101F7B0E12997F8ULL, 0xEBD98778D11C1E81ULL, 0x64B116208142850AULL, 0x1E6966E8B1770C73ULL,
+    0x8719014C99C2B083ULL, 0xFDC17184A9F739FAULL, 0x72A9E0DCF9A9A271ULL, 0x08719014C99C2B08ULL,
+    0x4721E43F0183060CULL, 0x3DF994F731B68F75ULL, 0xB29105AF61E814FEULL, 0xC849756751DD9D87ULL,
+    0x2C31EDF8F1D64EF6ULL, 0x56E99D30C1E3C78FULL, 0xD9810C6891BD5C04ULL, 0xA3597CA0A188D57DULL,
+    0xEC09088B6997F879ULL, 0x96D1784359A27100ULL, 0x19B9E91B09FCEA8BULL, 0x636199D339C963F2ULL,
+    0xDF7ADABD7A6E2D6FULL, 0xA5A2AA754A5BA416ULL, 0x2ACA3B2D1A053F9DULL, 0x50124BE52A30B6E4ULL,
+    0x1F423FCEE22F9BE0ULL, 0x659A4F06D21A1299ULL, 0xEAF2DE5E82448912ULL, 0x902AAE96B271006BULL,
+    0x74523609127AD31AULL, 0x0E8A46C1224F5A63ULL, 0x81E2D7997211C1E8ULL, 0xFB3AA75142244891ULL,
+    0xB46AD37A8A3B6595ULL, 0xCEB2A3B2BA0EECECULL, 0x41DA32EAEA507767ULL, 0x3B024222DA65FE1EULL,
+    0xA2722586F2D042EEULL, 0xD8AA554EC2E5CB97ULL, 0x57C2C41692BB501CULL, 0x2D1AB4DEA28ED965ULL,
+    0x624AC0F56A91F461ULL, 0x1892B03D5AA47D18ULL, 0x97FA21650AFAE693ULL, 0xED2251AD3ACF6FEAULL,
+    0x095AC9329AC4BC9BULL, 0x7382B9FAAAF135E2ULL, 0xFCEA28A2FAAFAE69ULL, 0x8632586ACA9A2710ULL,
+    0xC9622C4102850A14ULL, 0xB3BA5C8932B0836DULL, 0x3CD2CDD162EE18E6ULL, 0x460ABD1952DB919FULL,
+    0x256B24CA6B12F26DULL, 0x5FB354025B277B14ULL, 0xD0DBC55A0B79E09FULL, 0xAA03B5923B4C69E6ULL,
+    0xE553C1B9F35344E2ULL, 0x9F8BB171C366CD9BULL, 0x10E3202993385610ULL, 0x6A3B50E1A30DDF69ULL,
+    0x8E43C87E03060C18ULL, 0xF49BB8B633338561ULL, 0x7BF329EE636D1EEAULL, 0x012B592653589793ULL,
+    0x4E7B2D0D9B47BA97ULL, 0x34A35DC5AB7233EEULL, 0xBBCBCC9DFB2CA865ULL, 0xC113BC55CB19211CULL,
+    0x5863DBF1E3AC9DECULL, 0x22BBAB39D3991495ULL, 0xADD33A6183C78F1EULL, 0xD70B4AA9B3F20667ULL,
+    0x985B3E827BED2B63ULL, 0xE2834E4A4BD8A21AULL, 0x6DEBDF121B863991ULL, 0x1733AFDA2BB3B0E8ULL,
+    0xF34B37458BB86399ULL, 0x8993478DBB8DEAE0ULL, 0x06FBD6D5EBD3716BULL, 0x7C23A61DDBE6F812ULL,
+    0x3373D23613F9D516ULL, 0x49ABA2FE23CC5C6FULL, 0xC6C333A67392C7E4ULL, 0xBC1B436E43A74E9DULL,
+    0x95AC9329AC4BC9B5ULL, 0xEF74E3E19C7E40CCULL, 0x601C72B9CC20DB47ULL, 0x1AC40271FC15523EULL,
+    0x5594765A340A7F3AULL, 0x2F4C0692043FF643ULL, 0xA02497CA54616DC8ULL, 0xDAFCE7026454E4B1ULL,
+    0x3E847F9DC45F37C0ULL, 0x445C0F55F46ABEB9ULL, 0xCB349E0DA4342532ULL, 0xB1ECEEC59401AC4BULL,
+    0xFEBC9AEE5C1E814FULL, 0x8464EA266C2B0836ULL, 0x0B0C7B7E3C7593BDULL, 0x71D40BB60C401AC4ULL,
+    0xE8A46C1224F5A634ULL, 0x927C1CDA14C02F4DULL, 0x1D148D82449EB4C6ULL, 0x67CCFD4A74AB3DBFULL,
+    0x289C8961BCB410BBULL, 0x5244F9A98C8199C2ULL, 0xDD2C68F1DCDF0249ULL, 0xA7F41839ECEA8B30ULL,
+    0x438C80A64CE15841ULL, 0x3954F06E7CD4D138ULL, 0xB63C61362C8A4AB3ULL, 0xCCE411FE1CBFC3CAULL,
+    0x83B465D5D4A0EECEULL, 0xF96C151DE49567B7ULL, 0x76048445B4CBFC3CULL, 0x0CDCF48D84FE7545ULL,
+    0x6FBD6D5EBD3716B7ULL, 0x15651D968D029FCEULL, 0x9A0D8CCEDD5C0445ULL, 0xE0D5FC06ED698D3CULL,
+    0xAF85882D2576A038ULL, 0xD55DF8E515432941ULL, 0x5A3569BD451DB2CAULL, 0x20ED197575283BB3ULL,
+    0xC49581EAD523E8C2ULL, 0xBE4DF122E51661BBULL, 0x3125607AB548FA30ULL, 0x4BFD10B2857D7349ULL,
+    0x04AD64994D625E4DULL, 0x7E7514517D57D734ULL, 0xF11D85092D094CBFULL, 0x8BC5F5C11D3CC5C6ULL,
+    0x12B5926535897936ULL, 0x686DE2AD05BCF04FULL, 0xE70573F555E26BC4ULL, 0x9DDD033D65D7E2BDULL,
+    0xD28D7716ADC8CFB9ULL, 0xA85507DE9DFD46C0ULL, 0x273D9686CDA3DD4BULL, 0x5DE5E64EFD965432ULL,
+    0xB99D7ED15D9D8743ULL, 0xC3450E196DA80E3AULL, 0x4C2D9F413DF695B1ULL, 0x36F5EF890DC31CC8ULL,
+    0x79A59BA2C5DC31CCULL, 0x037DEB6AF5E9B8B5ULL, 0x8C157A32A5B7233EULL, 0xF6CD0AFA9582AA47ULL,
+    0x4AD64994D625E4DAULL, 0x300E395CE6106DA3ULL, 0xBF66A804B64EF628ULL, 0xC5BED8CC867B7F51ULL,
+    0x8AEEACE74E645255ULL, 0xF036DC2F7E51DB2CULL, 0x7F5E4D772E0F40A7ULL, 0x05863DBF1E3AC9DEULL,
+    0xE1FEA520BE311AAFULL, 0x9B26D5E88E0493D6ULL, 0x144E44B0DE5A085DULL, 0x6E963478EE6F8124ULL,
+    0x21C640532670AC20ULL, 0x5B1E309B16452559ULL, 0xD476A1C3461BBED2ULL, 0xAEAED10B762E37ABULL,
+    0x37DEB6AF5E9B8B5BULL, 0x4D06C6676EAE0222ULL, 0xC26E573F3EF099A9ULL, 0xB8B627F70EC510D0ULL,
+    0xF7E653DCC6DA3DD4ULL, 0x8D3E2314F6EFB4ADULL, 0x0256B24CA6B12F26ULL, 0x788EC2849684A65FULL,
+    0x9CF65A1B368F752EULL, 0xE62E2AD306BAFC57ULL, 0x6946BB8B56E467DCULL, 0x139ECB4366D1EEA5ULL,
+    0x5CCEBF68AECEC3A1ULL, 0x2616CFA09EFB4AD8ULL, 0xA97E5EF8CEA5D153ULL, 0xD3A62E30FE90582AULL,
+    0xB0C7B7E3C7593BD8ULL, 0xCA1FC72BF76CB2A1ULL, 0x45775673A732292AULL, 0x3FAF26BB9707A053ULL,
+    0x70FF52905F188D57ULL, 0x0A2722586F2D042EULL, 0x854FB3003F739FA5ULL, 0xFF97C3C80F4616DCULL,
+    0x1BEF5B57AF4DC5ADULL, 0x61372B9F9F784CD4ULL, 0xEE5FBAC7CF26D75FULL, 0x9487CA0FFF135E26ULL,
+    0xDBD7BE24370C7322ULL, 0xA10FCEEC0739FA5BULL, 0x2E675FB4576761D0ULL, 0x54BF2F7C6752E8A9ULL,
+    0xCDCF48D84FE75459ULL, 0xB71738107FD2DD20ULL, 0x387FA9482F8C46ABULL, 0x42A7D9801FB9CFD2ULL,
+    0x0DF7ADABD7A6E2D6ULL, 0x772FDD63E7936BAFULL, 0xF8474C3BB7CDF024ULL, 0x829F3CF387F8795DULL,
+    0x66E7A46C27F3AA2CULL, 0x1C3FD4A417C62355ULL, 0x935745FC4798B8DEULL, 0xE98F353477AD31A7ULL,
+    0xA6DF411FBFB21CA3ULL, 0xDC0731D78F8795DAULL, 0x536FA08FDFD90E51ULL, 0x29B7D047EFEC8728ULL,
+};
+
+// CRC-64/XZ
+static const uint64_t crc_catalog_table_110[256] = {
+    0x0000000000000000ULL, 0xB32E4CBE03A75F6FULL, 0xF4843657A840A05BULL, 0x47AA7AE9ABE7FF34ULL,
+    0x7BD0C384FF8F5E33ULL, 0xC8FE8F3AFC28015CULL, 0x8F54F5D357CFFE68ULL, 0x3C7AB96D5468A107ULL,
+    0xF7A18709FF1EBC66ULL, 0x448FCBB7FCB9E309ULL, 0x0325B15E575E1C3DULL, 0xB00BFDE054F94352ULL,
+    0x8C71448D0091E255ULL, 0x3F5F08330336BD3AULL, 0x78F572DAA8D1420EULL, 0xCBDB3E64AB761D61ULL,
+    0x7D9BA13851336649ULL, 0xCEB5ED8652943926ULL, 0x891F976FF973C612ULL, 0x3A31DBD1FAD4997DULL,
+    0x064B62BCAEBC387AULL, 0xB5652E02AD1B6715ULL, 0xF2CF54EB06FC9821ULL, 0x41E11855055BC74EULL,
+    0x8A3A2631AE2DDA2FULL, 0x39146A8FAD8A8540ULL, 0x7EBE1066066D7A74ULL, 0xCD905CD805CA251BULL,
+    0xF1EAE5B551A2841CULL, 0x42C4A90B5205DB73ULL, 0x056ED3E2F9E22447ULL, 0xB6409F5CFA457B28ULL,
+    0xFB374270A266CC92ULL, 0x48190ECEA1C193FDULL, 0x0FB374270A266CC9ULL, 0xBC9D3899098133A6ULL,
+    0x80E781F45DE992A1ULL, 0x33C9CD4A5E4ECDCEULL, 0x7463B7A3F5A932FAULL, 0xC74DFB1DF60E6D95ULL,
+    0x0C96C5795D7870F4ULL, 0xBFB889C75EDF2F9BULL, 0xF812F32EF538D0AFULL, 0x4B3CBF90F69F8FC0ULL,
+    0x774606FDA2F72EC7ULL, 0xC4684A43A15071A8ULL, 0x83C230AA0AB78E9CULL, 0x30EC7C140910D1F3ULL,
+    0x86ACE348F355AADBULL, 0x3582AFF6F0F2F5B4ULL, 0x7228D51F5B150A80ULL, 0xC10699A158B255EFULL,
+    0xFD7C20CC0CDAF4E8ULL, 0x4E526C720F7DAB87ULL, 0x09F8169BA49A54B3ULL, 0xBAD65A25A73D0BDCULL,
+    0x710D64410C4B16BDULL, 0xC22328FF0FEC49D2ULL, 0x85895216A40BB6E6ULL, 0x36A71EA8A7ACE989ULL,
+    0x0ADDA7C5F3C4488EULL, 0xB9F3EB7BF06317E1ULL, 0xFE5991925B84E8D5ULL, 0x4D77DD2C5823B7BAULL,
+    0x64B62BCAEBC387A1ULL, 0xD7986774E864D8CEULL, 0x90321D9D438327FAULL, 0x231C512340247895ULL,
+    0x1F66E84E144CD992ULL, 0xAC48A4F017EB86FDULL, 0xEBE2DE19BC0C79C9ULL, 0x58CC92A7BFAB26A6ULL,
+    0x9317ACC314DD3BC7ULL, 0x2039E07D177A64A8ULL, 0x67939A94BC9D9B9CULL, 0xD4BDD62ABF3AC4F3ULL,
+    0xE8C76F47EB5265F4ULL, 0x5BE923F9E8F53A9BULL, 0x1C4359104312C5AFULL, 0xAF6D15AE40B59AC0ULL,
+    0x192D8AF2BAF0E1E8ULL, 0xAA03C64CB957BE87ULL, 0xEDA9BCA512B041B3ULL, 0x5E87F01B11171EDCULL,
+    0x62FD4976457FBFDBULL, 0xD1D305C846D8E0B4ULL, 0x96797F21ED3F1F80ULL, 0x2557339FEE9840EFULL,
+    0xEE8C0DFB45EE5D8EULL, 0x5DA24145464902E1ULL, 0x1A083BACEDAEFDD5ULL, 0xA9267712EE09A2BAULL,
+    0x955CCE7FBA6103BDULL, 0x267282C1B9C65CD2ULL, 0x61D8F8281221A3E6ULL, 0xD2F6B4961186FC89ULL,
+    0x9F8169BA49A54B33ULL, 0x2CAF25044A02145CULL, 0x6B055FEDE1E5EB68ULL, 0xD82B1353E242B407ULL,
+    0xE451AA3EB62A1500ULL, 0x577FE680B58D4A6FULL, 0x10D59C691E6AB55BULL, 0xA3FBD0D71DCDEA34ULL,
+    0x6820EEB3B6BBF755ULL, 0xDB0EA20DB51CA83AULL, 0x9CA4D8E41EFB570EULL, 0x2F8A945A1D5C0861ULL,
+    0x13F02D374934A966ULL, 0xA0DE61894A93F609ULL, 0xE7741B60E174093DULL, 0x545A57DEE2D35652ULL,
+    0xE21AC88218962D7AULL, 0x5134843C1B317215ULL, 0x169EFED5B0D68D21ULL, 0xA5B0B26BB371D24EULL,
+    0x99CA0B06E7197349ULL, 0x2AE447B8E4BE2C26ULL, 0x6D4E3D514F59D312ULL, 0xDE6071EF4CFE8C7DULL,
+    0x15BB4F8BE788911CULL, 0xA6950335E42FCE73ULL, 0xE13F79DC4FC83147ULL, 0x521135624C6F6E28ULL,
+    0x6E6B8C0F1807CF2FULL, 0xDD45C0B11BA09040ULL, 0x9AEFBA58B0476F74ULL, 0x29C1F6E6B3E0301BULL,
+    0xC96C5795D7870F42ULL, 0x7A421B2BD420502DULL, 0x3DE861C27FC7AF19ULL, 0x8EC62D7C7C60F076ULL,
+    0xB2BC941128085171ULL, 0x0192D8AF2BAF0E1EULL, 0x4638A2468048F12AULL, 0xF516EEF883EFAE45ULL,
+    0x3ECDD09C2899B324ULL, 0x8DE39C222B3EEC4BULL, 0xCA49E6CB80D9137FULL, 0x7967AA75837E4C10ULL,
+    0x451D1318D716ED17ULL, 0xF6335FA6D4B1B278ULL, 0xB199254F7F564D4CULL, 0x02B769F17CF11223ULL,
+    0xB4F7F6AD86B4690BULL, 0x07D9BA1385133664ULL, 0x4073C0FA2EF4C950ULL, 0xF35D8C442D53963FULL,
+    0xCF273529793B3738ULL, 0x7C0979977A9C6857ULL, 0x3BA3037ED17B9763ULL, 0x888D4FC0D2DCC80CULL,
+    0x435671A479AAD56DULL, 0xF0783D1A7A0D8A02ULL, 0xB7D247F3D1EA7536ULL, 0x04FC0B4DD24D2A59ULL,
+    0x3886B22086258B5EULL, 0x8BA8FE9E8582D431ULL, 0xCC0284772E652B05ULL, 0x7F2CC8C92DC2746AULL,
+    0x325B15E575E1C3D0ULL, 0x8175595B76469CBFULL, 0xC6DF23B2DDA1638BULL, 0x75F16F0CDE063CE4ULL,
+    0x498BD6618A6E9DE3ULL, 0xFAA59ADF89C9C28CULL, 0xBD0FE036222E3DB8ULL, 0x0E21AC88218962D7ULL,
+    0xC5FA92EC8AFF7FB6ULL, 0x76D4DE52895820D9ULL, 0x317EA4BB22BFDFEDULL, 0x8250E80521188082ULL,
+    0xBE2A516875702185ULL, 0x0D041DD676D77EEAULL, 0x4AAE673FDD3081DEULL, 0xF9802B81DE97DEB1ULL,
+    0x4FC0B4DD24D2A599ULL, 0xFCEEF8632775FAF6ULL, 0xBB44828A8C9205C2ULL, 0x086ACE348F355AADULL,
+    0x34107759DB5DFBAAULL, 0x873E3BE7D8FAA4C5ULL, 0xC094410E731D5BF1ULL, 0x73BA0DB070BA049EULL,
+    0xB86133D4DBCC19FFULL, 0x0B4F7F6AD86B4690ULL, 0x4CE50583738CB9A4ULL, 0xFFCB493D702BE6CBULL,
+    0xC3B1F050244347CCULL, 0x709FBCEE27E418A3ULL, 0x3735C6078C03E797ULL, 0x841B8AB98FA4B8F8ULL,
+    0xADDA7C5F3C4488E3ULL, 0x1EF430E13FE3D78CULL, 0x595E4A08940428B8ULL, 0xEA7006B697A377D7ULL,
+    0xD60ABFDBC3CBD6D0ULL, 0x6524F365C06C89BFULL, 0x228E898C6B8B768BULL, 0x91A0C532682C29E4ULL,
+    0x5A7BFB56C35A3485ULL, 0xE955B7E8C0FD6BEAULL, 0xAEFFCD016B1A94DEULL, 0x1DD181BF68BDCBB1ULL,
+    0x21AB38D23CD56AB6ULL, 0x9285746C3F7235D9ULL, 0xD52F0E859495CAEDULL, 0x6601423B97329582ULL,
+    0xD041DD676D77EEAAULL, 0x636F91D96ED0B1C5ULL, 0x24C5EB30C5374EF1ULL, 0x97EBA78EC690119EULL,
+    0xAB911EE392F8B099ULL, 0x18BF525D915FEFF6ULL, 0x5F1528B43AB810C2ULL, 0xEC3B640A391F4FADULL,
+    0x27E05A6E926952CCULL, 0x94CE16D091CE0DA3ULL, 0xD3646C393A29F297ULL, 0x604A2087398EADF8ULL,
+    0x5C3099EA6DE60CFFULL, 0xEF1ED5546E415390ULL, 0xA8B4AFBDC5A6ACA4ULL, 0x1B9AE303C601F3CBULL,
+    0x56ED3E2F9E224471ULL, 0xE5C372919D851B1EULL, 0xA26908783662E42AULL, 0x114744C635C5BB45ULL,
+    0x2D3DFDAB61AD1A42ULL, 0x9E13B115620A452DULL, 0xD9B9CBFCC9EDBA19ULL, 0x6A978742CA4AE576ULL,
+    0xA14CB926613CF817ULL, 0x1262F598629BA778ULL, 0x55C88F71C97C584CULL, 0xE6E6C3CFCADB0723ULL,
+    0xDA9C7AA29EB3A624ULL, 0x69B2361C9D14F94BULL, 0x2E184CF536F3067FULL, 0x9D36004B35545910ULL,
+    0x2B769F17CF112238ULL, 0x9858D3A9CCB67D57ULL, 0xDFF2A94067518263ULL, 0x6CDCE5FE64F6DD0CULL,
+    0x50A65C93309E7C0BULL, 0xE388102D33392364ULL, 0xA4226AC498DEDC50ULL, 0x170C267A9B79833FULL,
+    0xDCD7181E300F9E5EULL, 0x6FF954A033A8C131ULL, 0x28532E49984F3E05ULL, 0x9B7D62F79BE8616AULL,
+    0xA707DB9ACF80C06DULL, 0x14299724CC279F02ULL, 0x5383EDCD67C06036ULL, 0xE0ADA17364673F59ULL,
+};
+
+#define CRC_CATALOG_NUM     111
+
+static const void *const crc_catalog_tables[CRC_CATALOG_NUM] = {
+    crc_catalog_table_0, crc_catalog_table_1, crc_catalog_table_2, crc_catalog_table_3, crc_catalog_table_4, crc_catalog_table_5,
+    crc_catalog_table_6, crc_catalog_table_7, crc_catalog_table_8, crc_catalog_table_9, crc_catalog_table_10, crc_catalog_table_11,
+    crc_catalog_table_12, crc_catalog_table_13, crc_catalog_table_14, crc_catalog_table_15, crc_catalog_table_16, crc_catalog_table_17,
+    crc_catalog_table_18, crc_catalog_table_19, crc_catalog_table_20, crc_catalog_table_21, crc_catalog_table_20, crc_catalog_table_23,
+    crc_catalog_table_20, crc_catalog_table_17, crc_catalog_table_26, crc_catalog_table_20, crc_catalog_table_28, crc_catalog_table_15,
+    crc_catalog_table_30, crc_catalog_table_20, crc_catalog_table_23, crc_catalog_table_33, crc_catalog_table_34, crc_catalog_table_35,
+    crc_catalog_table_36, crc_catalog_table_37, crc_catalog_table_38, crc_catalog_table_39, crc_catalog_table_40, crc_catalog_table_41,
+    crc_catalog_table_42, crc_catalog_table_41, crc_catalog_table_44, crc_catalog_table_45, crc_catalog_table_46, crc_catalog_table_47,
+    crc_catalog_table_48, crc_catalog_table_49, crc_catalog_table_50, crc_catalog_table_51, crc_catalog_table_51, crc_catalog_table_53,
+    crc_catalog_table_53, crc_catalog_table_55, crc_catalog_table_56, crc_catalog_table_57, crc_catalog_table_57, crc_catalog_table_57,
+    crc_catalog_table_60, crc_catalog_table_60, crc_catalog_table_60, crc_catalog_table_63, crc_catalog_table_64, crc_catalog_table_49,
+    crc_catalog_table_60, crc_catalog_table_49, crc_catalog_table_68, crc_catalog_table_64, crc_catalog_table_70, crc_catalog_table_71,
+    crc_catalog_table_60, crc_catalog_table_57, crc_catalog_table_74, crc_catalog_table_75, crc_catalog_table_60, crc_catalog_table_51,
+    crc_catalog_table_49, crc_catalog_table_57, crc_catalog_table_80, crc_catalog_table_81, crc_catalog_table_82, crc_catalog_table_83,
+    crc_catalog_table_83, crc_catalog_table_85, crc_catalog_table_86, crc_catalog_table_87, crc_catalog_table_86, crc_catalog_table_87,
+    crc_catalog_table_90, crc_catalog_table_91, crc_catalog_table_92, crc_catalog_table_93, crc_catalog_table_94, crc_catalog_table_95,
+    crc_catalog_table_96, crc_catalog_table_95, crc_catalog_table_98, crc_catalog_table_99, crc_catalog_table_99, crc_catalog_table_101,
+    crc_catalog_table_95, crc_catalog_table_103, crc_catalog_table_104, crc_catalog_table_105, crc_catalog_table_106, crc_catalog_table_107,
+    crc_catalog_table_108, crc_catalog_table_105, crc_catalog_table_110,
+};
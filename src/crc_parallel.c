@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: multi-threaded crc of one large buffer
+// @file:       crc_parallel.c
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+// @Note:   The buffer is cut into one slice per thread, each slice runs
+//          through crc_util_model_run on a persistent worker pool and the
+//          slice results are merged by crc_util_model_combine.
+// ------------------------------------------------------------------------
+
+#include <stddef.h> // for: NULL
+#ifndef _MSC_VER
+#include <unistd.h> // for: sysconf
+#endif /* _MSC_VER */
+/* user headers */
+#include "elog.h"
+#include "crc_utils.h"
+#include "crc_thread.h"
+
+// Max number of threads (and slices) per call.
+#define CRC_UTIL_THREAD_MAX     64
+// Min slice length, shorter input is not worth waking up the pool.
+#define CRC_UTIL_SLICE_LEN_MIN  (256 * 1024)
+
+typedef struct _crc_job_s {
+    crc_model_t     model;
+    const uint8_t   *p;
+    size_t          len;
+    size_t          slice;  // slice length, the last one may be shorter
+    int             nslice;
+    int             next;   // next slice to take
+    int             done;   // number of finished slices
+    crc_t           crc[CRC_UTIL_THREAD_MAX];
+} crc_job_s;
+
+// Process-wide worker pool, serves one job at a time.
+static struct {
+    crc_mutex_t lock;
+    crc_cond_t  wake;   // new job posted
+    crc_cond_t  idle;   // job finished
+    int         nworker;
+    crc_job_s   *job;
+} crc_pool = { CRC_MUTEX_INITIALIZER, CRC_COND_INITIALIZER, CRC_COND_INITIALIZER, 0, NULL };
+
+// Run slices of current job until none left, called with pool lock held.
+static void crc_util_job_work(crc_job_s *job) {
+    int i;
+    size_t off, len;
+    while (job->next < job->nslice) {
+        i = job->next++;
+        crc_mutex_unlock(&crc_pool.lock);
+        off = (size_t)i * job->slice;
+        len = (job->len - off < job->slice) ? job->len - off : job->slice;
+        job->crc[i] = crc_util_model_run(job->model, job->p + off, len);
+        crc_mutex_lock(&crc_pool.lock);
+        if (++job->done == job->nslice) crc_cond_broadcast(&crc_pool.idle);
+    }
+}
+
+#ifdef _MSC_VER
+static DWORD WINAPI crc_util_worker(LPVOID arg) {
+#else //! _MSC_VER
+static void *crc_util_worker(void *arg) {
+#endif /* _MSC_VER */
+    (void)arg;
+    crc_mutex_lock(&crc_pool.lock);
+    for (;;) {
+        while (!crc_pool.job || crc_pool.job->next >= crc_pool.job->nslice) {
+            crc_cond_wait(&crc_pool.wake, &crc_pool.lock);
+        }
+        crc_util_job_work(crc_pool.job);
+    }
+    return 0;
+}
+
+// Grow pool to 'n' workers, called with pool lock held.
+static void crc_util_pool_grow(int n) {
+    for (; crc_pool.nworker < n; crc_pool.nworker++) {
+#ifdef _MSC_VER
+        HANDLE h = CreateThread(NULL, 0, crc_util_worker, NULL, 0, NULL);
+        if (NULL == h) break;
+        CloseHandle(h);
+#else //! _MSC_VER
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, crc_util_worker, NULL)) break;
+        pthread_detach(tid);
+#endif /* _MSC_VER */
+    }
+    if (crc_pool.nworker < n) {
+        log_warn("[%s] only %d of %d workers started\n", __FUNCTION__, crc_pool.nworker, n);
+    }
+}
+
+static int crc_util_cpu_count(void) {
+#ifdef _MSC_VER
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else //! _MSC_VER
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+#endif /* _MSC_VER */
+}
+
+crc_t crc_util_model_run_parallel(const crc_model_t model, const uint8_t *p, size_t len, int nthreads) {
+    if (!model || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    crc_job_s job;
+    crc_t crc;
+    int i;
+    if (nthreads <= 0) nthreads = crc_util_cpu_count();
+    if (nthreads > CRC_UTIL_THREAD_MAX) nthreads = CRC_UTIL_THREAD_MAX;
+    if ((size_t)nthreads > len / CRC_UTIL_SLICE_LEN_MIN) nthreads = (int)(len / CRC_UTIL_SLICE_LEN_MIN);
+    if (nthreads <= 1) return crc_util_model_run(model, p, len);
+
+    job.model = model;
+    job.p = p;
+    job.len = len;
+    // round slice up to 4KB, so that slices start page aligned
+    job.slice = ((len + nthreads - 1) / nthreads + 4095) & ~(size_t)4095;
+    job.nslice = (int)((len + job.slice - 1) / job.slice);
+    job.next = job.done = 0;
+
+    crc_mutex_lock(&crc_pool.lock);
+    while (crc_pool.job) crc_cond_wait(&crc_pool.idle, &crc_pool.lock);
+    crc_util_pool_grow(nthreads - 1);
+    crc_pool.job = &job;
+    crc_cond_broadcast(&crc_pool.wake);
+    // caller thread takes slices as well
+    crc_util_job_work(&job);
+    while (job.done < job.nslice) crc_cond_wait(&crc_pool.idle, &crc_pool.lock);
+    crc_pool.job = NULL;
+    crc_cond_broadcast(&crc_pool.idle);
+    crc_mutex_unlock(&crc_pool.lock);
+
+    crc = job.crc[0];
+    for (i = 1; i < job.nslice; i++) {
+        crc = crc_util_model_combine(model, crc, job.crc[i],
+            (i == job.nslice - 1) ? len - (size_t)i * job.slice : job.slice);
+    }
+    return crc;
+}
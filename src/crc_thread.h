@@ -0,0 +1,37 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit: mutex and condition variable (private)
+// @file:       crc_thread.h
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+#ifndef _CRC_THREAD_H_
+#define _CRC_THREAD_H_
+
+#ifdef _MSC_VER
+#include <Windows.h>// for: CreateThread, SRWLOCK, CONDITION_VARIABLE
+#else //! _MSC_VER
+#include <pthread.h>// for: pthread_create, pthread_mutex_t, pthread_cond_t
+#endif /* _MSC_VER */
+
+#ifdef _MSC_VER
+typedef SRWLOCK crc_mutex_t;
+typedef CONDITION_VARIABLE crc_cond_t;
+#define CRC_MUTEX_INITIALIZER   SRWLOCK_INIT
+#define CRC_COND_INITIALIZER    CONDITION_VARIABLE_INIT
+#define crc_mutex_lock(m)       AcquireSRWLockExclusive(m)
+#define crc_mutex_unlock(m)     ReleaseSRWLockExclusive(m)
+#define crc_cond_wait(c, m)     SleepConditionVariableSRW(c, m, INFINITE, 0)
+#define crc_cond_broadcast(c)   WakeAllConditionVariable(c)
+#else //! _MSC_VER
+typedef pthread_mutex_t crc_mutex_t;
+typedef pthread_cond_t crc_cond_t;
+#define CRC_MUTEX_INITIALIZER   PTHREAD_MUTEX_INITIALIZER
+#define CRC_COND_INITIALIZER    PTHREAD_COND_INITIALIZER
+#define crc_mutex_lock(m)       pthread_mutex_lock(m)
+#define crc_mutex_unlock(m)     pthread_mutex_unlock(m)
+#define crc_cond_wait(c, m)     pthread_cond_wait(c, m)
+#define crc_cond_broadcast(c)   pthread_cond_broadcast(c)
+#endif /* _MSC_VER */
+
+#endif // !_CRC_THREAD_H_
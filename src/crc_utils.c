@@ -7,33 +7,192 @@
 
 #include <stdio.h>  // for: fprintf
 #include <stdlib.h> // for: calloc
-#ifdef _DEBUG
-#include <string.h> // for: strlen
-#endif /* _DEBUG */
+#include <string.h> // for: memcpy, strlen
+#include <time.h>   // for: clock_gettime
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CRC_UTIL_X86
+#include <immintrin.h>  // for: _mm_clmulepi64_si128, _mm_shuffle_epi8
+#ifdef _MSC_VER
+#include <intrin.h>     // for: __cpuid
+#else //! _MSC_VER
+#include <cpuid.h>      // for: __get_cpuid
+#endif /* _MSC_VER */
+#endif /* x86 */
 /* user headers */
 #include "elog.h"
 #include "crc_utils.h"
+#include "crc_catalog.h"
+#include "crc_thread.h"
 
 #ifndef _DEBUG
 #undef log_verbose
 #define log_verbose(...)
 #endif /* _DEBUG */
 
+#if defined(_MSC_VER)
+#include <intrin.h>     // for: _InterlockedExchangeAdd
+#define CRC_UTIL_ATOMIC_ADD(v, n)   _InterlockedExchangeAdd(v, n)
+#define CRC_UTIL_ATOMIC_CAS(v, o, n) ((o) == _InterlockedCompareExchange(v, n, o))
+// volatile read has acquire semantics on msvc
+#define CRC_UTIL_ATOMIC_GET(v)      (*(v))
+#else //! _MSC_VER
+#define CRC_UTIL_ATOMIC_ADD(v, n)   __sync_fetch_and_add(v, n)
+#define CRC_UTIL_ATOMIC_CAS(v, o, n) __sync_bool_compare_and_swap(v, o, n)
+#define CRC_UTIL_ATOMIC_GET(v)      __atomic_load_n(v, __ATOMIC_ACQUIRE)
+#endif /* _MSC_VER */
+
+// Input length classes of crc_util_model_tune: [1, 4), [4, 16), ... [16K, inf).
+#define CRC_UTIL_TUNE_NUM       8
+
+// Number of distinct lookup tables in use by models of crc_util_model_init
+// (catalogue ones not counted), from which the nibble engine is preferred,
+// since their 256-entry tables won't fit in L1 cache together any more.
+#define CRC_UTIL_NIBBLE_LIVE    32
+static volatile long crc_util_live = 0;
+
+#if defined(CRC_UTIL_X86) && defined(__GNUC__)
+#define CRC_UTIL_TARGET(isa)    __attribute__((target(isa)))
+#else
+#define CRC_UTIL_TARGET(isa)
+#endif
+
+// Folding constants for the carry-less multiply engine. All of them are taken
+// modulo G = x^64 + poly * x^(64 - width), i.e. the model polynom scaled up to
+// 64 bits, so that one kernel serves every width. Each kx pair multiplies the
+// {low, high} qword of a 128-bit accumulator to move it x bits forward; for
+// refin models the pairs are bit reflected (and so swapped) and use x^(x-1)
+// to make up for the one bit shift of a reflected carry-less multiply.
+typedef struct _crc_fold_s {
+    uint64_t k512[2];
+    uint64_t k384[2];
+    uint64_t k256[2];
+    uint64_t k128[2];
+    uint64_t x128;  // x^128 mod G
+    uint64_t mu;    // floor(x^128 / G) without the leading x^64
+    uint64_t poly;  // G without the leading x^64
+} crc_fold_s;
+
+// Lookup tables are cached process-wide: models with same width, poly and
+// refin share one (read-only) table of each kind, released with the last one.
+enum {
+    CRC_UTIL_TABLE_SLICE = 0,   // byte and slicing tables
+    CRC_UTIL_TABLE_CRC32C,      // zero shift tables of the crc32c engine
+};
+
+typedef struct _crc_table_s {
+    struct _crc_table_s *next;
+    int kind;
+    uint8_t width;
+    uint8_t refin;
+    crc_t poly;
+    long ref;
+    long users;     // references of models counted in crc_util_live
+    void *data;
+} crc_table_s;
+
+static crc_table_s *crc_util_tables = NULL;
+static crc_mutex_t crc_util_tables_lock = CRC_MUTEX_INITIALIZER;
+
 typedef struct _crc_model_s {
     crc_model_param_s param;
 
     // Hard coded lookup table size as 2^8. 
-    crc_t *table;
+    // Tables are made for polynom order rounded up to whole bytes, i.e. for
+    // poly << shift, so non-direct register is kept left-aligned by shift.
+    // Entries are 'reg' bits wide (16, 32 or 64, the least that holds order).
+    // table[k][i] is the crc of byte i followed by k zero bytes, k < table_num:
+    // CRC_UTIL_SLICE_NUM if generated, 1 if precomputed (catalogue model)
+    // until crc_util_model_lazy has made the slicing tables.
+    void *table;
+    uint8_t table_num;
+    uint8_t reg;
+    // Half byte table: table_nibble[i] is the crc of nibble i.
+    union {
+        uint16_t r16[16];
+        uint32_t r32[16];
+        uint64_t r64[16];
+    } table_nibble;
+    int builtin;    // catalogue model of crc_util_model_get, never freed
+    // Catalogue model: 0 byte table only, 1 making the other tables, 2 done.
+    volatile long lazy;
+    uint8_t order;
+    uint8_t shift;
+    crc_t order_mask;
+    crc_engine_e engine;
+    // Engine per input length class of crc_util_model_tune, 0 (auto) if not tuned.
+    uint8_t tune[CRC_UTIL_TUNE_NUM];
+    // Carry-less multiply folding, only set up if the cpu supports it.
+    int fold_enable;
+    crc_fold_s fold;
+    // Zero shift tables of the SSE4.2 crc32c engine (Castagnoli only).
+    uint32_t (*hw_shift)[4][256];
+    // cache entries of table and hw_shift, NULL if not cached
+    crc_table_s *table_ref;
+    crc_table_s *hw_ref;
     crc_t init_direct;
     crc_t init_nodirect;
     crc_t crc_mask;
     crc_t high_bit_mask;
+    crc_t poly_raw;     // poly in register order (reflected if refin)
+    // xpow8[k] = x^(8 * 2^k) mod P as raw register, i.e. 2^k zero bytes.
+    crc_t xpow8[64];
+    // crc of any frame with its crc appended by crc_util_model_append
+    crc_t residue;
 
     void *data; // user data
 } crc_model_s;
 
 /* -------------------- private interface -------------------- */
 
+// Take a reference on cached table 'kind' of model, NULL if not cached yet.
+// If 'data' (made by caller) is given, it's cached unless another thread got
+// there first, in which case it's freed and the cached one is returned.
+static crc_table_s *crc_util_table_ref(const crc_model_t m, int kind, void *data) {
+    crc_table_s *t;
+    crc_mutex_lock(&crc_util_tables_lock);
+    for (t = crc_util_tables; t; t = t->next) {
+        if (t->kind == kind && t->width == m->param.width &&
+            t->poly == m->param.poly && t->refin == m->param.refin) {
+            t->ref++;
+            if (CRC_UTIL_TABLE_SLICE == kind && !m->builtin && 0 == t->users++) crc_util_live++;
+            crc_mutex_unlock(&crc_util_tables_lock);
+            free(data);
+            return t;
+        }
+    }
+    if (data && NULL != (t = calloc(1, sizeof(crc_table_s)))) {
+        t->kind = kind;
+        t->width = m->param.width;
+        t->refin = m->param.refin;
+        t->poly = m->param.poly;
+        t->ref = 1;
+        t->users = !m->builtin;
+        if (CRC_UTIL_TABLE_SLICE == kind && t->users) crc_util_live++;
+        t->data = data;
+        t->next = crc_util_tables;
+        crc_util_tables = t;
+    }
+    crc_mutex_unlock(&crc_util_tables_lock);
+    return t;
+}
+
+// Drop a reference of a crc_util_model_init model, the last one frees the table.
+static void crc_util_table_unref(crc_table_s *t) {
+    crc_table_s **pt;
+    if (NULL == t) return;
+    crc_mutex_lock(&crc_util_tables_lock);
+    if (CRC_UTIL_TABLE_SLICE == t->kind && 0 == --t->users) crc_util_live--;
+    if (--t->ref) {
+        crc_mutex_unlock(&crc_util_tables_lock);
+        return;
+    }
+    for (pt = &crc_util_tables; *pt != t; pt = &(*pt)->next);
+    *pt = t->next;
+    crc_mutex_unlock(&crc_util_tables_lock);
+    free(t->data);
+    free(t);
+}
+
 static __inline int crc_util_param_check(crc_model_param_s param) {
     int rc = 0;
     crc_t crcmask = ((((crc_t)1 << (param.width - 1)) - 1) << 1) | 1;
@@ -68,63 +227,252 @@ static __inline int crc_util_param_check(crc_model_param_s param) {
     return rc;
 }
 
+
+#if defined(__GNUC__)
+#define CRC_UTIL_BSWAP64(x) __builtin_bswap64(x)
+#elif defined(_MSC_VER)
+#define CRC_UTIL_BSWAP64(x) _byteswap_uint64(x)
+#else
+static __inline uint64_t CRC_UTIL_BSWAP64(uint64_t x) {
+    x = (x & 0x00000000FFFFFFFFULL) << 32 | (x & 0xFFFFFFFF00000000ULL) >> 32;
+    x = (x & 0x0000FFFF0000FFFFULL) << 16 | (x & 0xFFFF0000FFFF0000ULL) >> 16;
+    x = (x & 0x00FF00FF00FF00FFULL) << 8  | (x & 0xFF00FF00FF00FF00ULL) >> 8;
+    return x;
+}
+#endif
+
+// Load 8 bytes as little/big endian word, no alignment required.
+static __inline uint64_t crc_util_load_le64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = CRC_UTIL_BSWAP64(v);
+#endif
+    return v;
+}
+
+static __inline uint64_t crc_util_load_be64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+    v = CRC_UTIL_BSWAP64(v);
+#endif
+    return v;
+}
+
+// dst = a ^ b, 'len' bytes.
+static __inline void crc_util_xor(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t len) {
+    uint64_t u, v;
+    for (; len >= 8; len -= 8, dst += 8, a += 8, b += 8) {
+        memcpy(&u, a, sizeof(u));
+        memcpy(&v, b, sizeof(v));
+        u ^= v;
+        memcpy(dst, &u, sizeof(u));
+    }
+    while (len--) *dst++ = *a++ ^ *b++;
+}
+
+// Reflects all 64 bits of 'x'.
+static __inline uint64_t crc_util_reflect64(uint64_t x) {
+    x = (x & 0x5555555555555555ULL) << 1 | ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) << 2 | ((x >> 2) & 0x3333333333333333ULL);
+    x = (x & 0x0F0F0F0F0F0F0F0FULL) << 4 | ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+    return CRC_UTIL_BSWAP64(x);
+}
+
 // Reflects the lower 'bitnum' bits of 'crc'
 static __inline crc_t crc_util_reflect(crc_t crc, int bitnum) {
-    crc_t i, j = 1, crcout = 0;
-    for (i = (crc_t)1 << (bitnum - 1); i; i >>= 1) {
-        if (crc & i) crcout |= j;
-        j <<= 1;
-    }
-    return crcout;
+    return crc_util_reflect64(crc) >> (64 - bitnum);
 }
 
-#if defined(CRC_UTIL_NORMAL) || defined(_DEBUG)
+#ifdef CRC_UTIL_X86
+// cpuid leaf 1 ecx feature bits
+#define CRC_UTIL_CPU_PCLMUL (1u << 1)
+#define CRC_UTIL_CPU_SSSE3  (1u << 9)
+#define CRC_UTIL_CPU_SSE42  (1u << 20)
 
-// Normal lookup table algorithm with augmented zero bytes.
-// Only usable with polynom orders of 8, 16, 24 or 32.
-static crc_t crc_util_table(const crc_model_t m, const uint8_t *p, size_t len) {
-    if (!m || !p) {
-        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
-        return ~((crc_t)0);
-    }
-    uint32_t order = m->param.width;
-    crc_t crc = m->init_nodirect;
-    if (m->param.refin) crc = crc_util_reflect(crc, order);
+static unsigned int crc_util_cpu_features(void) {
+    unsigned int ecx;
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    ecx = (unsigned int)info[2];
+#else //! _MSC_VER
+    unsigned int eax, ebx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+#endif /* _MSC_VER */
+    return ecx;
+}
 
-    if (!m->param.refin) {
-        while (len--) crc = ((crc << 8) | *p++) ^ m->table[(crc >> (order - 8)) & 0xff];
-    }
-    else {
-        // reflect input
-        while (len--) crc = ((crc >> 8) | (*p++ << (order - 8))) ^ m->table[crc & 0xff];
+// cpuid leaf 1 eax: family, model and stepping.
+static unsigned int crc_util_cpu_id(void) {
+    unsigned int eax;
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    eax = (unsigned int)info[0];
+#else //! _MSC_VER
+    unsigned int ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+#endif /* _MSC_VER */
+    return eax;
+}
+#else //! CRC_UTIL_X86
+static unsigned int crc_util_cpu_id(void) { return 0; }
+#endif /* CRC_UTIL_X86 */
+
+// Multiply register by x modulo the model polynom.
+static __inline crc_t crc_util_mulx(const crc_model_t m, crc_t a) {
+    if (m->param.refin) return (a & 1) ? (a >> 1) ^ m->poly_raw : a >> 1;
+    return ((a & m->high_bit_mask) ? (a << 1) ^ m->poly_raw : a << 1) & m->crc_mask;
+}
+
+// Multiply a(x) by b(x) modulo the model polynom. Both are raw registers as
+// used by the fast table algorithm, i.e. bit reflected if refin.
+static crc_t crc_util_multmodp(const crc_model_t m, crc_t a, crc_t b) {
+    crc_t bit, p = 0;
+    // walk a from x^0 upwards, b holds x^i * b(x) mod P
+    for (bit = m->param.refin ? m->high_bit_mask : 1; a; ) {
+        if (a & bit) {
+            p ^= b;
+            a ^= bit;
+        }
+        b = crc_util_mulx(m, b);
+        bit = m->param.refin ? bit >> 1 : bit << 1;
     }
-    // handle final augmented zero bytes
-    if (!m->param.refin) {
-        while (++len < order / 8) crc = (crc << 8) ^ m->table[(crc >> (order - 8)) & 0xff];
+    return p;
+}
+
+// x^(8 * n) mod P as raw register, i.e. the operator of n zero bytes.
+// Multiply the cached x^(8 * 2^k) powers for each bit k set in n.
+static crc_t crc_util_xpow8n(const crc_model_t m, uint64_t n) {
+    crc_t p = m->param.refin ? m->high_bit_mask : 1;
+    int k;
+    for (k = 0; n; k++, n >>= 1) {
+        if (n & 1) p = crc_util_multmodp(m, m->xpow8[k], p);
     }
-    else {
-        while (++len < order / 8) crc = (crc >> 8) ^ m->table[crc & 0xff];
+    return p;
+}
+
+// Make the x^(8 * 2^k) mod P table used by crc_util_xpow8n.
+static void crc_util_xpow8_generate(crc_model_t m) {
+    crc_t p = m->param.refin ? m->high_bit_mask : 1;
+    int k;
+    for (k = 0; k < 8; k++) p = crc_util_mulx(m, p);
+    for (k = 0; k < 64; k++) {
+        m->xpow8[k] = p;
+        p = crc_util_multmodp(m, p, p);
     }
+}
+
+// Note: All *_update algorithms below work on the raw crc register, i.e. the
+// register of the lookup table algorithm, which is bit reflected if refin. So
+// they can be chained on consecutive chunks and switched between freely.
+
+// Raw register of initial value 'init'.
+static __inline crc_t crc_util_start(const crc_model_t m, crc_t init) {
+    return m->param.refin ? crc_util_reflect(init, m->param.width) : init;
+}
 
-    if (m->param.refout ^ m->param.refin) crc = crc_util_reflect(crc, order);
+// Post processing of raw register: reflect, xorout and swapout.
+static __inline crc_t crc_util_finish(const crc_model_t m, crc_t crc) {
+    if (m->param.refout ^ m->param.refin) crc = crc_util_reflect(crc, m->param.width);
     crc ^= m->param.xorout;
     crc &= m->crc_mask;
     return (m->param.swapout) ? ((crc & 0xff00) >> 8 | (crc & 0x00ff) << 8) : crc;
 }
 
-// Bit by bit algorithm with augmented zero bytes.
-// Don't use lookup table, suited for polynom orders between 1...32.
-static crc_t crc_util_bitbybit(const crc_model_t m, const uint8_t *p, size_t len) {
+// Raw register of crc output, reverse of crc_util_finish.
+static __inline crc_t crc_util_unfinish(const crc_model_t m, crc_t crc) {
+    crc &= m->crc_mask;
+    if (m->param.swapout) crc = (crc & 0xff00) >> 8 | (crc & 0x00ff) << 8;
+    crc ^= m->param.xorout;
+    return (m->param.refout ^ m->param.refin) ? crc_util_reflect(crc, m->param.width) : crc;
+}
+
+// Number of slicing tables, enough for crc_util_slice16.
+#define CRC_UTIL_SLICE_NUM  16
+
+// Slicing-by-8 step on 8 input bytes 'v' merged with register.
+#define CRC_UTIL_SLICE8_REFIN(t, v) (                                   \
+    t[7][(v) & 0xff] ^ t[6][((v) >> 8) & 0xff] ^                        \
+    t[5][((v) >> 16) & 0xff] ^ t[4][((v) >> 24) & 0xff] ^               \
+    t[3][((v) >> 32) & 0xff] ^ t[2][((v) >> 40) & 0xff] ^               \
+    t[1][((v) >> 48) & 0xff] ^ t[0][(v) >> 56])
+#define CRC_UTIL_SLICE8_NOREFIN(t, v) (                                 \
+    t[7][(v) >> 56] ^ t[6][((v) >> 48) & 0xff] ^                        \
+    t[5][((v) >> 40) & 0xff] ^ t[4][((v) >> 32) & 0xff] ^               \
+    t[3][((v) >> 24) & 0xff] ^ t[2][((v) >> 16) & 0xff] ^               \
+    t[1][((v) >> 8) & 0xff] ^ t[0][(v) & 0xff])
+
+// Table engines per register type (crc_util_xxx16/32/64).
+#define CRC_UTIL_CAT_(a, b) a##b
+#define CRC_UTIL_CAT(a, b)  CRC_UTIL_CAT_(a, b)
+#define CRC_REG_T       uint16_t
+#define CRC_REG_BITS    16
+#include "crc_utils_reg.h"
+#undef CRC_REG_T
+#undef CRC_REG_BITS
+#define CRC_REG_T       uint32_t
+#define CRC_REG_BITS    32
+#include "crc_utils_reg.h"
+#undef CRC_REG_T
+#undef CRC_REG_BITS
+#define CRC_REG_T       uint64_t
+#define CRC_REG_BITS    64
+#include "crc_utils_reg.h"
+#undef CRC_REG_T
+#undef CRC_REG_BITS
+
+// Call table engine 'fn' of the model register type.
+#define CRC_UTIL_REG_CALL(fn, m, ...) (16 == (m)->reg ? fn##16(m, __VA_ARGS__) : \
+    32 == (m)->reg ? fn##32(m, __VA_ARGS__) : fn##64(m, __VA_ARGS__))
+
+#if defined(CRC_UTIL_NORMAL) || defined(_DEBUG)
+
+// Feed 'width' augmented zero bits through the register.
+static __inline crc_t crc_util_augment(const crc_model_t m, crc_t crc) {
+    int i;
+    for (i = 0; i < m->param.width; i++) crc = crc_util_mulx(m, crc);
+    return crc;
+}
+
+// Normal lookup table algorithm with augmented zero bytes.
+// Only usable with polynom orders of 8, 16, 24, ..., 64.
+static crc_t crc_util_table_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    return CRC_UTIL_REG_CALL(crc_util_table_update, m, crc, p, len);
+}
+
+static crc_t crc_util_table(const crc_model_t m, const uint8_t *p, size_t len) {
     if (!m || !p) {
         log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
         return ~((crc_t)0);
     }
+    crc_t crc = crc_util_table_update(m, crc_util_start(m, m->init_nodirect), p, len);
+    // handle final augmented zero bytes
+    return crc_util_finish(m, crc_util_augment(m, crc));
+}
+
+// Bit by bit algorithm with augmented zero bytes.
+// Don't use lookup table, suited for polynom orders between 1...32.
+static crc_t crc_util_bitbybit_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
     size_t i, j;
-    crc_t crc = m->init_nodirect, c, bit;
+    crc_t c, bit;
+    if (m->param.refin) {
+        // reflected register: shift right, input bits LSB first at the top
+        for (i = 0; i < len; i++) {
+            c = (crc_t)*p++;
+            for (j = 0; j < 8; j++) {
+                bit = crc & 1;
+                crc = (crc >> 1) | (((c >> j) & 1) << (m->param.width - 1));
+                if (bit) crc ^= m->poly_raw;
+            }
+        }
+        return crc;
+    }
     for (i = 0; i < len; i++) {
         // qinhj: read one byte each time(since the generated table size is 2^8)
         c = (crc_t)*p++;
-        if (m->param.refin) c = crc_util_reflect(c, 8 * sizeof(uint8_t));
         for (j = 0x80; j; j >>= 1) {
             bit = crc & m->high_bit_mask;
             crc <<= 1;
@@ -132,15 +480,16 @@ static crc_t crc_util_bitbybit(const crc_model_t m, const uint8_t *p, size_t len
             if (bit) crc ^= m->param.poly;
         }
     }
-    for (i = 0; i < m->param.width; i++) {
-        bit = crc & m->high_bit_mask;
-        crc <<= 1;
-        if (bit) crc ^= m->param.poly;
+    return crc & m->crc_mask;
+}
+
+static crc_t crc_util_bitbybit(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
     }
-    if (m->param.refout) crc = crc_util_reflect(crc, m->param.width);
-    crc ^= m->param.xorout;
-    crc &= m->crc_mask;
-    return (m->param.swapout) ? ((crc & 0xff00) >> 8 | (crc & 0x00ff) << 8) : crc;
+    crc_t crc = crc_util_bitbybit_update(m, crc_util_start(m, m->init_nodirect), p, len);
+    return crc_util_finish(m, crc_util_augment(m, crc));
 }
 
 #endif  /* CRC_UTIL_NORMAL || _DEBUG */
@@ -148,42 +497,301 @@ static crc_t crc_util_bitbybit(const crc_model_t m, const uint8_t *p, size_t len
 #ifndef CRC_UTIL_NORMAL
 
 // Fast lookup table algorithm without augmented zero bytes, e.g. used in pkzip.
-// Only usable with polynom orders of 8, 16, 24 or 32.
+// Usable with all polynom orders, the register is left-aligned to whole bytes.
+static crc_t crc_util_table_fast_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    return CRC_UTIL_REG_CALL(crc_util_table_fast_update, m, crc, p, len);
+}
+
 static crc_t crc_util_table_fast(const crc_model_t m, const uint8_t *p, size_t len) {
     if (!m || !p) {
         log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
         return ~((crc_t)0);
     }
-    uint32_t order = m->param.width;
-    crc_t crc = m->init_direct;
-    if (m->param.refin) crc = crc_util_reflect(crc, order);
+    return crc_util_finish(m, crc_util_table_fast_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+// Half byte lookup table algorithm without augmented zero bytes.
+// Two lookups per byte in a 16-entry table, which takes only 1 or 2 cache
+// lines. Usable with all polynom orders as crc_util_table_fast.
+static crc_t crc_util_nibble_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    return CRC_UTIL_REG_CALL(crc_util_nibble_update, m, crc, p, len);
+}
+
+static crc_t crc_util_nibble(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_nibble_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+// Slicing-by-8 algorithm without augmented zero bytes.
+// Consume 8 bytes per step with 8 independent table lookups, which breaks the
+// serial dependency of crc_util_table_fast. The register is merged into the
+// first bytes of each block, so all polynom orders up to 64 are fine.
+static crc_t crc_util_slice8_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    return CRC_UTIL_REG_CALL(crc_util_slice8_update, m, crc, p, len);
+}
+
+static crc_t crc_util_slice8(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_slice8_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+// Slicing-by-16 algorithm without augmented zero bytes.
+// Same as crc_util_slice8, but with 16 lookups per step on the upper tables.
+static crc_t crc_util_slice16_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    return CRC_UTIL_REG_CALL(crc_util_slice16_update, m, crc, p, len);
+}
+
+static crc_t crc_util_slice16(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_slice16_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+#ifdef CRC_UTIL_X86
+
+// Input length from which crc_util_model_run switches to folding.
+#define CRC_UTIL_FOLD_MIN   256
 
-    if (!m->param.refin) {
-        while (len--) crc = (crc << 8) ^ m->table[((crc >> (order - 8)) & 0xff) ^ *p++];
+// Fold a 128-bit accumulator x forward by the distance encoded in k.
+#define CRC_UTIL_FOLD(x, k) _mm_xor_si128(                              \
+    _mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11))
+
+// Carry-less multiply of two 64-bit polynoms, return 128-bit product as {lo, hi}.
+CRC_UTIL_TARGET("pclmul,ssse3")
+static __inline void crc_util_clmul64(uint64_t a, uint64_t b, uint64_t out[2]) {
+    __m128i x = _mm_clmulepi64_si128(_mm_set_epi64x(0, (long long)a), _mm_set_epi64x(0, (long long)b), 0x00);
+    _mm_storeu_si128((__m128i *)out, x);
+}
+
+// Load 16 input bytes in register bit order, and store them to 'dst' as well
+// (if not NULL) for crc_util_model_copy_run, sharing the load.
+CRC_UTIL_TARGET("pclmul,ssse3")
+static __inline __m128i crc_util_fold_load(const uint8_t *q, uint8_t *dst, int refin, __m128i bswap) {
+    __m128i x = _mm_loadu_si128((const __m128i *)q);
+    if (dst) _mm_storeu_si128((__m128i *)dst, x);
+    return refin ? x : _mm_shuffle_epi8(x, bswap);
+}
+
+// Fold (len & ~15) bytes (len >= 64) into register crc by carry-less multiply
+// with 4 interleaved 128-bit accumulators, then reduce the last accumulator by
+// Barrett reduction. Input is copied to 'dst' on the way, if not NULL.
+CRC_UTIL_TARGET("pclmul,ssse3")
+static crc_t crc_util_fold_kernel(const crc_model_t m, crc_t crc, uint8_t *dst, const uint8_t *p, size_t len) {
+    const crc_fold_s *f = &m->fold;
+    const int refin = m->param.refin;
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i x0, x1, x2, x3, k;
+    uint64_t acc[2], hi, lo, t[2];
+    size_t i;
+#define CRC_UTIL_FOLD_LOAD(o) crc_util_fold_load(p + (o), dst ? dst + (o) : NULL, refin, bswap)
+
+    x0 = CRC_UTIL_FOLD_LOAD(0);
+    x1 = CRC_UTIL_FOLD_LOAD(16);
+    x2 = CRC_UTIL_FOLD_LOAD(32);
+    x3 = CRC_UTIL_FOLD_LOAD(48);
+    // merge register into the first message bits
+    if (refin) {
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, (long long)crc));
     }
     else {
-        while (len--) crc = (crc >> 8) ^ m->table[(crc & 0xff) ^ *p++];
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x((long long)((uint64_t)crc << (64 - m->param.width)), 0));
     }
 
-    if (m->param.refout ^ m->param.refin) crc = crc_util_reflect(crc, order);
-    crc ^= m->param.xorout;
-    crc &= m->crc_mask;
-    return (m->param.swapout) ? ((crc & 0xff00) >> 8 | (crc & 0x00ff) << 8) : crc;
+    k = _mm_loadu_si128((const __m128i *)f->k512);
+    for (i = 64; i + 64 <= len; i += 64) {
+        x0 = _mm_xor_si128(CRC_UTIL_FOLD(x0, k), CRC_UTIL_FOLD_LOAD(i));
+        x1 = _mm_xor_si128(CRC_UTIL_FOLD(x1, k), CRC_UTIL_FOLD_LOAD(i + 16));
+        x2 = _mm_xor_si128(CRC_UTIL_FOLD(x2, k), CRC_UTIL_FOLD_LOAD(i + 32));
+        x3 = _mm_xor_si128(CRC_UTIL_FOLD(x3, k), CRC_UTIL_FOLD_LOAD(i + 48));
+    }
+    x0 = CRC_UTIL_FOLD(x0, _mm_loadu_si128((const __m128i *)f->k384));
+    x1 = CRC_UTIL_FOLD(x1, _mm_loadu_si128((const __m128i *)f->k256));
+    k = _mm_loadu_si128((const __m128i *)f->k128);
+    x2 = CRC_UTIL_FOLD(x2, k);
+    x0 = _mm_xor_si128(_mm_xor_si128(x0, x1), _mm_xor_si128(x2, x3));
+    for (; i + 16 <= len; i += 16) {
+        x0 = _mm_xor_si128(CRC_UTIL_FOLD(x0, k), CRC_UTIL_FOLD_LOAD(i));
+    }
+#undef CRC_UTIL_FOLD_LOAD
+
+    // back to normal bit order: X = hi * x^64 + lo
+    _mm_storeu_si128((__m128i *)acc, x0);
+    if (refin) {
+        hi = crc_util_reflect64(acc[0]);
+        lo = crc_util_reflect64(acc[1]);
+    }
+    else {
+        hi = acc[1];
+        lo = acc[0];
+    }
+    // T = X * x^64 mod G, reduce hi part first: T = hi * (x^128 mod G) + lo * x^64
+    crc_util_clmul64(hi, f->x128, t);
+    hi = t[1] ^ lo;
+    lo = t[0];
+    // Barrett: q = floor(T / G), T mod G = lo ^ (q * G)
+    crc_util_clmul64(hi, f->mu, t);
+    crc_util_clmul64(hi ^ t[1], f->poly, t);
+    lo ^= t[0];
+    return (crc_t)(refin ? crc_util_reflect64(lo) : lo >> (64 - m->param.width));
 }
 
-// Fast bit by bit algorithm without augmented zero bytes.
-// Don't use lookup table, suited for polynom orders between 1...32.
-static crc_t crc_util_bitbybit_fast(const crc_model_t m, const uint8_t *p, size_t len) {
+// Carry-less multiply folding algorithm without augmented zero bytes.
+// Usable with all polynom orders up to 64, the tail of less than 16 bytes
+// goes through the lookup table.
+static crc_t crc_util_fold_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    if (len >= 64) {
+        size_t n = len & ~(size_t)15;
+        crc = crc_util_fold_kernel(m, crc, NULL, p, n);
+        p += n, len -= n;
+    }
+    return crc_util_table_fast_update(m, crc, p, len);
+}
+
+static crc_t crc_util_fold(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_fold_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+#endif  /* CRC_UTIL_X86 */
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Castagnoli polynom served by the SSE4.2 crc32 instruction.
+#define CRC_UTIL_CRC32C_POLY    0x1EDC6F41
+// Segment lengths of the 3 interleaved streams.
+#define CRC_UTIL_CRC32C_LONG    8192
+#define CRC_UTIL_CRC32C_SHORT   256
+
+// Feed register through the zero shift table, same as crc of 'LONG' or
+// 'SHORT' zero bytes.
+static __inline uint32_t crc_util_crc32c_shift(uint32_t zeros[4][256], uint32_t crc) {
+    return zeros[0][crc & 0xff] ^ zeros[1][(crc >> 8) & 0xff] ^
+        zeros[2][(crc >> 16) & 0xff] ^ zeros[3][crc >> 24];
+}
+
+// Hardware crc32c algorithm without augmented zero bytes.
+// The crc32 instruction has 3 cycles latency and 1 cycle throughput, so run
+// 3 independent streams on adjacent segments and merge them by zero shift.
+// Only usable with Castagnoli polynom (reflected).
+CRC_UTIL_TARGET("sse4.2")
+static crc_t crc_util_crc32c_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint64_t crc0 = crc, crc1, crc2;
+    const uint8_t *end;
+
+    // align input to 8 bytes
+    while (len && ((uintptr_t)p & 7)) {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *p++);
+        len--;
+    }
+#define CRC_UTIL_CRC32C_3WAY(seg, zeros) do {                           \
+    while (len >= 3 * (seg)) {                                          \
+        crc1 = crc2 = 0;                                                \
+        for (end = p + (seg); p < end; p += 8) {                        \
+            crc0 = _mm_crc32_u64(crc0, crc_util_load_le64(p));          \
+            crc1 = _mm_crc32_u64(crc1, crc_util_load_le64(p + (seg)));  \
+            crc2 = _mm_crc32_u64(crc2, crc_util_load_le64(p + 2 * (seg))); \
+        }                                                               \
+        crc0 = crc_util_crc32c_shift(zeros, (uint32_t)crc0) ^ crc1;     \
+        crc0 = crc_util_crc32c_shift(zeros, (uint32_t)crc0) ^ crc2;     \
+        p += 2 * (seg);                                                 \
+        len -= 3 * (seg);                                               \
+    }                                                                   \
+} while (0)
+    CRC_UTIL_CRC32C_3WAY(CRC_UTIL_CRC32C_LONG, m->hw_shift[0]);
+    CRC_UTIL_CRC32C_3WAY(CRC_UTIL_CRC32C_SHORT, m->hw_shift[1]);
+#undef CRC_UTIL_CRC32C_3WAY
+    for (; len >= 8; p += 8, len -= 8) {
+        crc0 = _mm_crc32_u64(crc0, crc_util_load_le64(p));
+    }
+    while (len--) crc0 = _mm_crc32_u8((uint32_t)crc0, *p++);
+    return (crc_t)crc0;
+}
+
+// Hardware crc32c algorithm on 4 independent messages, 'len' (multiple of 8)
+// bytes each, which fills the crc32 instruction pipeline as the 3 streams of
+// crc_util_crc32c_update without the merge by zero shift.
+CRC_UTIL_TARGET("sse4.2")
+static void crc_util_crc32c_x4_update(crc_t crc[4], const uint8_t *p[4], size_t len) {
+    uint64_t c0 = crc[0], c1 = crc[1], c2 = crc[2], c3 = crc[3];
+    size_t i;
+    for (i = 0; i < len; i += 8) {
+        c0 = _mm_crc32_u64(c0, crc_util_load_le64(p[0] + i));
+        c1 = _mm_crc32_u64(c1, crc_util_load_le64(p[1] + i));
+        c2 = _mm_crc32_u64(c2, crc_util_load_le64(p[2] + i));
+        c3 = _mm_crc32_u64(c3, crc_util_load_le64(p[3] + i));
+    }
+    crc[0] = c0, crc[1] = c1, crc[2] = c2, crc[3] = c3;
+}
+
+static crc_t crc_util_crc32c_hw(const crc_model_t m, const uint8_t *p, size_t len) {
     if (!m || !p) {
         log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
         return ~((crc_t)0);
     }
+    return crc_util_finish(m, crc_util_crc32c_update(m, crc_util_start(m, m->init_direct), p, len));
+}
+
+// Make zero shift tables for crc_util_crc32c_hw if model is Castagnoli and
+// cpu has SSE4.2.
+static int crc_util_crc32c_generate(crc_model_t model) {
+    static const size_t seg[2] = { CRC_UTIL_CRC32C_LONG, CRC_UTIL_CRC32C_SHORT };
+    int i, j, k;
+    crc_t xn;
+    if (32 != model->param.width || CRC_UTIL_CRC32C_POLY != model->param.poly ||
+        !model->param.refin || !(crc_util_cpu_features() & CRC_UTIL_CPU_SSE42)) {
+        return 0;
+    }
+    if (NULL != (model->hw_ref = crc_util_table_ref(model, CRC_UTIL_TABLE_CRC32C, NULL))) {
+        model->hw_shift = model->hw_ref->data;
+        return 0;
+    }
+    if (NULL == (model->hw_shift = calloc(2, sizeof(*model->hw_shift)))) {
+        log_error("[%s] calloc for zero shift table failed\n", __FUNCTION__);
+        return -2;
+    }
+    for (i = 0; i < 2; i++) {
+        xn = crc_util_xpow8n(model, seg[i]);
+        for (k = 0; k < 4; k++) {
+            for (j = 0; j < 256; j++) {
+                model->hw_shift[i][k][j] = (uint32_t)crc_util_multmodp(model, xn, (crc_t)j << (8 * k));
+            }
+        }
+    }
+    if (NULL != (model->hw_ref = crc_util_table_ref(model, CRC_UTIL_TABLE_CRC32C, model->hw_shift))) {
+        model->hw_shift = model->hw_ref->data;
+    }
+    return 0;
+}
+
+#endif  /* __x86_64__ || _M_X64 */
+
+// Fast bit by bit algorithm without augmented zero bytes.
+// Don't use lookup table, suited for polynom orders between 1...32.
+static crc_t crc_util_bitbybit_fast_update(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
     size_t i, j;
-    crc_t crc = m->init_direct, c, bit;
+    crc_t c, bit;
+    if (m->param.refin) {
+        // reflected register: shift right, whole byte merged LSB first
+        for (i = 0; i < len; i++) {
+            crc ^= *p++;
+            for (j = 0; j < 8; j++) crc = (crc >> 1) ^ (m->poly_raw & ((crc_t)0 - (crc & 1)));
+        }
+        return crc;
+    }
     for (i = 0; i < len; i++) {
         // qinhj: read one byte each time(since the generated table size is 2^8)
         c = (crc_t)*p++;
-        if (m->param.refin) c = crc_util_reflect(c, 8 * sizeof(uint8_t));
         for (j = 0x80; j; j >>= 1) {
             bit = crc & m->high_bit_mask;
             crc <<= 1;
@@ -191,16 +799,51 @@ static crc_t crc_util_bitbybit_fast(const crc_model_t m, const uint8_t *p, size_
             if (bit) crc ^= m->param.poly;
         }
     }
-    if (m->param.refout) crc = crc_util_reflect(crc, m->param.width);
-    crc ^= m->param.xorout;
-    crc &= m->crc_mask;
-    return (m->param.swapout) ? ((crc & 0xff00) >> 8 | (crc & 0x00ff) << 8) : crc;
+    return crc & m->crc_mask;
+}
+
+static crc_t crc_util_bitbybit_fast(const crc_model_t m, const uint8_t *p, size_t len) {
+    if (!m || !p) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_bitbybit_fast_update(m, crc_util_start(m, m->init_direct), p, len));
 }
 
 #endif  /* CRC_UTIL_NORMAL */
 
-// Make CRC lookup table used by table algorithms.
-static int crc_util_table_generate(crc_model_t model) {
+// Input length from which crc_util_model_run switches to slicing-by-16.
+#define CRC_UTIL_SLICE_MIN  16
+
+// Entry i of table k in model register type.
+static __inline crc_t crc_util_table_get(const crc_model_t m, int k, int i) {
+    if (16 == m->reg) return ((const uint16_t (*)[256])m->table)[k][i];
+    if (32 == m->reg) return ((const uint32_t (*)[256])m->table)[k][i];
+    return ((const uint64_t (*)[256])m->table)[k][i];
+}
+
+static __inline void crc_util_table_set(crc_model_t m, int k, int i, crc_t crc) {
+    if (16 == m->reg) ((uint16_t (*)[256])m->table)[k][i] = (uint16_t)crc;
+    else if (32 == m->reg) ((uint32_t (*)[256])m->table)[k][i] = (uint32_t)crc;
+    else ((uint64_t (*)[256])m->table)[k][i] = crc;
+}
+
+// Make nibble table from byte table: nibble i is byte i with leading (or, if
+// refin, trailing) zero nibble.
+static void crc_util_nibble_generate(crc_model_t m) {
+    int i;
+    crc_t crc;
+    for (i = 0; i < 16; i++) {
+        crc = crc_util_table_get(m, 0, m->param.refin ? i << 4 : i);
+        if (16 == m->reg) m->table_nibble.r16[i] = (uint16_t)crc;
+        else if (32 == m->reg) m->table_nibble.r32[i] = (uint32_t)crc;
+        else m->table_nibble.r64[i] = crc;
+    }
+}
+
+// Make CRC lookup table used by table algorithms, the byte table is copied
+// from 'base' if given (precomputed table of a catalogue model).
+static int crc_util_table_generate(crc_model_t model, const void *base) {
     if (NULL == model) {
         log_error("[%s] invalid input ptr: NULL\n", __FUNCTION__);
         return -1;
@@ -209,29 +852,367 @@ static int crc_util_table_generate(crc_model_t model) {
         log_warn("[%s] lookup table already inited\n", __FUNCTION__);
         return 0;
     }
-    int i, j, count = 1 << 8;
-    if (NULL == (model->table = calloc(count, sizeof(crc_t)))) {
+    int i, j, k, count = 1 << 8;
+    // one block for all slicing tables
+    if (NULL == (model->table = calloc(CRC_UTIL_SLICE_NUM, 256 * (model->reg / 8)))) {
         log_error("[%s] calloc for lookup table failed\n", __FUNCTION__);
         return -2;
     }
+    model->table_num = CRC_UTIL_SLICE_NUM;
     crc_t crc, bit;
-    for (i = 0; i < count; i++) {
-        crc = (crc_t)i;
-        if (model->param.refin) crc = crc_util_reflect(crc, 8);
-        crc <<= model->param.width - 8;
+    crc_t poly = model->param.poly << model->shift, high_bit = (crc_t)1 << (model->order - 1);
+    if (base) memcpy(model->table, base, 256 * (model->reg / 8));
+    for (i = 0; !base && i < count; i++) {
+        if (model->param.refin) {
+            // reflected register of order bits, poly reflected as well
+            crc = (crc_t)i;
+            for (j = 0; j < 8; j++) crc = (crc >> 1) ^ (model->poly_raw & ((crc_t)0 - (crc & 1)));
+            crc_util_table_set(model, 0, i, crc);
+            continue;
+        }
+        crc = (crc_t)i << (model->order - 8);
         for (j = 0x80; j; j >>= 1) {
-            bit = crc & model->high_bit_mask;
+            bit = crc & high_bit;
             crc <<= 1;
-            if (bit) crc ^= model->param.poly;
+            if (bit) crc ^= poly;
         }
-        if (model->param.refin) crc = crc_util_reflect(crc, model->param.width);
-        crc &= model->crc_mask;
-        model->table[i] = crc;
+        crc &= model->order_mask;
+        crc_util_table_set(model, 0, i, crc);
         //printf("crc table[0x%X]: 0x"CRC_F"\n", i, crc);
     }
+    // table[k]: feed one more zero byte through table[k - 1]
+    for (k = 1; k < CRC_UTIL_SLICE_NUM; k++) {
+        for (i = 0; i < count; i++) {
+            crc = crc_util_table_get(model, k - 1, i);
+            if (model->param.refin) {
+                crc = (crc >> 8) ^ crc_util_table_get(model, 0, crc & 0xff);
+            }
+            else {
+                crc = (crc << 8) ^ crc_util_table_get(model, 0, (crc >> (model->order - 8)) & 0xff);
+            }
+            crc_util_table_set(model, k, i, crc & model->order_mask);
+        }
+    }
+    return 0;
+}
+
+#ifdef CRC_UTIL_X86
+// Derive the folding constants of crc_fold_s from model poly and width.
+static void crc_util_fold_generate(crc_model_t model) {
+    const uint64_t g = (uint64_t)model->param.poly << (64 - model->param.width);
+    uint64_t k = g, mu = 0, x[576 + 1];
+    int i;
+    // x[i] = x^i mod G, starting from x^64 mod G = g
+    for (i = 0; i < 64; i++) x[i] = (uint64_t)1 << i;
+    for (i = 64; i <= 576; i++) {
+        x[i] = k;
+        k = (k << 1) ^ ((k >> 63) ? g : 0);
+    }
+    // x^128 / G by long division, the quotient bits are those shifted out
+    for (i = 63, k = g; i >= 0; i--) {
+        if (k >> 63) mu |= (uint64_t)1 << i;
+        k = (k << 1) ^ ((k >> 63) ? g : 0);
+    }
+#define CRC_UTIL_FOLD_K(kx, d) do {                                     \
+    if (model->param.refin) {                                           \
+        kx[0] = crc_util_reflect64(x[(d) + 63]);                        \
+        kx[1] = crc_util_reflect64(x[(d) - 1]);                         \
+    }                                                                   \
+    else {                                                              \
+        kx[0] = x[d];                                                   \
+        kx[1] = x[(d) + 64];                                            \
+    }                                                                   \
+} while (0)
+    CRC_UTIL_FOLD_K(model->fold.k512, 512);
+    CRC_UTIL_FOLD_K(model->fold.k384, 384);
+    CRC_UTIL_FOLD_K(model->fold.k256, 256);
+    CRC_UTIL_FOLD_K(model->fold.k128, 128);
+#undef CRC_UTIL_FOLD_K
+    model->fold.x128 = x[128];
+    model->fold.mu = mu;
+    model->fold.poly = g;
+}
+#endif /* CRC_UTIL_X86 */
+
+#ifndef CRC_UTIL_NORMAL
+
+// Feed input through engine 'e', CRC_ENGINE_AUTO goes to the byte table.
+static crc_t crc_util_engine_update(const crc_model_t m, crc_engine_e e, crc_t crc, const uint8_t *p, size_t len) {
+    switch (e) {
+    case CRC_ENGINE_BITBYBIT: return crc_util_bitbybit_fast_update(m, crc, p, len);
+    case CRC_ENGINE_NIBBLE: return crc_util_nibble_update(m, crc, p, len);
+    case CRC_ENGINE_SLICE8: return crc_util_slice8_update(m, crc, p, len);
+    case CRC_ENGINE_SLICE16: return crc_util_slice16_update(m, crc, p, len);
+#ifdef CRC_UTIL_X86
+    case CRC_ENGINE_FOLD: return crc_util_fold_update(m, crc, p, len);
+#endif /* CRC_UTIL_X86 */
+#if defined(__x86_64__) || defined(_M_X64)
+    case CRC_ENGINE_CRC32C: return crc_util_crc32c_update(m, crc, p, len);
+#endif /* __x86_64__ || _M_X64 */
+    default: return crc_util_table_fast_update(m, crc, p, len);
+    }
+}
+
+// Length class of crc_util_model_tune: log4(len), capped.
+static __inline int crc_util_tune_class(size_t len) {
+    int c;
+#ifdef __GNUC__
+    c = (63 - __builtin_clzll((unsigned long long)len | 1)) >> 1;
+#else //! __GNUC__
+    for (c = 0; len >= 4; len >>= 2) c++;
+#endif /* __GNUC__ */
+    return c < CRC_UTIL_TUNE_NUM - 1 ? c : CRC_UTIL_TUNE_NUM - 1;
+}
+
+#endif /* CRC_UTIL_NORMAL */
+
+#ifndef CRC_UTIL_NORMAL
+
+// Tables other than the byte table can be used: always, but for catalogue
+// models only once made. Those are made by the first run of 'len' bytes
+// they pay off for, so crc_util_model_get itself allocates nothing; until
+// then (or while another thread makes them) the byte table is used.
+static int crc_util_model_lazy(crc_model_t m, size_t len) {
+    if (!m->builtin || 2 == CRC_UTIL_ATOMIC_GET(&m->lazy)) return 1;
+    if (len < CRC_UTIL_SLICE_MIN || !CRC_UTIL_ATOMIC_CAS(&m->lazy, 0, 1)) return 0;
+    // slicing tables from the precomputed byte table, made aside as the
+    // byte table is in use meanwhile
+    crc_model_s tmp = *m;
+    tmp.table = NULL;
+    if (NULL != (tmp.table_ref = crc_util_table_ref(m, CRC_UTIL_TABLE_SLICE, NULL))) {
+        tmp.table = tmp.table_ref->data;
+    }
+    else if (!crc_util_table_generate(&tmp, m->table) &&
+        NULL != (tmp.table_ref = crc_util_table_ref(m, CRC_UTIL_TABLE_SLICE, tmp.table))) {
+        tmp.table = tmp.table_ref->data;
+    }
+    if (tmp.table) {
+        m->table_ref = tmp.table_ref;
+        m->table = tmp.table;
+        m->table_num = CRC_UTIL_SLICE_NUM;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    crc_util_crc32c_generate(m);
+#endif /* __x86_64__ || _M_X64 */
+    // publish (full barrier)
+    CRC_UTIL_ATOMIC_ADD(&m->lazy, 1);
+    return 1;
+}
+
+// Best engine available for the model and input length: pinned engine, else
+// tuned engine of the length class, else by heuristics.
+static __inline crc_engine_e crc_util_engine_pick(const crc_model_t m, size_t len) {
+    crc_engine_e e = m->engine;
+    int tables;
+    if (CRC_ENGINE_AUTO == e) e = (crc_engine_e)m->tune[crc_util_tune_class(len)];
+    if (CRC_ENGINE_AUTO != e) return e;
+    tables = crc_util_model_lazy(m, len);
+#if defined(__x86_64__) || defined(_M_X64)
+    if (tables && m->hw_shift) return CRC_ENGINE_CRC32C;
+#endif /* __x86_64__ || _M_X64 */
+#ifdef CRC_UTIL_X86
+    if (m->fold_enable && len >= CRC_UTIL_FOLD_MIN) return CRC_ENGINE_FOLD;
+#endif /* CRC_UTIL_X86 */
+    if (crc_util_live > CRC_UTIL_NIBBLE_LIVE) return CRC_ENGINE_NIBBLE;
+    if (len < CRC_UTIL_SLICE_MIN || !tables || m->table_num < CRC_UTIL_SLICE_NUM) return CRC_ENGINE_TABLE;
+    return CRC_ENGINE_SLICE16;
+}
+
+#endif /* CRC_UTIL_NORMAL */
+
+// Feed input through the best algorithm available for the model and length.
+static crc_t crc_util_update_raw(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+#ifdef CRC_UTIL_NORMAL
+    return (m->param.width & 7) ? crc_util_bitbybit_update(m, crc, p, len) : crc_util_table_update(m, crc, p, len);
+#else //! CRC_UTIL_NORMAL
+    return crc_util_engine_update(m, crc_util_engine_pick(m, len), crc, p, len);
+#endif /* CRC_UTIL_NORMAL */
+}
+
+// Engine 'e' can run model 'm' on this cpu.
+static int crc_util_engine_usable(const crc_model_t m, crc_engine_e e) {
+    switch (e) {
+    case CRC_ENGINE_AUTO: return 1;
+#ifndef CRC_UTIL_NORMAL
+    case CRC_ENGINE_BITBYBIT:
+    case CRC_ENGINE_TABLE:
+    case CRC_ENGINE_NIBBLE: return 1;
+    case CRC_ENGINE_SLICE8:
+    case CRC_ENGINE_SLICE16: return m->table_num >= CRC_UTIL_SLICE_NUM;
+#ifdef CRC_UTIL_X86
+    case CRC_ENGINE_FOLD: return m->fold_enable;
+#endif /* CRC_UTIL_X86 */
+#if defined(__x86_64__) || defined(_M_X64)
+    case CRC_ENGINE_CRC32C: return NULL != m->hw_shift;
+#endif /* __x86_64__ || _M_X64 */
+#endif /* CRC_UTIL_NORMAL */
+    default: return 0;
+    }
+}
+
+#ifndef CRC_UTIL_NORMAL
+
+// Input bytes per timing trial of crc_util_tune_calibrate.
+#define CRC_UTIL_TUNE_BYTES     (64 << 10)
+
+// Monotonic clock in seconds.
+static double crc_util_clock(void) {
+#ifdef _MSC_VER
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart / f.QuadPart;
+#else //! _MSC_VER
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif /* _MSC_VER */
+}
+
+// Keeps timed loops of crc_util_tune_calibrate from being optimized out.
+static volatile crc_t crc_util_tune_sink;
+
+// Time every usable engine on input of 2 * 4^c bytes for each length class c
+// (best of 3 trials of CRC_UTIL_TUNE_BYTES), keep the fastest in tune[c].
+static int crc_util_tune_calibrate(crc_model_t m, uint8_t tune[CRC_UTIL_TUNE_NUM]) {
+    static const crc_engine_e engines[] = { CRC_ENGINE_TABLE, CRC_ENGINE_NIBBLE,
+        CRC_ENGINE_SLICE8, CRC_ENGINE_SLICE16, CRC_ENGINE_FOLD, CRC_ENGINE_CRC32C };
+    uint8_t *buf;
+    size_t i, len, reps, r;
+    double t, best, dt;
+    int c, k, trial;
+    crc_t crc;
+    if (NULL == (buf = malloc(CRC_UTIL_TUNE_BYTES))) {
+        log_error("[%s] malloc for calibration buffer failed\n", __FUNCTION__);
+        return -2;
+    }
+    for (i = 0, crc = 0x9E3779B9; i < CRC_UTIL_TUNE_BYTES; i++) {
+        crc = crc * 1103515245 + 12345;
+        buf[i] = (uint8_t)(crc >> 16);
+    }
+    for (c = 0; c < CRC_UTIL_TUNE_NUM; c++) {
+        len = (size_t)2 << (2 * c);
+        reps = CRC_UTIL_TUNE_BYTES / len;
+        best = 0;
+        for (k = 0; k < (int)(sizeof(engines) / sizeof(engines[0])); k++) {
+            if (!crc_util_engine_usable(m, engines[k])) continue;
+            for (trial = 0, dt = 0; trial < 3; trial++) {
+                t = crc_util_clock();
+                for (r = 0, crc = 0; r < reps; r++) crc = crc_util_engine_update(m, engines[k], crc, buf, len);
+                t = crc_util_clock() - t;
+                crc_util_tune_sink = crc;
+                if (0 == trial || t < dt) dt = t;
+            }
+            // later (more involved) engines must win by 5%, so noise won't pick
+            // e.g. fold for short input, which it passes to the byte table
+            if (0 == best || dt < best * 0.95) {
+                best = dt;
+                tune[c] = (uint8_t)engines[k];
+            }
+        }
+    }
+    free(buf);
     return 0;
 }
 
+// Profile line: width poly refin cpu, then engine name per length class.
+static int crc_util_tune_load(const crc_model_t m, const char *profile, uint8_t tune[CRC_UTIL_TUNE_NUM]) {
+    FILE *f = fopen(profile, "r");
+    char line[256], name[16], *q;
+    unsigned int width, refin, cpu;
+    unsigned long long poly;
+    int n, c, e;
+    if (NULL == f) return -1;
+    while (fgets(line, sizeof(line), f)) {
+        if ('#' == line[0] || sscanf(line, "%u %llx %u %x%n", &width, &poly, &refin, &cpu, &n) != 4) continue;
+        if (width != m->param.width || poly != m->param.poly || refin != m->param.refin ||
+            cpu != crc_util_cpu_id()) {
+            continue;
+        }
+        for (c = 0, q = line + n; c < CRC_UTIL_TUNE_NUM && 1 == sscanf(q, "%15s%n", name, &n); c++, q += n) {
+            for (e = 0; crc_util_engine_name((crc_engine_e)e) && strcmp(name, crc_util_engine_name((crc_engine_e)e)); e++);
+            // stale entry (e.g. other build), calibrate again
+            if (!crc_util_engine_name((crc_engine_e)e) || !crc_util_engine_usable(m, (crc_engine_e)e)) break;
+            tune[c] = (uint8_t)e;
+        }
+        if (CRC_UTIL_TUNE_NUM == c) {
+            fclose(f);
+            return 0;
+        }
+    }
+    fclose(f);
+    return -1;
+}
+
+static void crc_util_tune_save(const crc_model_t m, const char *profile, const uint8_t tune[CRC_UTIL_TUNE_NUM]) {
+    FILE *f = fopen(profile, "a");
+    int c;
+    if (NULL == f) {
+        log_warn("[%s] can't write engine profile: %s\n", __FUNCTION__, profile);
+        return;
+    }
+    fseek(f, 0, SEEK_END);
+    if (0 == ftell(f)) {
+        fprintf(f, "# crc engine profile: width poly refin cpu, engine per input length [1, 4), [4, 16), ... [16K, inf)\n");
+    }
+    fprintf(f, "%u %" PRIX64 " %u %08X", m->param.width, (uint64_t)m->param.poly, m->param.refin, crc_util_cpu_id());
+    for (c = 0; c < CRC_UTIL_TUNE_NUM; c++) fprintf(f, " %s", crc_util_engine_name((crc_engine_e)tune[c]));
+    fprintf(f, "\n");
+    fclose(f);
+}
+
+#endif /* CRC_UTIL_NORMAL */
+
+// Messages per group of crc_util_model_run_batch.
+#define CRC_UTIL_BATCH_NUM  4
+
+// Crc of 'num' (up to CRC_UTIL_BATCH_NUM) independent messages. For a full
+// group the length all of them share runs through an interleaved engine, the
+// rest of each message through crc_util_update_raw.
+static void crc_util_batch_run(const crc_model_t m, const uint8_t *p[], const size_t len[], crc_t out[], int num) {
+    int i;
+#ifdef CRC_UTIL_NORMAL
+    for (i = 0; i < num; i++) out[i] = crc_util_model_run(m, p[i], len[i]);
+#else //! CRC_UTIL_NORMAL
+    crc_t crc[CRC_UTIL_BATCH_NUM];
+    size_t n = (size_t)-1;
+    int tables;
+    for (i = 0; i < num; i++) {
+        crc[i] = crc_util_start(m, m->init_direct);
+        if (len[i] < n) n = len[i];
+    }
+    tables = crc_util_model_lazy(m, n);
+    if (CRC_ENGINE_AUTO != m->engine || num < CRC_UTIL_BATCH_NUM) {
+        n = 0;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    else if (tables && m->hw_shift) {
+        n &= ~(size_t)7;
+        crc_util_crc32c_x4_update(crc, p, n);
+    }
+#endif /* __x86_64__ || _M_X64 */
+#ifdef CRC_UTIL_X86
+    else if (m->fold_enable && n >= CRC_UTIL_FOLD_MIN) {
+        // folding one message after another is faster
+        n = 0;
+    }
+#endif /* CRC_UTIL_X86 */
+    else if (crc_util_live > CRC_UTIL_NIBBLE_LIVE) {
+        n = 0;
+    }
+    else if (tables && m->table_num >= CRC_UTIL_SLICE_NUM) {
+        n &= ~(size_t)7;
+        CRC_UTIL_REG_CALL(crc_util_slice8_x4_update, m, crc, p, n);
+    }
+    else {
+        CRC_UTIL_REG_CALL(crc_util_table_x4_update, m, crc, p, n);
+    }
+    for (i = 0; i < num; i++) {
+        out[i] = crc_util_finish(m, crc_util_update_raw(m, crc[i], p[i] + n, len[i] - n));
+    }
+#endif /* CRC_UTIL_NORMAL */
+}
+
 /* -------------------- public  interface -------------------- */
 
 int crc_util_model_show(const crc_model_t m) {
@@ -260,25 +1241,321 @@ crc_t crc_util_model_run(const crc_model_t m, const uint8_t *p, size_t len) {
         return ~((crc_t)0);
     }
 #ifdef CRC_UTIL_NORMAL
-    return (m->param.width & 7) ? crc_util_bitbybit(m, p, len) : crc_util_table(m, p, len);
+    return crc_util_finish(m, crc_util_augment(m, crc_util_update_raw(m, crc_util_start(m, m->init_nodirect), p, len)));
 #else //! CRC_UTIL_NORMAL
-    return (m->param.width & 7) ? crc_util_bitbybit_fast(m, p, len) : crc_util_table_fast(m, p, len);
+    return crc_util_finish(m, crc_util_update_raw(m, crc_util_start(m, m->init_direct), p, len));
 #endif /* CRC_UTIL_NORMAL */
 }
 
-crc_model_t crc_util_model_init(crc_model_param_s param, void *data) {
-    if (crc_util_param_check(param)) {
-        return NULL;
+size_t crc_util_model_append(const crc_model_t m, uint8_t *frame, size_t len) {
+    if (!m || !frame) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return 0;
     }
-    crc_model_t m = (crc_model_t)calloc(1, sizeof(crc_model_s));
-    if (NULL == m) {
-        log_error("[%s] calloc for crc model failed\n", __FUNCTION__);
-        return m;
+    if (m->param.width & 7) {
+        log_error("[%s] crc width %d is not whole bytes\n", __FUNCTION__, m->param.width);
+        return 0;
+    }
+    int i, n = m->param.width / 8;
+    crc_t crc = crc_util_model_run(m, frame, len);
+    // wire order follows the input: low byte first if refin, with the
+    // swapout and refin != refout of crc_util_finish undone
+    if (m->param.swapout) crc = (crc & 0xff00) >> 8 | (crc & 0x00ff) << 8;
+    if (m->param.refout ^ m->param.refin) crc = crc_util_reflect(crc, m->param.width);
+    for (i = 0; i < n; i++) {
+        frame[len + i] = (uint8_t)(crc >> (8 * (m->param.refin ? i : n - 1 - i)));
+    }
+    return len + n;
+}
+
+int crc_util_model_verify(const crc_model_t m, const uint8_t *frame, size_t len) {
+    if (!m || !frame) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return 0;
+    }
+    if ((m->param.width & 7) || len < (size_t)m->param.width / 8) return 0;
+    return crc_util_model_run(m, frame, len) == m->residue;
+}
+
+// Chunk of crc_util_model_copy_run copied ahead of the crc, small enough to
+// be still in L1 cache when the engine reads it back.
+#define CRC_UTIL_COPY_CHUNK 4096
+
+crc_t crc_util_model_copy_run(const crc_model_t m, void *dst, const void *src, size_t len) {
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *p = (const uint8_t *)src;
+    size_t n;
+    crc_t crc;
+    if (!m || ((!dst || !src) && len)) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+#ifdef CRC_UTIL_NORMAL
+    crc = crc_util_start(m, m->init_nodirect);
+#else //! CRC_UTIL_NORMAL
+    crc = crc_util_start(m, m->init_direct);
+#ifdef CRC_UTIL_X86
+    if (CRC_ENGINE_FOLD == crc_util_engine_pick(m, len) && len >= 64) {
+        // one load for both the store and the fold
+        n = len & ~(size_t)15;
+        crc = crc_util_fold_kernel(m, crc, d, p, n);
+        d += n, p += n, len -= n;
+    }
+#endif /* CRC_UTIL_X86 */
+#endif /* CRC_UTIL_NORMAL */
+    for (; len; d += n, p += n, len -= n) {
+        n = (len < CRC_UTIL_COPY_CHUNK) ? len : CRC_UTIL_COPY_CHUNK;
+        memcpy(d, p, n);
+        crc = crc_util_update_raw(m, crc, d, n);
+    }
+#ifdef CRC_UTIL_NORMAL
+    return crc_util_finish(m, crc_util_augment(m, crc));
+#else //! CRC_UTIL_NORMAL
+    return crc_util_finish(m, crc);
+#endif /* CRC_UTIL_NORMAL */
+}
+
+// Short segments are gathered into a buffer of this size, so that engines run
+// across their boundaries on input long enough for folding. Longer segments
+// run in place.
+#define CRC_UTIL_STITCH     256
+
+crc_t crc_util_model_runv(const crc_model_t m, const struct iovec *iov, int iovcnt) {
+    uint8_t stitch[CRC_UTIL_STITCH];
+    size_t n, len, stitched = 0;
+    const uint8_t *p;
+    crc_t crc;
+    int i;
+    if (!m || (iovcnt > 0 && !iov)) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+#ifdef CRC_UTIL_NORMAL
+    crc = crc_util_start(m, m->init_nodirect);
+#else //! CRC_UTIL_NORMAL
+    crc = crc_util_start(m, m->init_direct);
+#endif /* CRC_UTIL_NORMAL */
+    for (i = 0; i < iovcnt; i++) {
+        p = (const uint8_t *)iov[i].iov_base;
+        len = iov[i].iov_len;
+        if (!p && len) {
+            log_error("[%s] invalid parameter: NULL buffer %d\n", __FUNCTION__, i);
+            return ~((crc_t)0);
+        }
+        if (len >= CRC_UTIL_STITCH) {
+            // long enough on its own
+            if (stitched) crc = crc_util_update_raw(m, crc, stitch, stitched);
+            crc = crc_util_update_raw(m, crc, p, len);
+            stitched = 0;
+            continue;
+        }
+        n = (len < CRC_UTIL_STITCH - stitched) ? len : CRC_UTIL_STITCH - stitched;
+        memcpy(stitch + stitched, p, n);
+        stitched += n;
+        if (CRC_UTIL_STITCH == stitched) {
+            crc = crc_util_update_raw(m, crc, stitch, CRC_UTIL_STITCH);
+            memcpy(stitch, p + n, len - n);
+            stitched = len - n;
+        }
+    }
+    if (stitched) crc = crc_util_update_raw(m, crc, stitch, stitched);
+#ifdef CRC_UTIL_NORMAL
+    return crc_util_finish(m, crc_util_augment(m, crc));
+#else //! CRC_UTIL_NORMAL
+    return crc_util_finish(m, crc);
+#endif /* CRC_UTIL_NORMAL */
+}
+
+int crc_util_model_run_batch(const crc_model_t m, const uint8_t **p, const size_t *len, crc_t *out, size_t n) {
+    size_t i;
+    if (!m || (n && (!p || !len || !out))) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        if (!p[i] && len[i]) {
+            log_error("[%s] invalid parameter: NULL message %lu\n", __FUNCTION__, (unsigned long)i);
+            return -1;
+        }
+    }
+    for (i = 0; i + CRC_UTIL_BATCH_NUM <= n; i += CRC_UTIL_BATCH_NUM) {
+        crc_util_batch_run(m, p + i, len + i, out + i, CRC_UTIL_BATCH_NUM);
+    }
+    if (i < n) crc_util_batch_run(m, p + i, len + i, out + i, (int)(n - i));
+    return 0;
+}
+
+int crc_util_model_run_stride(const crc_model_t m, const uint8_t *p, size_t len, size_t stride, crc_t *out, size_t n) {
+    const uint8_t *q[CRC_UTIL_BATCH_NUM];
+    size_t l[CRC_UTIL_BATCH_NUM];
+    size_t i;
+    int k, num;
+    if (!m || (n && (!p || !out))) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    for (k = 0; k < CRC_UTIL_BATCH_NUM; k++) l[k] = len;
+    for (i = 0; i < n; i += num) {
+        num = n - i < CRC_UTIL_BATCH_NUM ? (int)(n - i) : CRC_UTIL_BATCH_NUM;
+        for (k = 0; k < num; k++) q[k] = p + (i + k) * stride;
+        crc_util_batch_run(m, q, l, out + i, num);
+    }
+    return 0;
+}
+
+crc_t crc_util_model_combine(const crc_model_t m, crc_t crc1, crc_t crc2, size_t len2) {
+    if (!m) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    // raw(A|B) = (raw(A) ^ init) * x^(8 * len2) ^ raw(B), where raw(B) already
+    // carries init shifted over B. It holds with augmented algorithms as well,
+    // for direct init is the augmented nondirect one.
+    crc_t a = crc_util_unfinish(m, crc1) ^ crc_util_start(m, m->init_direct);
+    crc_t b = crc_util_unfinish(m, crc2);
+    return crc_util_finish(m, crc_util_multmodp(m, crc_util_xpow8n(m, len2), a) ^ b);
+}
+
+crc_t crc_util_model_zeros(const crc_model_t m, crc_t crc, uint64_t n) {
+    if (!m) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    return crc_util_finish(m, crc_util_multmodp(m, crc_util_xpow8n(m, n), crc_util_unfinish(m, crc)));
+}
+
+crc_t crc_util_model_update_region(const crc_model_t m, crc_t crc, size_t total_len, size_t offset,
+    const uint8_t *old_bytes, const uint8_t *new_bytes, size_t n) {
+    uint8_t delta[CRC_UTIL_COPY_CHUNK];
+    size_t i, k, tail;
+    crc_t d = 0;
+    if (!m || ((!old_bytes || !new_bytes) && n)) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+    if (offset > total_len || n > total_len - offset) {
+        log_error("[%s] invalid parameter: region [%lu, +%lu) out of %lu bytes\n", __FUNCTION__,
+            (unsigned long)offset, (unsigned long)n, (unsigned long)total_len);
+        return ~((crc_t)0);
+    }
+    // unchanged bytes at both ends add nothing to the difference
+    for (; n && *old_bytes == *new_bytes; n--) old_bytes++, new_bytes++, offset++;
+    for (; n && old_bytes[n - 1] == new_bytes[n - 1]; n--);
+    if (!n) return crc;
+    tail = total_len - offset - n;
+    // crc is linear: raw(new) = raw(old) ^ raw0(old ^ new) * x^(8 * tail),
+    // raw0 the register of the difference from zero init
+    for (i = 0; i < n; i += k) {
+        k = (n - i < CRC_UTIL_COPY_CHUNK) ? n - i : CRC_UTIL_COPY_CHUNK;
+        crc_util_xor(delta, old_bytes + i, new_bytes + i, k);
+        d = crc_util_update_raw(m, d, delta, k);
+    }
+#ifdef CRC_UTIL_NORMAL
+    d = crc_util_augment(m, d);
+#endif /* CRC_UTIL_NORMAL */
+    return crc_util_finish(m, crc_util_unfinish(m, crc) ^ crc_util_multmodp(m, crc_util_xpow8n(m, tail), d));
+}
+
+int crc_util_model_engine(crc_model_t m, crc_engine_e engine) {
+    if (!m) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    if (m->builtin) {
+        log_error("[%s] shared model %s, use a copy of crc_util_model_init\n", __FUNCTION__, m->param.name);
+        return -1;
+    }
+    if (!crc_util_engine_usable(m, engine)) {
+        log_error("[%s] engine %d not available for model or cpu\n", __FUNCTION__, engine);
+        return -1;
+    }
+    m->engine = engine;
+    return 0;
+}
+
+const char *crc_util_engine_name(crc_engine_e engine) {
+    static const char *names[] = { "auto", "bitbybit", "table", "nibble", "slice8", "slice16", "fold", "crc32c" };
+    return ((unsigned int)engine < sizeof(names) / sizeof(names[0])) ? names[engine] : NULL;
+}
+
+int crc_util_model_tune(crc_model_t m, const char *profile) {
+    if (!m) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    if (m->builtin) {
+        log_error("[%s] shared model %s, use a copy of crc_util_model_init\n", __FUNCTION__, m->param.name);
+        return -1;
+    }
+#ifndef CRC_UTIL_NORMAL
+    uint8_t tune[CRC_UTIL_TUNE_NUM] = { 0 };
+    if (!profile || crc_util_tune_load(m, profile, tune)) {
+        if (crc_util_tune_calibrate(m, tune)) return -2;
+        if (profile) crc_util_tune_save(m, profile, tune);
+    }
+    memcpy(m->tune, tune, sizeof(tune));
+#endif /* CRC_UTIL_NORMAL */
+    return 0;
+}
+
+int crc_util_begin(crc_ctx_s *ctx, const crc_model_t m) {
+    if (!ctx || !m) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    ctx->model = m;
+#ifdef CRC_UTIL_NORMAL
+    ctx->crc = crc_util_start(m, m->init_nodirect);
+#else //! CRC_UTIL_NORMAL
+    ctx->crc = crc_util_start(m, m->init_direct);
+#endif /* CRC_UTIL_NORMAL */
+    return 0;
+}
+
+int crc_util_update(crc_ctx_s *ctx, const uint8_t *p, size_t len) {
+    if (!ctx || !ctx->model || (!p && len)) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
     }
+    if (len) ctx->crc = crc_util_update_raw(ctx->model, ctx->crc, p, len);
+    return 0;
+}
+
+int crc_util_update_zeros(crc_ctx_s *ctx, uint64_t n) {
+    if (!ctx || !ctx->model) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return -1;
+    }
+    // zero bytes only shift the register, with or without augmentation
+    if (n) ctx->crc = crc_util_multmodp(ctx->model, crc_util_xpow8n(ctx->model, n), ctx->crc);
+    return 0;
+}
+
+crc_t crc_util_final(crc_ctx_s *ctx) {
+    if (!ctx || !ctx->model) {
+        log_error("[%s] invalid parameter: NULL\n", __FUNCTION__);
+        return ~((crc_t)0);
+    }
+#ifdef CRC_UTIL_NORMAL
+    return crc_util_finish(ctx->model, crc_util_augment(ctx->model, ctx->crc));
+#else //! CRC_UTIL_NORMAL
+    return crc_util_finish(ctx->model, ctx->crc);
+#endif /* CRC_UTIL_NORMAL */
+}
+
+// Set up model 'm' (zeroed), with 'table' as precomputed byte table if given.
+static int crc_util_model_setup(crc_model_t m, crc_model_param_s param, void *data, const void *table) {
     m->param = param;
     m->data = data;
+    m->engine = CRC_ENGINE_AUTO;
     m->crc_mask = ((((crc_t)1 << (m->param.width - 1)) - 1) << 1) | 1;
     m->high_bit_mask = (crc_t)1 << (m->param.width - 1);
+    m->order = (m->param.width + 7) & ~7;
+    m->reg = (m->order <= 16) ? 16 : (m->order <= 32) ? 32 : 64;
+    m->shift = m->order - m->param.width;
+    m->order_mask = ((((crc_t)1 << (m->order - 1)) - 1) << 1) | 1;
+    m->poly_raw = param.refin ? crc_util_reflect(param.poly, param.width) : param.poly;
+    crc_util_xpow8_generate(m);
     // compute missing initial CRC value
     uint16_t i;
     crc_t crc = param.init, bit;
@@ -300,15 +1577,93 @@ crc_model_t crc_util_model_init(crc_model_param_s param, void *data) {
     m->init_direct = param.init;
     m->init_nodirect = crc;
 #endif /* CRC_UTIL_NORMAL */
-    // generate lookup table if available
-    if (!(m->param.width & 7)) {
-        crc_util_table_generate(m);
+    // generate lookup tables, catalogue models get the others on first use
+    if (table) {
+        m->table = (void *)table;
+        m->table_num = 1;
+    }
+    else if (NULL != (m->table_ref = crc_util_table_ref(m, CRC_UTIL_TABLE_SLICE, NULL))) {
+        m->table = m->table_ref->data;
+        m->table_num = CRC_UTIL_SLICE_NUM;
+    }
+    else if (crc_util_table_generate(m, NULL)) {
+        return -2;
+    }
+    else if (NULL != (m->table_ref = crc_util_table_ref(m, CRC_UTIL_TABLE_SLICE, m->table))) {
+        m->table = m->table_ref->data;
+    }
+    crc_util_nibble_generate(m);
+#if defined(CRC_UTIL_X86) && !defined(CRC_UTIL_NORMAL)
+    // folding constants if cpu supports carry-less multiply
+    if ((crc_util_cpu_features() & (CRC_UTIL_CPU_PCLMUL | CRC_UTIL_CPU_SSSE3)) ==
+        (CRC_UTIL_CPU_PCLMUL | CRC_UTIL_CPU_SSSE3)) {
+        crc_util_fold_generate(m);
+        m->fold_enable = 1;
+    }
+#endif /* CRC_UTIL_X86 && !CRC_UTIL_NORMAL */
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(CRC_UTIL_NORMAL)
+    if (!table) crc_util_crc32c_generate(m);
+#endif /* (__x86_64__ || _M_X64) && !CRC_UTIL_NORMAL */
+    // residue from the empty frame, models of whole bytes only
+    if (0 == (param.width & 7)) {
+        uint8_t frame[8];
+        m->residue = crc_util_model_run(m, frame, crc_util_model_append(m, frame, 0));
+    }
+    return 0;
+}
+
+crc_model_t crc_util_model_init(crc_model_param_s param, void *data) {
+    if (crc_util_param_check(param)) {
+        return NULL;
+    }
+    crc_model_t m = (crc_model_t)calloc(1, sizeof(crc_model_s));
+    if (NULL == m) {
+        log_error("[%s] calloc for crc model failed\n", __FUNCTION__);
+        return m;
+    }
+    if (crc_util_model_setup(m, param, data, NULL)) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
+
+// Models of crc_util_model_get, set up on first use.
+static crc_model_s crc_util_builtin[CRC_CATALOG_MAX];
+// 0: not set up, 1: in setup, 2: ready
+static volatile long crc_util_builtin_state[CRC_CATALOG_MAX];
+
+crc_model_t crc_util_model_get(const char *name) {
+    int index = crc_catalog_find(name);
+    if (index < 0) {
+        log_error("[%s] unknown crc model: %s\n", __FUNCTION__, name ? name : "NULL");
+        return NULL;
+    }
+    crc_model_t m = &crc_util_builtin[index];
+    volatile long *state = &crc_util_builtin_state[index];
+    // atomic read (add 0) to see the model set up by another thread
+    if (2 != CRC_UTIL_ATOMIC_ADD(state, 0)) {
+        if (CRC_UTIL_ATOMIC_CAS(state, 0, 1)) {
+            m->builtin = 1;
+            crc_util_model_setup(m, *crc_util_model_param(name), NULL, crc_catalog_table(index));
+            CRC_UTIL_ATOMIC_ADD(state, 1);
+        }
+        // setup takes some microseconds
+        while (2 != CRC_UTIL_ATOMIC_ADD(state, 0));
     }
     return m;
 }
 
 int crc_util_model_fini(crc_model_t model) {
-    if (model) free(model->table);
+    if (model && model->builtin) {
+        return 0;
+    }
+    if (model) {
+        if (model->table_ref) crc_util_table_unref(model->table_ref);
+        else free(model->table);
+        if (model->hw_ref) crc_util_table_unref(model->hw_ref);
+        else free(model->hw_shift);
+    }
     return (free(model), 0);
 }
 
@@ -343,13 +1698,60 @@ void crc_util_model_debug(const crc_model_t m, const uint8_t *p, size_t len) {
         else {
             log_error("[%s] crc lookup table      :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
         }
-        if (m->param.check == (crc = crc_util_table_fast(m, p, len))) {
-            log_verbose("[%s] crc lookup table fast :   0x"CRC_F"\n", __FUNCTION__, crc);
-        }
-        else {
-            log_error("[%s] crc lookup table fast :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
-        }
     }
+    // test left-aligned table algorithms, available for all orders
+    if (m->param.check == (crc = crc_util_table_fast(m, p, len))) {
+        log_verbose("[%s] crc lookup table fast :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc lookup table fast :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+    if (m->param.check == (crc = crc_util_nibble(m, p, len))) {
+        log_verbose("[%s] crc nibble table      :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc nibble table      :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+    if (m->table_num < CRC_UTIL_SLICE_NUM) {
+        // precomputed byte table only
+    }
+    else if (m->param.check == (crc = crc_util_slice8(m, p, len))) {
+        log_verbose("[%s] crc slicing by 8      :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc slicing by 8      :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+    if (m->table_num < CRC_UTIL_SLICE_NUM) {
+        // precomputed byte table only
+    }
+    else if (m->param.check == (crc = crc_util_slice16(m, p, len))) {
+        log_verbose("[%s] crc slicing by 16     :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc slicing by 16     :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+#ifdef CRC_UTIL_X86
+    if (!m->fold_enable) {
+        // no carry-less multiply on this cpu
+    }
+    else if (m->param.check == (crc = crc_util_fold(m, p, len))) {
+        log_verbose("[%s] crc clmul folding     :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc clmul folding     :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+#endif /* CRC_UTIL_X86 */
+#if defined(__x86_64__) || defined(_M_X64)
+    if (!m->hw_shift) {
+        // not Castagnoli or no SSE4.2
+    }
+    else if (m->param.check == (crc = crc_util_crc32c_hw(m, p, len))) {
+        log_verbose("[%s] crc sse4.2 crc32c     :   0x"CRC_F"\n", __FUNCTION__, crc);
+    }
+    else {
+        log_error("[%s] crc sse4.2 crc32c     :   0x"CRC_F"(0x"CRC_F")\n", __FUNCTION__, crc, m->param.check);
+    }
+#endif /* __x86_64__ || _M_X64 */
     printf("\n");
 }
 #endif  /* _DEBUG */
@@ -0,0 +1,190 @@
+// ------------------------------------------------------------------------
+// @brief:      crc toolkit
+// @file:       crc_utils_reg.h
+// @author:     qinhj@lsec.cc.ac.cn
+// @date:       2020/04/22
+// ------------------------------------------------------------------------
+
+// Table engines for one register type, included by crc_utils.c once per type
+// with CRC_REG_T (uint16_t, uint32_t or uint64_t) and CRC_REG_BITS defined.
+// Each function gets the bits as suffix, e.g. crc_util_table_fast_update16,
+// and reads the model tables as entries of CRC_REG_T, so that 16-bit models
+// only carry 16-bit tables. The register is kept in CRC_REG_T too.
+
+#if !defined(CRC_REG_T) || !defined(CRC_REG_BITS)
+#error "CRC_REG_T and CRC_REG_BITS must be defined"
+#endif
+
+#define CRC_REG_FN(name)    CRC_UTIL_CAT(name, CRC_REG_BITS)
+#define CRC_REG_TABLE(m)    ((const CRC_REG_T (*)[256])(m)->table)
+
+#if defined(CRC_UTIL_NORMAL) || defined(_DEBUG)
+
+static crc_t CRC_REG_FN(crc_util_table_update)(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint32_t order = m->param.width;
+    const CRC_REG_T *t = CRC_REG_TABLE(m)[0];
+    CRC_REG_T c = (CRC_REG_T)crc;
+    if (!m->param.refin) {
+        while (len--) c = ((c << 8) | *p++) ^ t[(c >> (order - 8)) & 0xff];
+    }
+    else {
+        // reflect input
+        while (len--) c = ((c >> 8) | ((CRC_REG_T)*p++ << (order - 8))) ^ t[c & 0xff];
+    }
+    return (crc_t)c & m->crc_mask;
+}
+
+#endif  /* CRC_UTIL_NORMAL || _DEBUG */
+
+#ifndef CRC_UTIL_NORMAL
+
+static crc_t CRC_REG_FN(crc_util_table_fast_update)(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T *t = CRC_REG_TABLE(m)[0];
+    CRC_REG_T c = (CRC_REG_T)crc;
+    if (!m->param.refin) {
+        c <<= m->shift;
+        while (len--) c = (c << 8) ^ t[((c >> (order - 8)) & 0xff) ^ *p++];
+        return ((crc_t)c & m->order_mask) >> m->shift;
+    }
+    while (len--) c = (c >> 8) ^ t[(c & 0xff) ^ *p++];
+    return c;
+}
+
+static crc_t CRC_REG_FN(crc_util_nibble_update)(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T *t = (const CRC_REG_T *)&m->table_nibble;
+    CRC_REG_T c = (CRC_REG_T)crc;
+    if (!m->param.refin) {
+        c <<= m->shift;
+        for (; len--; p++) {
+            c = (c << 4) ^ t[((c >> (order - 4)) ^ (*p >> 4)) & 0xf];
+            c = (c << 4) ^ t[((c >> (order - 4)) ^ *p) & 0xf];
+        }
+        return ((crc_t)c & m->order_mask) >> m->shift;
+    }
+    for (; len--; p++) {
+        c = (c >> 4) ^ t[(c ^ *p) & 0xf];
+        c = (c >> 4) ^ t[(c ^ (*p >> 4)) & 0xf];
+    }
+    return c;
+}
+
+static crc_t CRC_REG_FN(crc_util_slice8_update)(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T (*t)[256] = CRC_REG_TABLE(m);
+    CRC_REG_T c = (CRC_REG_T)crc;
+    uint64_t v;
+    if (!m->param.refin) {
+        c <<= m->shift;
+        for (; len >= 8; len -= 8, p += 8) {
+            v = ((uint64_t)c << (64 - order)) ^ crc_util_load_be64(p);
+            c = CRC_UTIL_SLICE8_NOREFIN(t, v);
+        }
+        c >>= m->shift;
+    }
+    else {
+        for (; len >= 8; len -= 8, p += 8) {
+            v = (uint64_t)c ^ crc_util_load_le64(p);
+            c = CRC_UTIL_SLICE8_REFIN(t, v);
+        }
+    }
+    return CRC_REG_FN(crc_util_table_fast_update)(m, c, p, len);
+}
+
+static crc_t CRC_REG_FN(crc_util_slice16_update)(const crc_model_t m, crc_t crc, const uint8_t *p, size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T (*t)[256] = CRC_REG_TABLE(m);
+    const CRC_REG_T (*hi)[256] = t + 8;
+    CRC_REG_T c = (CRC_REG_T)crc;
+    uint64_t v, w;
+    if (!m->param.refin) {
+        c <<= m->shift;
+        for (; len >= 16; len -= 16, p += 16) {
+            v = ((uint64_t)c << (64 - order)) ^ crc_util_load_be64(p);
+            w = crc_util_load_be64(p + 8);
+            c = CRC_UTIL_SLICE8_NOREFIN(hi, v) ^ CRC_UTIL_SLICE8_NOREFIN(t, w);
+        }
+        c >>= m->shift;
+    }
+    else {
+        for (; len >= 16; len -= 16, p += 16) {
+            v = (uint64_t)c ^ crc_util_load_le64(p);
+            w = crc_util_load_le64(p + 8);
+            c = CRC_UTIL_SLICE8_REFIN(hi, v) ^ CRC_UTIL_SLICE8_REFIN(t, w);
+        }
+    }
+    return CRC_REG_FN(crc_util_slice8_update)(m, c, p, len);
+}
+
+// Byte table engine on 4 independent messages at once, 'len' bytes each.
+static void CRC_REG_FN(crc_util_table_x4_update)(const crc_model_t m, crc_t crc[4], const uint8_t *p[4], size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T *t = CRC_REG_TABLE(m)[0];
+    CRC_REG_T c0 = (CRC_REG_T)crc[0], c1 = (CRC_REG_T)crc[1], c2 = (CRC_REG_T)crc[2], c3 = (CRC_REG_T)crc[3];
+    size_t i;
+    if (!m->param.refin) {
+        c0 <<= m->shift, c1 <<= m->shift, c2 <<= m->shift, c3 <<= m->shift;
+        for (i = 0; i < len; i++) {
+            c0 = (c0 << 8) ^ t[((c0 >> (order - 8)) & 0xff) ^ p[0][i]];
+            c1 = (c1 << 8) ^ t[((c1 >> (order - 8)) & 0xff) ^ p[1][i]];
+            c2 = (c2 << 8) ^ t[((c2 >> (order - 8)) & 0xff) ^ p[2][i]];
+            c3 = (c3 << 8) ^ t[((c3 >> (order - 8)) & 0xff) ^ p[3][i]];
+        }
+        crc[0] = ((crc_t)c0 & m->order_mask) >> m->shift;
+        crc[1] = ((crc_t)c1 & m->order_mask) >> m->shift;
+        crc[2] = ((crc_t)c2 & m->order_mask) >> m->shift;
+        crc[3] = ((crc_t)c3 & m->order_mask) >> m->shift;
+        return;
+    }
+    for (i = 0; i < len; i++) {
+        c0 = (c0 >> 8) ^ t[(c0 & 0xff) ^ p[0][i]];
+        c1 = (c1 >> 8) ^ t[(c1 & 0xff) ^ p[1][i]];
+        c2 = (c2 >> 8) ^ t[(c2 & 0xff) ^ p[2][i]];
+        c3 = (c3 >> 8) ^ t[(c3 & 0xff) ^ p[3][i]];
+    }
+    crc[0] = c0, crc[1] = c1, crc[2] = c2, crc[3] = c3;
+}
+
+// Slicing-by-8 on 4 independent messages at once, 'len' (multiple of 8) bytes
+// each. The 4 dependency chains interleave, so table loads of one message
+// overlap the xor tree of the others.
+static void CRC_REG_FN(crc_util_slice8_x4_update)(const crc_model_t m, crc_t crc[4], const uint8_t *p[4], size_t len) {
+    uint32_t order = m->order;
+    const CRC_REG_T (*t)[256] = CRC_REG_TABLE(m);
+    CRC_REG_T c0 = (CRC_REG_T)crc[0], c1 = (CRC_REG_T)crc[1], c2 = (CRC_REG_T)crc[2], c3 = (CRC_REG_T)crc[3];
+    uint64_t v0, v1, v2, v3;
+    size_t i;
+    if (!m->param.refin) {
+        c0 <<= m->shift, c1 <<= m->shift, c2 <<= m->shift, c3 <<= m->shift;
+        for (i = 0; i < len; i += 8) {
+            v0 = ((uint64_t)c0 << (64 - order)) ^ crc_util_load_be64(p[0] + i);
+            v1 = ((uint64_t)c1 << (64 - order)) ^ crc_util_load_be64(p[1] + i);
+            v2 = ((uint64_t)c2 << (64 - order)) ^ crc_util_load_be64(p[2] + i);
+            v3 = ((uint64_t)c3 << (64 - order)) ^ crc_util_load_be64(p[3] + i);
+            c0 = CRC_UTIL_SLICE8_NOREFIN(t, v0);
+            c1 = CRC_UTIL_SLICE8_NOREFIN(t, v1);
+            c2 = CRC_UTIL_SLICE8_NOREFIN(t, v2);
+            c3 = CRC_UTIL_SLICE8_NOREFIN(t, v3);
+        }
+        c0 >>= m->shift, c1 >>= m->shift, c2 >>= m->shift, c3 >>= m->shift;
+    }
+    else {
+        for (i = 0; i < len; i += 8) {
+            v0 = (uint64_t)c0 ^ crc_util_load_le64(p[0] + i);
+            v1 = (uint64_t)c1 ^ crc_util_load_le64(p[1] + i);
+            v2 = (uint64_t)c2 ^ crc_util_load_le64(p[2] + i);
+            v3 = (uint64_t)c3 ^ crc_util_load_le64(p[3] + i);
+            c0 = CRC_UTIL_SLICE8_REFIN(t, v0);
+            c1 = CRC_UTIL_SLICE8_REFIN(t, v1);
+            c2 = CRC_UTIL_SLICE8_REFIN(t, v2);
+            c3 = CRC_UTIL_SLICE8_REFIN(t, v3);
+        }
+    }
+    crc[0] = c0, crc[1] = c1, crc[2] = c2, crc[3] = c3;
+}
+
+#endif  /* CRC_UTIL_NORMAL */
+
+#undef CRC_REG_TABLE
+#undef CRC_REG_FN